@@ -42,6 +42,15 @@ cpack_add_component(C004_data
     GROUP apps
 )
 
+if (QUICK_DRA_SHARED_LIBRARY)
+    cpack_add_component(C005_library
+        DISPLAY_NAME "Biblioteka C"
+        DESCRIPTION "Biblioteka współdzielona do tworzenia dokumentów KEDU z poziomu innych aplikacji"
+        DEPENDS C004_data
+        DISABLED
+    )
+endif()
+
 if (TARGET Qt6::Gui)
     cpack_configure_downloads(
         "https://github.com/mbits-os/quick_dra/releases/download/v${PROJECT_VERSION}/"
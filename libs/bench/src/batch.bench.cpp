@@ -0,0 +1,96 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <memory_resource>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/docs/file_set.hpp>
+#include <quick_dra/docs/forms.hpp>
+#include <roster.hpp>
+#include <rss.hpp>
+#include <vector>
+
+namespace quick_dra::bench {
+	namespace {
+		constexpr size_t payer_count = 1'000;
+		constexpr size_t insured_per_payer = 3;
+
+		compiled_block fields_of(std::initializer_list<std::string_view> refs) {
+			compiled_block result{};
+			auto index = 0u;
+			for (auto ref : refs) {
+				result.fields.emplace(++index, compiled_value{varname::parse(ref)});
+			}
+			return result;
+		}
+
+		// a trimmed-down copy of the shape of templates.yaml
+		compiled_templates make_templates() {
+			compiled_templates result{};
+			auto& rca = result.reports["RCA"s];
+			rca.push_back({.id = "I"s, .blocks = {}});
+			rca.back().blocks.push_back(fields_of({"serial.NN"sv, "serial.DATE"sv, "today"sv}));
+			rca.push_back({.id = "II"s, .blocks = {}});
+			rca.back().blocks.push_back(fields_of({"payer.tax_id"sv, "payer.social_id"sv, "payer.last"sv}));
+			rca.push_back({.id = "III"s, .repeatable = true, .blocks = {}});
+			rca.back().blocks.push_back(fields_of({"insured.last"sv, "insured.first"sv, "insured.document"sv}));
+			rca.back().blocks.push_back(fields_of({"salary.gross"sv, "salary.net"sv, "tax_total"sv}));
+
+			auto& dra = result.reports["DRA"s];
+			dra.push_back({.id = "I"s, .blocks = {}});
+			dra.back().blocks.push_back(fields_of({"serial.NN"sv, "serial.DATE"sv, "today"sv}));
+			dra.push_back({.id = "IV"s, .blocks = {}});
+			dra.back().blocks.push_back(fields_of({"insurance_total"sv, "tax_total"sv}));
+			return result;
+		}
+
+		std::vector<config> make_payers() {
+			std::vector<config> result{};
+			result.reserve(payer_count);
+			for (size_t index = 0; index < payer_count; ++index) {
+				result.push_back(make_config(insured_per_payer, index));
+			}
+			return result;
+		}
+
+		// Each payer gets the forms and the document of one report; the
+		// heap variant is the baseline for the arena one.
+		template <bool UseArena>
+		void run_batch(std::vector<config> const& payers, compiled_templates const& templates, rca_cache& cache) {
+			for (auto const& cfg : payers) {
+				std::pmr::monotonic_buffer_resource arena{};
+				auto const resource = UseArena ? &arena : std::pmr::get_default_resource();
+				auto const forms =
+				    prepare_form_set(verbose::none, 1, 2026y / January, 2026y / February / 5, cfg, &cache, resource);
+				benchmark::DoNotOptimize(build_file_set(verbose::none, forms, templates, resource));
+			}
+		}
+
+		template <bool UseArena>
+		void payer_batch(benchmark::State& state) {
+			auto const payers = make_payers();
+			auto const templates = make_templates();
+			rca_cache cache{};
+
+			auto const before = alloc::total();
+			for (auto _ : state) {
+				run_batch<UseArena>(payers, templates, cache);
+			}
+			auto const allocated = alloc::total() - before;
+
+			auto const count = static_cast<double>(state.iterations() * payer_count);
+			state.counters["allocs/payer"] = static_cast<double>(allocated.allocations) / count;
+			state.counters["bytes/payer"] = static_cast<double>(allocated.bytes) / count;
+			// one more batch, in a process of its own, so the variant run
+			// first does not set the peak for the other one
+			state.counters["peak RSS growth [KiB]"] = static_cast<double>(
+			    peak_rss_growth_kib([&] { run_batch<UseArena>(payers, templates, cache); }));
+		}
+
+		void payer_batch_heap(benchmark::State& state) { payer_batch<false>(state); }
+		void payer_batch_arena(benchmark::State& state) { payer_batch<true>(state); }
+	}  // namespace
+
+	BENCHMARK(payer_batch_heap)->Unit(benchmark::kMillisecond);
+	BENCHMARK(payer_batch_arena)->Unit(benchmark::kMillisecond);
+}  // namespace quick_dra::bench
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <quick_dra/models/project_reader.hpp>
+#include <roster.hpp>
+
+namespace quick_dra::bench {
+	namespace {
+		// the editable model, as the config commands read it
+		void config_load(benchmark::State& state) {
+			auto const path = temp_path("config_load.yaml"sv);
+			make_partial_config(static_cast<size_t>(state.range(0))).store(path);
+
+			for (auto _ : state) {
+				partial::config cfg{};
+				if (cfg.load(path) != load_status::loaded) {
+					state.SkipWithError("cannot load the stored roster");
+					break;
+				}
+				benchmark::DoNotOptimize(cfg);
+			}
+
+			state.SetComplexityN(state.range(0));
+			std::error_code ec{};
+			std::filesystem::remove(path, ec);
+		}
+
+		// the validated model, as `qdra xml` reads it
+		void config_parse_yaml(benchmark::State& state) {
+			auto const path = temp_path("config_parse_yaml.yaml"sv);
+			make_partial_config(static_cast<size_t>(state.range(0))).store(path);
+
+			for (auto _ : state) {
+				auto cfg = config::parse_yaml(path);
+				if (!cfg) {
+					state.SkipWithError("cannot parse the stored roster");
+					break;
+				}
+				benchmark::DoNotOptimize(cfg);
+			}
+
+			state.SetComplexityN(state.range(0));
+			std::error_code ec{};
+			std::filesystem::remove(path, ec);
+		}
+	}  // namespace
+
+	BENCHMARK(config_load)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+	BENCHMARK(config_parse_yaml)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+}  // namespace quick_dra::bench
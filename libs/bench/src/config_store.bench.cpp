@@ -0,0 +1,32 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <quick_dra/models/project_reader.hpp>
+#include <roster.hpp>
+
+namespace quick_dra::bench {
+	namespace {
+		void config_store(benchmark::State& state) {
+			auto const insured_count = static_cast<size_t>(state.range(0));
+			auto const source = make_partial_config(insured_count);
+			auto const path = temp_path("config_store.yaml"sv);
+
+			for (auto _ : state) {
+				// store() rewrites names and documents into their on-disk form
+				state.PauseTiming();
+				auto cfg = source;
+				state.ResumeTiming();
+
+				benchmark::DoNotOptimize(cfg.store(path));
+			}
+
+			state.SetComplexityN(state.range(0));
+			std::error_code ec{};
+			std::filesystem::remove(path, ec);
+		}
+	}  // namespace
+
+	BENCHMARK(config_store)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+}  // namespace quick_dra::bench
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <memory_resource>
+#include <quick_dra/docs/file_set.hpp>
+#include <quick_dra/docs/forms.hpp>
+#include <quick_dra/docs/xml.hpp>
+#include <roster.hpp>
+#include <sstream>
+#include <vector>
+
+namespace quick_dra::bench {
+	namespace {
+		std::vector<form> make_forms(config const& cfg) {
+			return prepare_form_set(verbose::none, 1, 2026y / January, 2026y / February / 5, cfg);
+		}
+
+		// the KEDU document of a whole report, in one arena, as `qdra xml` does
+		void build_file_set(benchmark::State& state) {
+			auto const templates = load_templates();
+			if (!templates) {
+				state.SkipWithError("cannot load templates.yaml");
+				return;
+			}
+			auto const cfg = make_config(static_cast<size_t>(state.range(0)));
+			auto const forms = make_forms(cfg);
+
+			for (auto _ : state) {
+				std::pmr::monotonic_buffer_resource arena{};
+				benchmark::DoNotOptimize(quick_dra::build_file_set(verbose::none, forms, *templates, &arena));
+			}
+
+			state.SetComplexityN(state.range(0));
+		}
+
+		// the document written out, without the disk
+		template <bool Indented>
+		void xml_serialize(benchmark::State& state) {
+			auto const templates = load_templates();
+			if (!templates) {
+				state.SkipWithError("cannot load templates.yaml");
+				return;
+			}
+			auto const cfg = make_config(static_cast<size_t>(state.range(0)));
+			auto const document = quick_dra::build_file_set(verbose::none, make_forms(cfg), *templates);
+
+			size_t bytes{};
+			for (auto _ : state) {
+				std::ostringstream out{};
+				if constexpr (Indented)
+					out << document.indented();
+				else
+					out << document;
+				bytes += out.view().size();
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(bytes));
+			state.SetComplexityN(state.range(0));
+		}
+
+		void xml_serialize_flat(benchmark::State& state) { xml_serialize<false>(state); }
+		void xml_serialize_indented(benchmark::State& state) { xml_serialize<true>(state); }
+	}  // namespace
+
+	BENCHMARK(build_file_set)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+	BENCHMARK(xml_serialize_flat)
+	    ->RangeMultiplier(100)
+	    ->Range(1, 100'000)
+	    ->Unit(benchmark::kMillisecond)
+	    ->Complexity();
+	BENCHMARK(xml_serialize_indented)
+	    ->RangeMultiplier(100)
+	    ->Range(1, 100'000)
+	    ->Unit(benchmark::kMillisecond)
+	    ->Complexity();
+}  // namespace quick_dra::bench
@@ -0,0 +1,50 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <quick_dra/docs/forms.hpp>
+#include <roster.hpp>
+
+namespace quick_dra::bench {
+	namespace {
+		// every RCA form and the DRA summing them up
+		void prepare_form_set(benchmark::State& state) {
+			auto const insured_count = static_cast<size_t>(state.range(0));
+			auto const cfg = make_config(insured_count);
+
+			for (auto _ : state) {
+				// a fresh cache each time, so every distinct profile is computed
+				benchmark::DoNotOptimize(
+				    quick_dra::prepare_form_set(verbose::none, 1, 2026y / January, 2026y / February / 5, cfg));
+			}
+
+			state.SetComplexityN(state.range(0));
+		}
+
+		// the sections of every form, calculated from the templates
+		void form_fill(benchmark::State& state) {
+			auto const templates = load_templates();
+			if (!templates) {
+				state.SkipWithError("cannot load templates.yaml");
+				return;
+			}
+
+			auto const cfg = make_config(static_cast<size_t>(state.range(0)));
+			auto const forms =
+			    quick_dra::prepare_form_set(verbose::none, 1, 2026y / January, 2026y / February / 5, cfg);
+
+			for (auto _ : state) {
+				for (auto const& form : forms) {
+					auto const it = templates->reports.find(form.key);
+					if (it == templates->reports.end()) continue;
+					benchmark::DoNotOptimize(form.fill(verbose::none, it->second));
+				}
+			}
+
+			state.SetComplexityN(state.range(0));
+		}
+	}  // namespace
+
+	BENCHMARK(prepare_form_set)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+	BENCHMARK(form_fill)->RangeMultiplier(100)->Range(1, 100'000)->Unit(benchmark::kMillisecond)->Complexity();
+}  // namespace quick_dra::bench
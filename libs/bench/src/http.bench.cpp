@@ -0,0 +1,64 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <future>
+#include <quick_dra/io/http.hpp>
+#include <string>
+#include <vector>
+
+namespace quick_dra::bench {
+	namespace {
+		// e.g. `python tools/server.py -d data/config 8000` and
+		// QUICK_DRA_BENCH_URL=http://localhost:8000/tax_config.yaml
+		char const* stand_in_url(benchmark::State& state) {
+			auto const* const URL = std::getenv("QUICK_DRA_BENCH_URL");
+			if (!URL || !*URL) {
+				state.SkipWithError("QUICK_DRA_BENCH_URL is not set");
+				return nullptr;
+			}
+			return URL;
+		}
+
+		// one request after another, each waiting for the previous one
+		void http_sequential(benchmark::State& state) {
+			auto const url = stand_in_url(state);
+			if (!url) return;
+			auto const count = static_cast<size_t>(state.range(0));
+
+			for (auto _ : state) {
+				for (size_t index = 0; index < count; ++index) {
+					benchmark::DoNotOptimize(http_get(url));
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+		}
+
+		// all requests in flight at once
+		void http_concurrent(benchmark::State& state) {
+			auto const url = stand_in_url(state);
+			if (!url) return;
+			auto const count = static_cast<size_t>(state.range(0));
+			auto& client = http_client::shared();
+
+			std::vector<std::future<http_response>> responses{};
+			responses.reserve(count);
+			for (auto _ : state) {
+				responses.clear();
+				for (size_t index = 0; index < count; ++index) {
+					responses.push_back(client.get({.url = url}));
+				}
+				for (auto& response : responses) {
+					benchmark::DoNotOptimize(response.get());
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+		}
+	}  // namespace
+
+	BENCHMARK(http_sequential)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond)->UseRealTime();
+	BENCHMARK(http_concurrent)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond)->UseRealTime();
+}  // namespace quick_dra::bench
@@ -0,0 +1,272 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <quick_dra/base/paths.hpp>
+#include <quick_dra/fixtures/config.hpp>
+#include <quick_dra/lex/validators.hpp>
+#include <roster.hpp>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace quick_dra::bench {
+	namespace {
+		constexpr std::string_view first_names[] = {
+		    "Anna"sv,    "Piotr"sv, "Maria"sv,  "Krzysztof"sv, "Zofia"sv,     "Stanisław"sv, "Łucja"sv,
+		    "Jan"sv,     "Ewa"sv,   "Tomasz"sv, "Agnieszka"sv, "Paweł"sv,     "Joanna"sv,    "Michał"sv,
+		    "Barbara"sv, "Józef"sv, "Halina"sv, "Grzegorz"sv,  "Katarzyna"sv, "Andrzej"sv,
+		};
+		constexpr std::string_view last_names[] = {
+		    "Nowak"sv,       "Kowalski"sv,  "Wiśniewska"sv, "Żółkiewski"sv,  "Wójcik"sv,   "Kamińska"sv,
+		    "Lewandowski"sv, "Iksiński"sv,  "Zielińska"sv,  "Szymański"sv,   "Woźniak"sv,  "Dąbrowska"sv,
+		    "Kozłowski"sv,   "Jankowska"sv, "Mazur"sv,      "Kwiatkowski"sv, "Krawczyk"sv, "Piotrowska"sv,
+		};
+
+		// most people work full time
+		constexpr ratio part_time_scales[] = {full_time,   full_time,   full_time,  ratio{1, 2},
+		                                      ratio{3, 4}, ratio{1, 4}, ratio{4, 5}};
+
+		// splitmix64, so the roster does not depend on the standard library
+		class generator {
+		public:
+			explicit generator(std::uint64_t seed) noexcept : state_{seed} {}
+
+			std::uint64_t next() noexcept {
+				auto result = (state_ += 0x9e37'79b9'7f4a'7c15ull);
+				result = (result ^ (result >> 30)) * 0xbf58'476d'1ce4'e5b9ull;
+				result = (result ^ (result >> 27)) * 0x94d0'49bb'1331'11ebull;
+				return result ^ (result >> 31);
+			}
+
+			unsigned below(unsigned count) noexcept { return static_cast<unsigned>(next() % count); }
+			std::chrono::months months_below(unsigned count) noexcept {
+				return std::chrono::months{static_cast<int>(below(count))};
+			}
+
+			template <typename Item, size_t Length>
+			Item const& pick(Item const (&items)[Length]) noexcept {
+				return items[below(static_cast<unsigned>(Length))];
+			}
+
+			char digit() noexcept { return static_cast<char>('0' + below(10)); }
+			char letter() noexcept { return static_cast<char>('A' + below(26)); }
+
+		private:
+			std::uint64_t state_;
+		};
+
+		// a different stream for each person of each payer
+		generator seeded(size_t payer_index, size_t index) noexcept {
+			return generator{(static_cast<std::uint64_t>(payer_index) << 40) ^ static_cast<std::uint64_t>(index)};
+		}
+
+		template <typename Validator>
+		bool with_check_digit(std::string& id) {
+			auto& digit = Validator::select(id);
+			digit = '0';
+			auto const checksum = Validator::checksum(id);
+			if (checksum == kInvalidChecksum) return false;
+			digit = static_cast<char>('0' + checksum);
+			return Validator::is_valid(id);
+		}
+
+		std::string make_social_id(generator& rng) {
+			auto const year = 1960 + static_cast<int>(rng.below(46));
+			auto const month = 1 + rng.below(12) + (year >= 2000 ? 20 : 0);
+			auto const day = 1 + rng.below(28);
+			auto result = fmt::format("{:02}{:02}{:02}{:04}0", year % 100, month, day, rng.below(10'000));
+			with_check_digit<social_id_validator>(result);
+			return result;
+		}
+
+		std::string make_tax_id(generator& rng) {
+			std::string result(10, '0');
+			do {
+				// the tax office code never starts with a zero
+				result[0] = static_cast<char>('1' + rng.below(9));
+				for (size_t index = 1; index < 9; ++index) {
+					result[index] = rng.digit();
+				}
+			} while (!with_check_digit<tax_id_validator>(result));
+			return result;
+		}
+
+		std::string make_id_card(generator& rng) {
+			std::string result{rng.letter(), rng.letter(), rng.letter(), '0'};
+			for (size_t index = 0; index < 5; ++index) {
+				result.push_back(rng.digit());
+			}
+			with_check_digit<id_card_validator>(result);
+			return result;
+		}
+
+		std::string make_passport(generator& rng) {
+			std::string result{rng.letter(), rng.letter(), '0'};
+			for (size_t index = 0; index < 6; ++index) {
+				result.push_back(rng.digit());
+			}
+			with_check_digit<pl_passport_validator>(result);
+			return result;
+		}
+
+		// a third of the roster for each kind of document
+		std::pair<std::string, std::string> make_document(generator& rng) {
+			switch (rng.below(3)) {
+				case 0:
+					return {"P"s, make_social_id(rng)};
+				case 1:
+					return {"1"s, make_id_card(rng)};
+				default:
+					return {"2"s, make_passport(rng)};
+			}
+		}
+
+		// Somewhere from the minimal pay, which shows up as no salary at
+		// all, to the second tax bracket, in steps of 50 zł.
+		std::optional<currency> make_salary(generator& rng) {
+			if (rng.below(3) == 0) return std::nullopt;
+			return currency{static_cast<long long>(4'666'00 + rng.below(600) * 50'00)};
+		}
+
+		// Employed some time in 2023-2025, with up to three changes to the
+		// salary or the part-time scale since, some of them still ahead.
+		template <typename History>
+		void make_history(generator& rng, History& history) {
+			auto date = 2023y / January + rng.months_below(36);
+			auto scale = rng.pick(part_time_scales);
+			auto salary = make_salary(rng);
+			history[date] = {.part_time_scale = scale, .salary = salary};
+
+			for (auto changes = rng.below(4); changes > 0; --changes) {
+				date += std::chrono::months{1} + rng.months_below(12);
+				if (date > 2026y / June) break;
+				switch (rng.below(3)) {
+					case 0:
+						scale = rng.pick(part_time_scales);
+						break;
+					case 1:
+						salary = make_salary(rng);
+						break;
+					default:
+						scale = rng.pick(part_time_scales);
+						salary = make_salary(rng);
+				}
+				history[date] = {.part_time_scale = scale, .salary = salary};
+			}
+		}
+
+		partial::insured_t make_insured(size_t payer_index, size_t index) {
+			auto rng = seeded(payer_index, index + 1);
+
+			partial::insured_t person{};
+			person.first_name = std::string{rng.pick(first_names)};
+			person.last_name = std::string{rng.pick(last_names)};
+			std::tie(person.kind, person.document) = make_document(rng);
+			person.title = insurance_title{.title_code = "0110"s, .pension_right = 0, .disability_level = 0};
+			make_history(rng, person.history.emplace());
+			return person;
+		}
+
+		insured_t make_full_insured(size_t payer_index, size_t index) {
+			auto const source = make_insured(payer_index, index);
+			std::map<year_month, employment_history> history{};
+			for (auto const& [date, item] : *source.history) {
+				history[date] = {.part_time_scale = item.part_time_scale, .salary = item.salary};
+			}
+
+			return insured_t{
+			    person{
+			        .last_name = *source.last_name,
+			        .id_card = {},
+			        .passport = {},
+			        .first_name = *source.first_name,
+			        .kind = *source.kind,
+			        .document = *source.document,
+			    },
+			    *source.title,
+			    {},
+			    std::move(history),
+			};
+		}
+
+		// payers show an ID card or a passport, never a PESEL
+		partial::payer_t make_payer(size_t payer_index) {
+			auto rng = seeded(payer_index, 0);
+
+			partial::payer_t payer{};
+			payer.first_name = std::string{rng.pick(first_names)};
+			payer.last_name = std::string{rng.pick(last_names)};
+			if (rng.below(2) == 0) {
+				payer.kind = "1"s;
+				payer.document = make_id_card(rng);
+			} else {
+				payer.kind = "2"s;
+				payer.document = make_passport(rng);
+			}
+			payer.tax_id = make_tax_id(rng);
+			payer.social_id = make_social_id(rng);
+			return payer;
+		}
+	}  // namespace
+
+	partial::config make_partial_config(size_t insured_count, size_t payer_index) {
+		partial::config cfg{};
+		cfg.version = static_cast<unsigned short>(v2::kApiVersion);
+		cfg.payer = make_payer(payer_index);
+
+		auto& insured = cfg.insured.emplace();
+		insured.reserve(insured_count);
+		for (size_t index = 0; index < insured_count; ++index) {
+			insured.push_back(make_insured(payer_index, index));
+		}
+
+		return cfg;
+	}
+
+	config make_config(size_t insured_count, size_t payer_index) {
+		auto const source = make_payer(payer_index);
+
+		config cfg{};
+		cfg.version = kApiVersion;
+		cfg.payer = payer_t{
+		    person{
+		        .last_name = *source.last_name,
+		        .id_card = {},
+		        .passport = {},
+		        .first_name = *source.first_name,
+		        .kind = *source.kind,
+		        .document = *source.document,
+		    },
+		    *source.tax_id,
+		    *source.social_id,
+		};
+
+		cfg.params = fixtures::parameters();
+
+		cfg.insured.reserve(insured_count);
+		for (size_t index = 0; index < insured_count; ++index) {
+			cfg.insured.push_back(make_full_insured(payer_index, index));
+		}
+
+		return cfg;
+	}
+
+	std::filesystem::path temp_path(std::string_view name) {
+		return std::filesystem::temp_directory_path() / fmt::format("quick_dra-bench-{}", name);
+	}
+
+	std::filesystem::path config_file(std::string_view filename) {
+		// reverse of <build>/bin/bench
+		return platform::exec_dir().parent_path().parent_path() / dir_names::config / filename;
+	}
+
+	std::optional<compiled_templates> load_templates() {
+		auto const raw = templates::parse_yaml(config_file("templates.yaml"sv));
+		if (!raw) return std::nullopt;
+		return compiled_templates::compile(*raw);
+	}
+}  // namespace quick_dra::bench
@@ -0,0 +1,25 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <quick_dra/models/types.hpp>
+#include <string_view>
+
+namespace quick_dra::bench {
+	// Synthetic, but valid people: every PESEL, NIP, ID card and passport
+	// number passes the liblex checksums. The same indices give the same
+	// roster on every run and every platform.
+	partial::config make_partial_config(size_t insured_count, size_t payer_index = 0);
+	// the same people, with the tax parameters filled in
+	config make_config(size_t insured_count, size_t payer_index = 0);
+
+	std::filesystem::path temp_path(std::string_view name);
+
+	// the configuration copied next to the command line tool by the build
+	std::filesystem::path config_file(std::string_view filename);
+	std::optional<compiled_templates> load_templates();
+}  // namespace quick_dra::bench
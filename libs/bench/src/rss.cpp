@@ -0,0 +1,69 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <rss.hpp>
+
+#if __has_include(<sys/resource.h>)
+#include <sys/resource.h>
+#define QUICK_DRA_HAS_RUSAGE 1
+#endif
+
+#if defined(QUICK_DRA_HAS_RUSAGE) && __has_include(<unistd.h>) && __has_include(<sys/wait.h>)
+#include <sys/wait.h>
+#include <unistd.h>
+#define QUICK_DRA_HAS_FORK 1
+#endif
+
+namespace quick_dra::bench {
+	size_t peak_rss_kib() noexcept {
+#if defined(QUICK_DRA_HAS_RUSAGE)
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) == 0) {
+			// kilobytes on Linux, bytes on macOS
+#if defined(__APPLE__)
+			return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#else
+			return static_cast<size_t>(usage.ru_maxrss);
+#endif
+		}
+#endif
+		return 0;
+	}
+
+	size_t peak_rss_growth_kib(std::function<void()> const& body) {
+#if defined(QUICK_DRA_HAS_FORK)
+		int fds[2]{};
+		if (pipe(fds) != 0) return 0;
+
+		auto const child = fork();
+		if (child < 0) {
+			close(fds[0]);
+			close(fds[1]);
+			return 0;
+		}
+
+		if (child == 0) {
+			close(fds[0]);
+			// the peak of a fresh child starts at its size at the fork
+			auto const before = peak_rss_kib();
+			body();
+			auto const growth = peak_rss_kib() - before;
+			auto const written = write(fds[1], &growth, sizeof(growth));
+			_exit(written == sizeof(growth) ? 0 : 1);
+		}
+
+		close(fds[1]);
+		size_t growth{};
+		if (read(fds[0], &growth, sizeof(growth)) != sizeof(growth)) growth = 0;
+		close(fds[0]);
+
+		int status{};
+		waitpid(child, &status, 0);
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return 0;
+		return growth;
+#else
+		static_cast<void>(body);
+		return 0;
+#endif
+	}
+}  // namespace quick_dra::bench
@@ -0,0 +1,18 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace quick_dra::bench {
+	// zero, where the platform does not report it
+	size_t peak_rss_kib() noexcept;
+
+	// How far the peak RSS of a forked child rises above its size at the
+	// fork while it runs `body`. ru_maxrss never goes down, so read in the
+	// benchmark process it carries the peak of every benchmark run before.
+	// Zero, where there is no fork().
+	size_t peak_rss_growth_kib(std::function<void()> const& body);
+}  // namespace quick_dra::bench
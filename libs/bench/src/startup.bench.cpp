@@ -0,0 +1,210 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <roster.hpp>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+#endif
+
+namespace quick_dra::bench {
+	namespace {
+		// Exec to exit of one-shot commands, with the lazily initialized
+		// subsystems reported by the command itself.
+		struct command {
+			std::string_view name;
+			std::vector<std::string_view> args;
+			bool changes_config;
+			// fails on an empty config, so it is only run with the roster
+			bool needs_insured{false};
+		};
+
+		static constexpr auto config_arg = "{config}"sv;
+
+		std::vector<command> const& commands() {
+			static std::vector<command> const all{
+			    {"help"sv, {"--help"sv}, false},
+			    {"list"sv, {"list"sv, "--config"sv, config_arg}, false},
+			    {"list --find"sv, {"list"sv, "--config"sv, config_arg, "--find"sv, "Nowak"sv}, false, true},
+			    {"payer"sv,
+			     {"payer"sv, "--config"sv, config_arg, "-y"sv, "--first"sv, "Jan"sv, "--last"sv, "Nowak"sv,
+			      "--social-id"sv, "26211012346"sv, "--tax-id"sv, "7680002466"sv, "--passport"sv, "AB4123456"sv},
+			     true},
+			    {"insured remove"sv, {"insured"sv, "remove"sv, "--config"sv, config_arg, "-y"sv, "--pos"sv, "1"sv},
+			     true, true},
+			};
+			return all;
+		}
+
+		// Ceilings for a CI runner, in milliseconds, for an empty config and
+		// for the 1k roster. A zero means none of the commands above may
+		// initialize the subsystem at all.
+		struct budget {
+			std::string_view subsystem;
+			double empty;
+			double roster;
+		};
+
+		static constexpr auto budgets = std::array{
+		    budget{"total"sv, 60, 300},
+		    budget{"config"sv, 10, 150},
+		    budget{"icu"sv, 10, 10},
+		    budget{"locale"sv, 0, 0},
+		    budget{"curl"sv, 0, 0},
+		    budget{"templates"sv, 0, 0},
+		};
+
+		using costs = std::map<std::string, double, std::less<>>;
+
+		void read_report(std::filesystem::path const& path, costs& totals) {
+			std::ifstream in{path};
+			std::string subsystem{};
+			long long micro{};
+			while (in >> subsystem >> micro) {
+				totals[subsystem] += static_cast<double>(micro) / 1000.0;
+			}
+		}
+
+#ifndef _WIN32
+		// exit code of the command, or -1, if it could not be started
+		int run(std::vector<std::string> const& args, std::vector<std::string> const& env) {
+			std::vector<char*> argv{};
+			argv.reserve(args.size() + 1);
+			for (auto const& arg : args) {
+				argv.push_back(const_cast<char*>(arg.c_str()));
+			}
+			argv.push_back(nullptr);
+
+			// the variables given replace the inherited ones of the same name
+			std::vector<char*> envp{};
+			for (auto item = environ; *item; ++item) {
+				std::string_view const inherited{*item};
+				auto const replaced = std::ranges::any_of(env, [inherited](std::string_view var) {
+					return inherited.starts_with(var.substr(0, var.find('=') + 1));
+				});
+				if (!replaced) envp.push_back(*item);
+			}
+			for (auto const& item : env) {
+				envp.push_back(const_cast<char*>(item.c_str()));
+			}
+			envp.push_back(nullptr);
+
+			posix_spawn_file_actions_t actions{};
+			posix_spawn_file_actions_init(&actions);
+			posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+			posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+
+			pid_t pid{};
+			auto const result = posix_spawn(&pid, argv.front(), &actions, nullptr, argv.data(), envp.data());
+			posix_spawn_file_actions_destroy(&actions);
+			if (result != 0) return -1;
+
+			int status{};
+			if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) return -1;
+			return WEXITSTATUS(status);
+		}
+#endif
+
+		void startup(benchmark::State& state) {
+#ifdef _WIN32
+			state.SkipWithError("start-up benchmark needs posix_spawn");
+#else
+			auto const& cmd = commands()[static_cast<size_t>(state.range(0))];
+			auto const insured_count = static_cast<size_t>(state.range(1));
+			state.SetLabel(fmt::format("{}, {} insured", cmd.name, insured_count));
+
+			auto const pristine = temp_path(fmt::format("startup-{}.yaml", insured_count));
+			auto const config_path = temp_path("startup-config.yaml"sv);
+			auto const report = temp_path("startup-report.txt"sv);
+			auto const cache = temp_path("startup-cache"sv);
+			static constexpr auto overwrite = std::filesystem::copy_options::overwrite_existing;
+			make_partial_config(insured_count).store(pristine);
+			std::filesystem::copy_file(pristine, config_path, overwrite);
+
+			std::vector<std::string> args{QUICK_DRA_CLI};
+			for (auto const arg : cmd.args) {
+				args.emplace_back(arg == config_arg ? config_path.string() : std::string{arg});
+			}
+			std::vector<std::string> const env{
+			    fmt::format("QUICK_DRA_STARTUP_REPORT={}", report.string()),
+			    fmt::format("XDG_CACHE_HOME={}", cache.string()),
+			};
+
+			costs totals{};
+			for (auto _ : state) {
+				state.PauseTiming();
+				if (cmd.changes_config) {
+					std::filesystem::copy_file(pristine, config_path, overwrite);
+				}
+				std::error_code ec{};
+				std::filesystem::remove(report, ec);
+				state.ResumeTiming();
+
+				auto const start = std::chrono::steady_clock::now();
+				auto const exit_code = run(args, env);
+				auto const elapsed = std::chrono::steady_clock::now() - start;
+				if (exit_code != 0) {
+					// a failing command stops early and would look fast
+					state.SkipWithError(exit_code < 0 ? fmt::format("cannot run {}", args.front())
+					                                  : fmt::format("{} exited with {}", cmd.name, exit_code));
+					break;
+				}
+
+				state.PauseTiming();
+				totals["total"] += std::chrono::duration<double, std::milli>(elapsed).count();
+				read_report(report, totals);
+				state.ResumeTiming();
+			}
+
+			if (state.iterations() == 0) return;
+			auto const iterations = static_cast<double>(state.iterations());
+
+			std::string over_budget{};
+			for (auto const& [subsystem, empty, roster] : budgets) {
+				auto const it = totals.find(subsystem);
+				auto const spent = it == totals.end() ? 0.0 : it->second / iterations;
+				auto const limit = insured_count ? roster : empty;
+				state.counters[fmt::format("{}_ms", subsystem)] = spent;
+
+				auto const used = it != totals.end();
+				if (limit <= 0 ? used : spent > limit) {
+					if (!over_budget.empty()) over_budget.append(", "sv);
+					over_budget.append(fmt::format("{} {:.2f} ms (budget {} ms)", subsystem, spent, limit));
+				}
+			}
+
+			if (!over_budget.empty()) state.SkipWithError(fmt::format("over budget: {}", over_budget));
+#endif
+		}
+
+		void startup_args(benchmark::internal::Benchmark* bench) {
+			for (int64_t index = 0; auto const& cmd : commands()) {
+				if (!cmd.needs_insured) bench->Args({index, 0});
+				bench->Args({index, 1'000});
+				++index;
+			}
+		}
+	}  // namespace
+
+	BENCHMARK(startup)
+	    ->Apply(startup_args)
+	    ->Unit(benchmark::kMillisecond)
+	    ->UseRealTime()
+	    ->Iterations(20);
+}  // namespace quick_dra::bench
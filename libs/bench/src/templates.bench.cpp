@@ -0,0 +1,38 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <quick_dra/models/project_reader.hpp>
+#include <roster.hpp>
+
+namespace quick_dra::bench {
+	namespace {
+		void templates_parse_yaml(benchmark::State& state) {
+			auto const path = config_file("templates.yaml"sv);
+
+			for (auto _ : state) {
+				auto raw = templates::parse_yaml(path);
+				if (!raw) {
+					state.SkipWithError("cannot load templates.yaml");
+					break;
+				}
+				benchmark::DoNotOptimize(raw);
+			}
+		}
+
+		void templates_compile(benchmark::State& state) {
+			auto const raw = templates::parse_yaml(config_file("templates.yaml"sv));
+			if (!raw) {
+				state.SkipWithError("cannot load templates.yaml");
+				return;
+			}
+
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(compiled_templates::compile(*raw));
+			}
+		}
+	}  // namespace
+
+	BENCHMARK(templates_parse_yaml)->Unit(benchmark::kMicrosecond);
+	BENCHMARK(templates_compile)->Unit(benchmark::kMicrosecond);
+}  // namespace quick_dra::bench
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <benchmark/benchmark.h>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/text.hpp>
+#include <string>
+
+namespace quick_dra::bench {
+	namespace {
+		constexpr std::string_view names[] = {"Stanisław Żółkiewski"sv, "Anna Wiśniewska"sv, "Jan Iksiński"sv,
+		                                      "Łucja Kamińska"sv, "Piotr Lewandowski"sv};
+
+		std::string make_text(size_t count) {
+			std::string result{};
+			for (size_t index = 0; index < count; ++index) {
+				result.append(names[index % std::size(names)]);
+				result.push_back('\n');
+			}
+			return result;
+		}
+
+		void to_upper_fast(benchmark::State& state) {
+			auto const text = make_text(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(to_upper(text));
+			}
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+			state.SetComplexityN(state.range(0));
+		}
+
+		void to_upper_full(benchmark::State& state) {
+			auto const text = make_text(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(text::to_upper_full(text));
+			}
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+			state.SetComplexityN(state.range(0));
+		}
+
+		void count_code_points(benchmark::State& state) {
+			auto const text = make_text(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(text::count_code_points(text));
+			}
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+			state.SetComplexityN(state.range(0));
+		}
+
+		void is_valid_utf8(benchmark::State& state) {
+			auto const text = make_text(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(text::is_valid_utf8(text));
+			}
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+			state.SetComplexityN(state.range(0));
+		}
+	}  // namespace
+
+	BENCHMARK(to_upper_fast)->RangeMultiplier(10)->Range(1, 10'000)->Unit(benchmark::kMicrosecond)->Complexity();
+	BENCHMARK(to_upper_full)->RangeMultiplier(10)->Range(1, 10'000)->Unit(benchmark::kMicrosecond)->Complexity();
+	BENCHMARK(count_code_points)->RangeMultiplier(10)->Range(1, 10'000)->Unit(benchmark::kMicrosecond)->Complexity();
+	BENCHMARK(is_valid_utf8)->RangeMultiplier(10)->Range(1, 10'000)->Unit(benchmark::kMicrosecond)->Complexity();
+}  // namespace quick_dra::bench
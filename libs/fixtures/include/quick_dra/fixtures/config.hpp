@@ -0,0 +1,45 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <fmt/format.h>
+#include <optional>
+#include <quick_dra/fixtures/parameters.hpp>
+#include <quick_dra/models/types.hpp>
+#include <string>
+
+// needs libmodels, next to the fixtures target
+namespace quick_dra::fixtures {
+	inline tax_parameters parameters() {
+		tax_parameters params{};
+		params.minimal_pay = minimal_pay;
+		params.costs_of_obtaining = costs;
+		params.scale = tax_scale();
+		params.contributions = contributions();
+		return params;
+	}
+
+	// "Jan Nowak-<index>" with an ID card, employed since January 2025;
+	// no salary means the minimal pay
+	inline insured_t insured(size_t index, std::optional<currency> salary = {}, std::optional<ratio> scale = {}) {
+		using namespace std::literals;
+		insured_t result{};
+		result.first_name = "Jan"s;
+		result.last_name = fmt::format("Nowak-{}", index);
+		result.kind = "1"s;
+		result.document = fmt::format("ABC{:06}", index);
+		result.title = insurance_title{.title_code = "0110"s, .pension_right = 0, .disability_level = 0};
+		auto& employment = result.history[2025y / 1];
+		employment.salary = salary;
+		employment.part_time_scale = scale;
+		return result;
+	}
+
+	// the parameters and nobody insured yet
+	inline config empty_config() {
+		config cfg{};
+		cfg.params = parameters();
+		return cfg;
+	}
+}  // namespace quick_dra::fixtures
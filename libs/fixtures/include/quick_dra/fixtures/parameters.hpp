@@ -0,0 +1,25 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <map>
+#include <quick_dra/base/types.hpp>
+
+namespace quick_dra::fixtures {
+	// the 2025 parameters, for the code below libmodels
+	inline constexpr auto minimal_pay = 4666_PLN;
+	inline constexpr costs_of_obtaining costs{.local = 250_PLN, .remote = 300_PLN};
+
+	inline std::map<currency, percent> tax_scale() { return {{30'000_PLN, 12_per}, {120'000_PLN, 32_per}}; }
+
+	inline rates contributions() {
+		return {
+		    .health_insurance = {.payer = {}, .insured = 2.45_per},
+		    .pension_insurance = {.payer = 9.76_per, .insured = 9.76_per},
+		    .disability_insurance = {.payer = 6.5_per, .insured = 1.5_per},
+		    .accident_insurance = {.payer = 1.67_per, .insured = {}},
+		    .health = {.payer = {}, .insured = 9_per},
+		};
+	}
+}  // namespace quick_dra::fixtures
@@ -5,10 +5,14 @@
 #include <QString>
 #include <app/gui/Globals.hpp>
 #include <app/main/MainWindow.hpp>
+#include <quick_dra/base/trace.hpp>
 #include "options.hpp"
 
 namespace quick_dra {
 	int gui_tool(options const& opts) {
+		// the trace covers the whole session, and is written when the window closes
+		trace::session tracing{opts.trace_path};
+
 		gui::Globals globals{};
 		globals.setConfig(opts.cfg_path, opts.tax_config_path);
 
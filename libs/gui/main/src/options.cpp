@@ -67,6 +67,7 @@ namespace quick_dra {
 	options options::parse(args::args_view const& arguments) {
 		std::optional<std::string> config_path;
 		std::optional<std::filesystem::path> tax_config_path;
+		std::optional<std::filesystem::path> trace_path;
 
 		args::null_translator tr{};
 		args::parser parser{"show a GUI for configuration and KEDU generation"s, arguments, &tr};
@@ -80,12 +81,16 @@ namespace quick_dra {
 		    .help(
 		        "provide tax parameters file; will take precedent before data "
 		        "from repository and installation");
+		parser.arg(trace_path, "trace")
+		    .meta("<file>")
+		    .help("write the time spent in each phase as a Chrome/Perfetto trace");
 
 		parser.parse();
 
 		return {
 		    .cfg_path = platform::get_config_path(config_path),
 		    .tax_config_path = std::move(tax_config_path),
+		    .trace_path = std::move(trace_path),
 		};
 	}
 }  // namespace quick_dra
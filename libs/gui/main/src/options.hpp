@@ -20,6 +20,7 @@ namespace quick_dra {
 	struct options {
 		std::filesystem::path cfg_path{};
 		std::optional<std::filesystem::path> tax_config_path;
+		std::optional<std::filesystem::path> trace_path;
 
 		static options parse(args::args_view const& arguments);
 	};
@@ -7,6 +7,7 @@
 #include <QFormLayout>
 #include <QGroupBox>
 #include <QLabel>
+#include <QLineEdit>
 #include <QList>
 #include <QSlider>
 #include <QWidget>
@@ -14,9 +15,11 @@
 #include <app/gui/PagedWidget.hpp>
 #include <app/utils/FormData.hpp>
 #include <quick_dra/docs/forms.hpp>
+#include <span>
 #include <vector>
 
 #undef emit
+#include <quick_dra/conv/search_index.hpp>
 #include <quick_dra/models/types.hpp>
 
 namespace quick_dra::gui {
@@ -37,15 +40,18 @@ namespace quick_dra::gui {
 		void addInsured();
 		void removeInsured();
 		void editInsured(size_t);
+		void findInsured(QString const& keyword);
 
 	private:
 		void setupUI();
 
 		void setPayer(partial::payer_t const&);
-		void setInsured(std::vector<partial::insured_t> const&);
+		void setInsured(std::vector<partial::insured_t> const&, std::span<unsigned const> shown);
 
 		PanelButtonGroup* payerGroup{};
 		PanelButtonGroup* insuredGroup{};
 		PanelButton* removeInsuredButton{};
+		QLineEdit* findEdit{};
+		insured_index searchIndex{};
 	};
 }  // namespace quick_dra::gui
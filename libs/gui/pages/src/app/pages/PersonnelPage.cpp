@@ -21,8 +21,10 @@
 #include <array>
 #include <cassert>
 #include <concepts>
+#include <numeric>
 #include <quick_dra/base/chrono.hpp>
 #include <quick_dra/base/paths.hpp>
+#include <quick_dra/conv/search.hpp>
 #include <quick_dra/io/tax_config.hpp>
 #include <quick_dra/models/project_reader.hpp>
 #include <quick_dra/version.hpp>
@@ -51,6 +53,11 @@ namespace quick_dra::gui {
 		                  [](PanelButtonGroup& group) { group.setSizePolicy(TakeWidth / HeightForWidth); })
 		    .createWidget(editInsuredGroup, "editInsuredGroup",
 		                  [](PanelButtonGroup& group) { group.setSizePolicy(TakeWidth / HeightForWidth); })
+		    .createWidget(findEdit, "findEdit",
+		                  [](QLineEdit& edit) {
+			                  edit.setPlaceholderText(u"Szukaj ubezpieczonego"_s);
+			                  edit.setClearButtonEnabled(true);
+		                  })
 		    .createWidget(insuredGroup, "insuredGroup",
 		                  [](PanelButtonGroup& group) { group.setSizePolicy(TakeWidth / HeightForWidth); });
 
@@ -71,6 +78,7 @@ namespace quick_dra::gui {
 		removeInsuredButton->setClickable(true);
 		removeInsuredButton->setEnabled(false);
 		QObject::connect(removeInsuredButton, &PanelButton::clicked, this, &PersonnelPage::removeInsured);
+		QObject::connect(findEdit, &QLineEdit::textChanged, this, &PersonnelPage::findInsured);
 	}
 
 	void PersonnelPage::connectPage() {
@@ -95,12 +103,13 @@ namespace quick_dra::gui {
 		QObject::connect(button, &PanelButton::clicked, this, &PersonnelPage::editPayer);
 	}
 
-	void PersonnelPage::setInsured(std::vector<partial::insured_t> const& people) {
+	void PersonnelPage::setInsured(std::vector<partial::insured_t> const& people, std::span<unsigned const> shown) {
 		removeInsuredButton->setEnabled(!people.empty());
 		insuredGroup->clearAll();
 
-		size_t index = 0;
-		for (auto const& insured : people) {
+		size_t ordinal = 0;
+		for (size_t const index : shown) {
+			auto const& insured = people[index];
 			auto const name = name_from(insured.first_name, insured.last_name, {.format_for = name_hint::insured});
 			auto const toolTip = std::format("Ubezpieczony nr {}", index + 1);
 			auto const [employed, month, part_time_scale, salary] = insured.lookup(globals().reportId().date);
@@ -109,7 +118,7 @@ namespace quick_dra::gui {
 			                           insurance_title_info(insured.title), salary_info(month, part_time_scale, salary))
 			             : second_line(document_info(insured.kind, insured.document), "*poza okresem zatrudnienia*");
 			static constexpr auto key1 = std::to_underlying(Qt::Key_1);
-			auto const key = static_cast<Qt::Key>(key1 + index);
+			auto const key = static_cast<Qt::Key>(key1 + ordinal);
 			auto const sequences = key <= Qt::Key_9 ? QList<QKeySequence>{Qt::CTRL | key} : QList<QKeySequence>{};
 			auto const button = insuredGroup->createPanel({.label = QString::fromUtf8(name),
 			                                               .details = QString::fromUtf8(info),
@@ -119,7 +128,7 @@ namespace quick_dra::gui {
 			                                              "payerPanel");
 			button->setClickable(true);
 			QObject::connect(button, &PanelButton::clicked, [self = this, index]() { self->editInsured(index); });
-			++index;
+			++ordinal;
 		}
 	}
 
@@ -128,7 +137,26 @@ namespace quick_dra::gui {
 		assert(formData.cfg.payer);
 		assert(formData.cfg.insured);
 		setPayer(formData.cfg.payer.value());
-		setInsured(formData.cfg.insured.value());
+		searchIndex = insured_index::build(formData.cfg.insured.value());
+		searchIndex.enable_fuzzy();
+		findInsured(findEdit->text());
+	}
+
+	void PersonnelPage::findInsured(QString const& keyword) {
+		auto const& people = globals().data().cfg.insured.value();
+		auto const search_keyword = keyword.trimmed().toStdString();
+
+		std::vector<unsigned> shown{};
+		if (search_keyword.empty()) {
+			shown.resize(people.size());
+			std::iota(shown.begin(), shown.end(), 0u);
+		} else {
+			// nothing found is an empty list, not an error
+			shown = search_insured_from_keyword(search_keyword, searchIndex, match_level::none, nullptr,
+			                                    [](std::string const&) {});
+		}
+
+		setInsured(people, shown);
 	}
 
 	void PersonnelPage::editPayer() { stack().push<PayerEditPage>(); }
@@ -23,5 +23,13 @@ void verify_page(PersonnelPage& page) {
 	QVERIFY_NAVIGATION(page.addInsured(), InsuredEditPage, u"<Nieznany ubezpieczony> (Ubezpieczony)");
 	QVERIFY_NAVIGATION(page.removeInsured(), RemoveInsuredPage, u"Wybierz pozycje do usuni\u0119cia");
 
+	auto const everybody = group->count();
+	page.findInsured(QString{u"kowalsky"});
+	QCOMPARE_EQ(group->count(), 1);
+	page.findInsured(QString{u"iksinska"});
+	QCOMPARE_EQ(group->count(), 2);
+	page.findInsured(QString{});
+	QCOMPARE_EQ(group->count(), everybody);
+
 	QVERIFY_SURVIVES_RELOAD();
 }
@@ -9,9 +9,11 @@
 #include <filesystem>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/docs/presentation.hpp>
+#include <quick_dra/io/tax_config.hpp>
 #include <string>
 #include <vector>
 #include "LaidOut.hpp"
@@ -43,9 +45,12 @@ namespace quick_dra::gui {
 		partial::config cfg{};
 		std::filesystem::file_time_type last_access{};
 		std::optional<tax_config> tax_cfg{};
+		resolved_tax_parameters tax_resolved{};
 		tax_parameters tax_params{};
 		compiled_templates templates{};
 		std::vector<form> forms{};
+		// kept across the config reloads, the unchanged insured are not recomputed
+		std::shared_ptr<rca_cache> rca = std::make_shared<rca_cache>();
 		std::vector<FormRef> summary{};
 		std::map<std::string, report_format::formatting> gui_formats{};
 
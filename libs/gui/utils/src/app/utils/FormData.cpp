@@ -14,6 +14,7 @@
 #include <quick_dra/docs/xml_builder.hpp>
 #include <quick_dra/io/tax_config.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace quick_dra::gui {
@@ -92,10 +93,14 @@ namespace quick_dra::gui {
 	void FormData::setConfig(std::filesystem::path const& path,
 	                         std::optional<std::filesystem::path> const& tax_config_path,
 	                         bool download_github_config) {
+		// the download runs while the user config is parsed
+		auto pending =
+		    start_tax_config_download(download_github_config ? github_config::download : github_config::skip);
+
 		cfg_path = path;
 		loadConfig();
-		tax_cfg = load_tax_config(verbose::none, tax_config_path,
-		                          download_github_config ? github_config::download : github_config::skip);
+		tax_cfg = load_tax_config(verbose::none, tax_config_path, std::move(pending));
+		tax_resolved = tax_cfg ? resolved_tax_parameters{*tax_cfg} : resolved_tax_parameters{};
 	}
 
 	void FormData::loadConfig() {
@@ -138,13 +143,14 @@ namespace quick_dra::gui {
 	void FormData::lookupParameters(ReportId const& id) {
 		tax_params = {};
 		if (tax_cfg) {
-			lookup_parameters(tax_params, *tax_cfg, cfg.accident_insurance, id.date);
+			std::optional<tax_parameters> overridden{};
+			tax_params = lookup_parameters(overridden, tax_resolved, cfg.accident_insurance, id.date);
 		}
 		prepareFormData(id);
 	}
 
 	void FormData::prepareFormData(ReportId const& id) {
-		forms = prepare_form_set(verbose::none, id.index, id.date, get_today(), configFrom(cfg, tax_params));
+		forms = prepare_form_set(verbose::none, id.index, id.date, get_today(), configFrom(cfg, tax_params), rca.get());
 		summary.clear();
 
 		size_t count = 0;
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace quick_dra::alloc {
+	// The steps of producing a report. Allocations made outside of any
+	// scope below belong to `other`.
+	enum class phase : unsigned {
+		other,
+		config,
+		calculation,
+		serialization,
+		store,
+		count,
+	};
+
+	struct stats {
+		size_t allocations{};
+		size_t bytes{};
+
+		stats operator-(stats const& rhs) const noexcept {
+			return {.allocations = allocations - rhs.allocations, .bytes = bytes - rhs.bytes};
+		}
+	};
+
+	std::string_view name(phase which) noexcept;
+
+	// Only the executables linking the alloc_hooks object library count
+	// anything: the benchmarks, the tests and, with QUICK_DRA_ALLOC_STATS,
+	// the command line tool. Everywhere else, all the numbers stay at zero.
+	bool counting() noexcept;
+
+	stats total() noexcept;
+	stats of(phase which) noexcept;
+	size_t live_bytes() noexcept;
+	size_t peak_bytes() noexcept;
+
+	// the phase of the calling thread; returns the previous one
+	phase enter(phase which) noexcept;
+
+	class scope {
+	public:
+		explicit scope(phase which) noexcept : previous_{enter(which)} {}
+		~scope() { enter(previous_); }
+		scope(scope const&) = delete;
+		scope& operator=(scope const&) = delete;
+
+	private:
+		phase previous_;
+	};
+
+	// the --stats table, with the averages taken over `forms`
+	void print_report(size_t forms);
+
+	namespace detail {
+		// for the hooks; neither may allocate
+		void allocated(size_t bytes) noexcept;
+		void released(size_t bytes) noexcept;
+	}  // namespace detail
+}  // namespace quick_dra::alloc
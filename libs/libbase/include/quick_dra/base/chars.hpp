@@ -0,0 +1,53 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <array>
+#include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/types.hpp>
+#include <string>
+#include <string_view>
+
+// Formatting of the numbers and dates, in the spirit of std::to_chars:
+// each function writes to the buffer at `out` and returns the new end of the
+// text. Nothing is allocated; chars::buffer is large enough for any of the
+// values together with a short suffix.
+namespace quick_dra::chars {
+	static constexpr size_t max_size = 48;
+	using buffer = std::array<char, max_size>;
+
+	enum class date_order { year_first, year_last };
+
+	char* write(char* out, std::string_view text) noexcept;
+	char* write_unsigned(char* out, unsigned long long value) noexcept;
+	// zero-padded, the way "{:0N}" pads: the minus sign counts to the width
+	char* write_padded(char* out, long long value, unsigned width) noexcept;
+	// the integer part and, for denominators above 1, as many decimal digits
+	// as there are zeros in the (power of ten) denominator
+	char* write_fixed(char* out, long long value, unsigned long long denominator) noexcept;
+
+	inline char* write(char* out, uint_value const& value) noexcept { return write_unsigned(out, value.value); }
+
+	// the same text "{:.2f}" produces for a fixed point value
+	template <typename Tag, intmax_t Den>
+	inline char* write(char* out, fixed_point<Tag, Den> const& value) noexcept {
+		return write_fixed(out, rescale<100, Den>(value.value), 100);
+	}
+
+	// YYYY<sep>MM or MM<sep>YYYY
+	char* write(char* out, year_month const& date, char separator, date_order order = date_order::year_first) noexcept;
+	// YYYY<sep>MM<sep>DD or DD<sep>MM<sep>YYYY
+	char* write(char* out,
+	            year_month_day const& date,
+	            char separator,
+	            date_order order = date_order::year_first) noexcept;
+
+	// for the callers needing the text as a string; short enough for the
+	// small string buffer in most cases
+	template <typename... Args>
+	inline std::string to_string(Args const&... args) {
+		buffer text{};
+		return {text.data(), write(text.data(), args...)};
+	}
+}  // namespace quick_dra::chars
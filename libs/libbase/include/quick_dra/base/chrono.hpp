@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <iterator>
 #include <map>
 #include <string>
 #include <tuple>
@@ -17,31 +18,28 @@ namespace quick_dra {
 	std::string fmt_date(year_month const& ym);
 	std::string fmt_date_slash(year_month const& ym);
 
+	// the last entry not later than the key, end() if there is none
 	template <typename T>
-	inline std::pair<year_month, T> find_in_timeline(year_month const& key, std::map<year_month, T> const& mapping) {
-		std::pair<year_month, T> result = {null_month, T{}};
-
-		for (auto const& [date, value] : mapping) {
-			if (key < date) continue;
-			if (result.first > date) continue;
-			result = {date, value};
-		}
+	inline typename std::map<year_month, T>::const_iterator timeline_at(year_month const& key,
+	                                                                    std::map<year_month, T> const& mapping) {
+		auto it = mapping.upper_bound(key);
+		if (it == mapping.begin()) return mapping.end();
+		return std::prev(it);
+	}  // GCOV_EXCL_LINE[GCC]
 
-		return result;
+	template <typename T>
+	inline std::pair<year_month, T> find_in_timeline(year_month const& key, std::map<year_month, T> const& mapping) {
+		auto const it = timeline_at(key, mapping);
+		if (it == mapping.end()) return {null_month, T{}};
+		return *it;
 	}  // GCOV_EXCL_LINE[GCC]
 
 	template <typename T>
 	inline std::tuple<bool, year_month, T> find_in_timeline_opt(year_month const& key,
 	                                                            std::map<year_month, T> const& mapping) {
-		std::tuple<bool, year_month, T> result = {false, null_month, T{}};
-
-		for (auto const& [date, value] : mapping) {
-			if (key < date) continue;
-			if (std::get<year_month>(result) > date) continue;
-			result = {true, date, value};
-		}
-
-		return result;
+		auto const it = timeline_at(key, mapping);
+		if (it == mapping.end()) return {false, null_month, T{}};
+		return {true, it->first, it->second};
 	}  // GCOV_EXCL_LINE[GCC]
 
 	inline year_month month_today() {
@@ -0,0 +1,169 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <fmt/format.h>
+#include <atomic>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+namespace quick_dra::diag {
+	enum class level : unsigned {
+		debug,
+		info,
+		warning,
+		error,
+	};
+
+	enum class format : unsigned {
+		text,
+		json_lines,
+	};
+
+	// Where a text record is written to; the errors reported in line with
+	// the statuses printed on stdout ask for `out`. JSON lines ignore it.
+	enum class stream : unsigned {
+		by_level,
+		out,
+	};
+
+	// Where a record comes from; an empty form is taken from the innermost
+	// form_scope of the calling thread.
+	struct where {
+		std::string_view form{};
+		std::string_view section{};
+		std::string_view field{};
+	};
+
+	std::string_view name(level severity) noexcept;
+
+	namespace detail {
+		inline std::atomic<unsigned> lowest{static_cast<unsigned>(level::debug)};
+	}  // namespace detail
+
+	// a single relaxed load, so the messages dropped are never formatted
+	inline bool enabled(level severity) noexcept {
+		return static_cast<unsigned>(severity) >= detail::lowest.load(std::memory_order_relaxed);
+	}
+
+	// everything below `lowest` is dropped; both return the previous value
+	level set_level(level lowest) noexcept;
+	format set_format(format output) noexcept;
+
+	// The level and the format of a command, put back as they were when it
+	// is done; the CLI commands also run inside of the GUI and the tests.
+	class output_scope {
+	public:
+		output_scope(level lowest, format output) noexcept
+		    : previous_level_{set_level(lowest)}, previous_format_{set_format(output)} {}
+		~output_scope() {
+			set_format(previous_format_);
+			set_level(previous_level_);
+		}
+		output_scope(output_scope const&) = delete;
+		output_scope& operator=(output_scope const&) = delete;
+
+	private:
+		level previous_level_;
+		format previous_format_;
+	};
+
+	// One record, without the newline. As text, debug and info go to
+	// stdout and warnings and errors to stderr, exactly as given. As JSON
+	// lines, all of them go to stdout, with the "-- " lead and the indent
+	// taken off the message; records with nothing left are skipped.
+	void emit(level severity, where const& at, std::string_view message, stream target = stream::by_level);
+
+	template <typename... Args>
+	void print(level severity, where const& at, fmt::format_string<Args...> fmt, Args&&... args) {
+		if (enabled(severity)) emit(severity, at, fmt::format(fmt, std::forward<Args>(args)...));
+	}
+
+	template <typename... Args>
+	void debug(where const& at, fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::debug, at, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void debug(fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::debug, {}, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void info(fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::info, {}, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void warning(fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::warning, {}, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void error(where const& at, fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::error, at, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void error(fmt::format_string<Args...> fmt, Args&&... args) {
+		print(level::error, {}, fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void error(stream target, fmt::format_string<Args...> fmt, Args&&... args) {
+		if (enabled(level::error)) emit(level::error, {}, fmt::format(fmt, std::forward<Args>(args)...), target);
+	}
+
+	// writes out everything queued so far; call before printing to
+	// stdout past the sink
+	void flush();
+
+	// the form of the records of the calling thread; returns the previous one
+	std::string_view enter(std::string_view form) noexcept;
+
+	class form_scope {
+	public:
+		explicit form_scope(std::string_view form) noexcept : previous_{enter(form)} {}
+		~form_scope() { enter(previous_); }
+		form_scope(form_scope const&) = delete;
+		form_scope& operator=(form_scope const&) = delete;
+
+	private:
+		std::string_view previous_;
+	};
+
+	// While it lives, the records of the calling thread go to the callback,
+	// as text and without the newline, instead of being written. Nests.
+	class capture {
+	public:
+		using callback = std::function<void(level, std::string_view)>;
+
+		explicit capture(callback on_record);
+		~capture();
+		capture(capture const&) = delete;
+		capture& operator=(capture const&) = delete;
+
+		// false, with no capture installed on the calling thread
+		static bool deliver(level severity, std::string_view message);
+
+	private:
+		callback on_record_;
+		capture* prev_;
+	};
+
+	// Outside of it, every record is written by the thread emitting it.
+	// While it lives, debug and info records are only appended to a
+	// buffer, written out in large chunks by a background thread.
+	// Warnings and errors are still written by their callers, after
+	// everything queued before them. Nests; the outermost one drains the
+	// buffer when destroyed.
+	class async_writer {
+	public:
+		async_writer();
+		~async_writer();
+		async_writer(async_writer const&) = delete;
+		async_writer& operator=(async_writer const&) = delete;
+	};
+}  // namespace quick_dra::diag
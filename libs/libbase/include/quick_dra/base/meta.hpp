@@ -4,6 +4,7 @@
 #pragma once
 
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <variant>
 #include <vector>
@@ -43,7 +44,7 @@ namespace quick_dra {
 	}
 
 	template <typename T>
-	using mapped_value = std::map<unsigned, maybe_list<T>>;
+	using mapped_value = std::pmr::map<unsigned, maybe_list<T>>;
 
 	template <typename T, typename... Args>
 	struct expand_args;
@@ -29,6 +29,10 @@ namespace quick_dra::platform {
 
 	std::filesystem::path const& home_path();
 
+	// $XDG_CACHE_HOME/quick_dra, or ~/.cache/quick_dra; %LOCALAPPDATA%\quick_dra\cache on Windows
+	std::filesystem::path const& cache_dir();
+	void cache_dir(std::filesystem::path const&);
+
 	inline std::filesystem::path get_config_path(std::optional<std::string> const& override) {
 		if (override) return *override;
 
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+namespace quick_dra::startup {
+	// Work done once per process, on first use. Each of them is paid for by
+	// the commands that need it, never by the rest.
+	enum class subsystem : unsigned {
+		curl,
+		icu,
+		locale,
+		templates,
+		config,
+		count,
+	};
+
+	using duration = std::chrono::steady_clock::duration;
+
+	std::string_view name(subsystem which) noexcept;
+
+	void record(subsystem which, duration elapsed) noexcept;
+	duration cost(subsystem which) noexcept;
+	bool used(subsystem which) noexcept;
+
+	// adds the time spent in its lifetime to the given subsystem
+	class scope {
+	public:
+		explicit scope(subsystem which) noexcept : which_{which} {}
+		~scope() { record(which_, std::chrono::steady_clock::now() - start_); }
+		scope(scope const&) = delete;
+		scope& operator=(scope const&) = delete;
+
+	private:
+		subsystem which_;
+		std::chrono::steady_clock::time_point start_{std::chrono::steady_clock::now()};
+	};
+
+	// With QUICK_DRA_STARTUP_REPORT naming a file, one "<subsystem> <microseconds>"
+	// line per subsystem used is appended to it when the process exits.
+	void report_from_env();
+}  // namespace quick_dra::startup
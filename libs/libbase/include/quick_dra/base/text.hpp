@@ -0,0 +1,27 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace quick_dra::text {
+	bool is_ascii(std::string_view utf8) noexcept;
+	bool is_valid_utf8(std::string_view utf8) noexcept;
+
+	// Number of code points in valid UTF-8; for invalid input, it is the
+	// number of bytes, which are not continuation bytes.
+	size_t count_code_points(std::string_view utf8) noexcept;
+
+	// Case mapping for ASCII, Latin-1 Supplement and Latin Extended-A,
+	// which covers the Polish names. Returns false, with `out` in unspecified
+	// state, if the text needs anything more than that.
+	bool try_to_upper(std::string_view utf8, std::string& out);
+	bool try_to_lower(std::string_view utf8, std::string& out);
+
+	// Full Unicode case mapping from ICU, or from the system on Windows.
+	std::string to_upper_full(std::string_view utf8);
+	std::string to_lower_full(std::string_view utf8);
+}  // namespace quick_dra::text
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace quick_dra::trace {
+	using clock = std::chrono::steady_clock;
+
+	namespace detail {
+		inline std::atomic<bool> active{false};
+	}  // namespace detail
+
+	// a single relaxed load, when nobody asked for the trace
+	inline bool enabled() noexcept { return detail::active.load(std::memory_order_relaxed); }
+
+	// Collects the spans of all threads until stop(), which writes them to
+	// `path` in Chrome trace event format, readable by chrome://tracing and
+	// by Perfetto. A trace still running at exit is written then.
+	void start(std::filesystem::path const& path);
+	bool stop();
+
+	// a trace for the lifetime of a command, when the user asked for one
+	class session {
+	public:
+		explicit session(std::optional<std::filesystem::path> const& path) : running_{path.has_value()} {
+			if (running_) start(*path);
+		}
+		~session() { finish(); }
+		session(session const&) = delete;
+		session& operator=(session const&) = delete;
+
+		// false, if the trace could not be written
+		bool finish() { return !std::exchange(running_, false) || stop(); }
+
+	private:
+		bool running_;
+	};
+
+	// For work started on one thread and finished on another; the span is
+	// attributed to the calling thread. `name` must outlive the trace, as
+	// string literals do.
+	void record(std::string_view name, std::string detail, clock::time_point begin, clock::time_point end);
+
+	class span {
+	public:
+		explicit span(std::string_view name) noexcept : name_{name} {
+			if (enabled()) begin_ = clock::now();
+		}
+		span(std::string_view name, std::string_view detail) : span{name} {
+			if (recording()) detail_.assign(detail);
+		}
+		~span() {
+			if (recording()) record(name_, std::move(detail_), begin_, clock::now());
+		}
+		span(span const&) = delete;
+		span& operator=(span const&) = delete;
+
+		bool recording() const noexcept { return begin_ != clock::time_point{}; }
+
+		// for details costly to build; check recording() first
+		void detail(std::string value) { detail_ = std::move(value); }
+
+	private:
+		std::string_view name_;
+		std::string detail_{};
+		clock::time_point begin_{};
+	};
+}  // namespace quick_dra::trace
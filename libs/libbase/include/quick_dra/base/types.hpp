@@ -7,9 +7,11 @@
 #include <charconv>
 #include <concepts>
 #include <format>
+#include <limits>
 #include <numeric>
 #include <optional>
 #include <quick_dra/base/chrono.hpp>
+#include <ratio>
 #include <string>
 #include <vector>
 
@@ -36,6 +38,57 @@ namespace quick_dra {
 
 	using uint_value = strong_typedef<class number_tag, unsigned>;
 
+	// Multiplies the value by To / From, rounding half away from zero. Both
+	// denominators are known at compile time, so the division turns into a
+	// multiplication by a constant and there is no floating point involved.
+	template <intmax_t To, intmax_t From>
+	constexpr long long rescale(long long value) noexcept {
+		using factor = std::ratio<To, From>;
+		auto const scaled = value * factor::num;
+		if constexpr (factor::den == 1) {
+			return scaled;
+		} else {
+			// the remainder has the sign of the value
+			auto const quotient = scaled / factor::den;
+			auto const twice_remainder = (scaled % factor::den) * 2;
+			return quotient + static_cast<long long>(twice_remainder >= factor::den) -
+			       static_cast<long long>(twice_remainder <= -factor::den);
+		}
+	}
+
+	namespace details {
+		constexpr bool mul_overflow(long long lhs, long long rhs, long long& product) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_mul_overflow(lhs, rhs, &product);
+#else
+			constexpr auto max = std::numeric_limits<long long>::max();
+			constexpr auto min = std::numeric_limits<long long>::min();
+			auto const overflow = lhs > 0 ? (rhs > 0 ? lhs > max / rhs : rhs < min / lhs)
+			                              : (rhs > 0 ? lhs < min / rhs : lhs != 0 && rhs < max / lhs);
+			if (!overflow) product = lhs * rhs;
+			return overflow;
+#endif
+		}
+	}  // namespace details
+
+	// value * factor / divisor, truncated towards zero like the plain
+	// expression, but without overflowing on the way; saturates when the
+	// result itself does not fit
+	constexpr long long mul_div_truncated(long long value, long long factor, long long divisor) noexcept {
+		long long product{};
+		if (!details::mul_overflow(value, factor, product)) return product / divisor;
+
+		// value = quotient * divisor + remainder, the remainder having the sign
+		// of the value, so both parts truncate in the same direction
+		auto const quotient = value / divisor;
+		auto const remainder = value % divisor;
+		if (details::mul_overflow(quotient, factor, product)) {
+			return (quotient < 0) == (factor < 0) ? std::numeric_limits<long long>::max()
+			                                      : std::numeric_limits<long long>::min();
+		}
+		return product + remainder * factor / divisor;
+	}
+
 	template <typename Tag, intmax_t Den>
 	struct fixed_point {
 		using tag_type = Tag;
@@ -47,17 +100,7 @@ namespace quick_dra {
 
 		template <intmax_t D2 = 100>
 		constexpr fixed_point<Tag, D2> rounded_impl() const noexcept {
-			if constexpr (Den < D2) {
-				return fixed_point<Tag, D2>{value * D2 / Den};
-			} else {
-				auto const value_f = static_cast<long double>(value) / Den;
-				// GCOV_EXCL_START[CLANG]
-				// Tests are checking rounding on both negative and positive
-				// amounts and this line is not visited anyway
-				auto const rescaled = value_f * D2 + (value < 0 ? -0.5l : 0.5l);
-				// GCOV_EXCL_STOP
-				return fixed_point<Tag, D2>{static_cast<long long>(rescaled)};
-			}
+			return fixed_point<Tag, D2>{rescale<D2, Den>(value)};
 		}
 
 		constexpr auto operator<=>(fixed_point const&) const noexcept = default;
@@ -142,7 +185,7 @@ namespace quick_dra {
 	}
 
 	inline constexpr calc_currency operator*(calc_currency const& amount, percent const& percent) noexcept {
-		return calc_currency{amount.value * percent.value / 100'00};
+		return calc_currency{mul_div_truncated(amount.value, percent.value, 100'00)};
 	}
 
 	struct ratio {
@@ -0,0 +1,111 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <quick_dra/base/alloc_stats.hpp>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+// The replaced global operator new and delete. Linked as an object
+// library, as nothing in a static library would pull them in.
+
+namespace {
+	// the size of each block is kept in front of it, so the peak can be followed
+	constexpr size_t header = alignof(std::max_align_t);
+
+	void* counted_alloc(size_t size) noexcept {
+		auto const base = static_cast<unsigned char*>(std::malloc(size + header));
+		if (!base) return nullptr;
+		std::memcpy(base, &size, sizeof(size));
+		quick_dra::alloc::detail::allocated(size);
+		return base + header;
+	}
+
+	void* counted_alloc_or_throw(size_t size) {
+		if (auto const ptr = counted_alloc(size)) return ptr;
+		throw std::bad_alloc{};
+	}
+
+	void counted_free(void* ptr) noexcept {
+		if (!ptr) return;
+		auto const base = static_cast<unsigned char*>(ptr) - header;
+		size_t size{};
+		std::memcpy(&size, base, sizeof(size));
+		quick_dra::alloc::detail::released(size);
+		std::free(base);
+	}
+
+	// std::pmr::new_delete_resource() asks for an alignment even for the
+	// ordinary blocks; the header grows to the alignment, so the block
+	// after it stays aligned
+	size_t header_for(std::align_val_t alignment) noexcept {
+		return std::max(header, static_cast<size_t>(alignment));
+	}
+
+	void* counted_aligned_alloc(size_t size, std::align_val_t alignment) noexcept {
+		auto const align = static_cast<size_t>(alignment);
+		auto const prefix = header_for(alignment);
+		auto const total = (prefix + size + align - 1) / align * align;
+#if defined(_WIN32)
+		auto const base = static_cast<unsigned char*>(_aligned_malloc(total, align));
+#else
+		auto const base = static_cast<unsigned char*>(std::aligned_alloc(align, total));
+#endif
+		if (!base) return nullptr;
+		std::memcpy(base, &size, sizeof(size));
+		quick_dra::alloc::detail::allocated(size);
+		return base + prefix;
+	}
+
+	void* counted_aligned_alloc_or_throw(size_t size, std::align_val_t alignment) {
+		if (auto const ptr = counted_aligned_alloc(size, alignment)) return ptr;
+		throw std::bad_alloc{};
+	}
+
+	void counted_aligned_free(void* ptr, std::align_val_t alignment) noexcept {
+		if (!ptr) return;
+		auto const base = static_cast<unsigned char*>(ptr) - header_for(alignment);
+		size_t size{};
+		std::memcpy(&size, base, sizeof(size));
+		quick_dra::alloc::detail::released(size);
+#if defined(_WIN32)
+		_aligned_free(base);
+#else
+		std::free(base);
+#endif
+	}
+}  // namespace
+
+void* operator new(size_t size) { return counted_alloc_or_throw(size); }
+void* operator new[](size_t size) { return counted_alloc_or_throw(size); }
+void* operator new(size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size); }
+void* operator new[](size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size); }
+void operator delete(void* ptr) noexcept { counted_free(ptr); }
+void operator delete[](void* ptr) noexcept { counted_free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { counted_free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { counted_free(ptr); }
+void operator delete(void* ptr, std::nothrow_t const&) noexcept { counted_free(ptr); }
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept { counted_free(ptr); }
+
+void* operator new(size_t size, std::align_val_t al) { return counted_aligned_alloc_or_throw(size, al); }
+void* operator new[](size_t size, std::align_val_t al) { return counted_aligned_alloc_or_throw(size, al); }
+void* operator new(size_t size, std::align_val_t al, std::nothrow_t const&) noexcept {
+	return counted_aligned_alloc(size, al);
+}
+void* operator new[](size_t size, std::align_val_t al, std::nothrow_t const&) noexcept {
+	return counted_aligned_alloc(size, al);
+}
+void operator delete(void* ptr, std::align_val_t al) noexcept { counted_aligned_free(ptr, al); }
+void operator delete[](void* ptr, std::align_val_t al) noexcept { counted_aligned_free(ptr, al); }
+void operator delete(void* ptr, size_t, std::align_val_t al) noexcept { counted_aligned_free(ptr, al); }
+void operator delete[](void* ptr, size_t, std::align_val_t al) noexcept { counted_aligned_free(ptr, al); }
+void operator delete(void* ptr, std::align_val_t al, std::nothrow_t const&) noexcept { counted_aligned_free(ptr, al); }
+void operator delete[](void* ptr, std::align_val_t al, std::nothrow_t const&) noexcept {
+	counted_aligned_free(ptr, al);
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <array>
+#include <atomic>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <utility>
+
+using namespace std::literals;
+
+namespace quick_dra::alloc {
+	namespace {
+		static constexpr auto count = static_cast<size_t>(phase::count);
+
+		static constexpr std::array<std::string_view, count> names{
+		    "other"sv, "config"sv, "calculation"sv, "serialization"sv, "store"sv,
+		};
+
+		struct counter {
+			std::atomic<size_t> allocations{};
+			std::atomic<size_t> bytes{};
+		};
+
+		// Constant-initialized, as the first allocations come before any
+		// dynamic initialization.
+		constinit std::array<counter, count> counters{};
+		constinit std::atomic<size_t> live{};
+		constinit std::atomic<size_t> peak{};
+		constinit std::atomic<bool> hooked{false};
+		constinit thread_local phase current = phase::other;
+
+		std::string human_bytes(double bytes) {
+			if (bytes < 1024) return fmt::format("{:.0f} B", bytes);
+			bytes /= 1024;
+			if (bytes < 1024) return fmt::format("{:.1f} KiB", bytes);
+			return fmt::format("{:.1f} MiB", bytes / 1024);
+		}
+	}  // namespace
+
+	std::string_view name(phase which) noexcept {
+		auto const index = static_cast<size_t>(which);
+		return index < count ? names[index] : "unknown"sv;
+	}
+
+	bool counting() noexcept { return hooked.load(std::memory_order_relaxed); }
+
+	stats total() noexcept {
+		stats result{};
+		for (auto const& item : counters) {
+			result.allocations += item.allocations.load(std::memory_order_relaxed);
+			result.bytes += item.bytes.load(std::memory_order_relaxed);
+		}
+		return result;
+	}
+
+	stats of(phase which) noexcept {
+		auto const index = static_cast<size_t>(which);
+		if (index >= count) return {};
+		return {.allocations = counters[index].allocations.load(std::memory_order_relaxed),
+		        .bytes = counters[index].bytes.load(std::memory_order_relaxed)};
+	}
+
+	size_t live_bytes() noexcept { return live.load(std::memory_order_relaxed); }
+	size_t peak_bytes() noexcept { return peak.load(std::memory_order_relaxed); }
+
+	phase enter(phase which) noexcept { return std::exchange(current, which); }
+
+	void print_report(size_t forms) {
+		if (!counting()) {
+			fmt::print("-- memory: not counted; configure with QUICK_DRA_ALLOC_STATS=ON\n");
+			return;
+		}
+
+		auto const sum = total();
+		fmt::print("-- memory: {} allocations, {}, peak {}\n", sum.allocations,
+		           human_bytes(static_cast<double>(sum.bytes)), human_bytes(static_cast<double>(peak_bytes())));
+		for (size_t index = 0; index < count; ++index) {
+			auto const item = of(static_cast<phase>(index));
+			fmt::print("   {:<13} {:>10} allocations {:>12}\n", names[index], item.allocations,
+			           human_bytes(static_cast<double>(item.bytes)));
+		}
+
+		if (forms) {
+			auto const forms_count = static_cast<double>(forms);
+			fmt::print("   per form: {:.1f} allocations, {}\n", static_cast<double>(sum.allocations) / forms_count,
+			           human_bytes(static_cast<double>(sum.bytes) / forms_count));
+		}
+	}
+
+	namespace detail {
+		void allocated(size_t bytes) noexcept {
+			auto& item = counters[static_cast<size_t>(current)];
+			item.allocations.fetch_add(1, std::memory_order_relaxed);
+			item.bytes.fetch_add(bytes, std::memory_order_relaxed);
+			if (!hooked.load(std::memory_order_relaxed)) hooked.store(true, std::memory_order_relaxed);
+
+			auto const now = live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+			auto high = peak.load(std::memory_order_relaxed);
+			while (now > high && !peak.compare_exchange_weak(high, now, std::memory_order_relaxed)) {
+			}
+		}
+
+		void released(size_t bytes) noexcept { live.fetch_sub(bytes, std::memory_order_relaxed); }
+	}  // namespace detail
+}  // namespace quick_dra::alloc
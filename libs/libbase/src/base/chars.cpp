@@ -0,0 +1,107 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <algorithm>
+#include <quick_dra/base/chars.hpp>
+
+namespace quick_dra::chars {
+	namespace {
+		// "00" "01" ... "99"
+		static constexpr auto digit_pairs = [] {
+			std::array<char, 200> result{};
+			for (size_t index = 0; index < 100; ++index) {
+				result[index * 2] = static_cast<char>('0' + index / 10);
+				result[index * 2 + 1] = static_cast<char>('0' + index % 10);
+			}
+			return result;
+		}();
+
+		unsigned count_digits(unsigned long long value) noexcept {
+			unsigned result = 1;
+			while (value >= 100) {
+				value /= 100;
+				result += 2;
+			}
+			return value >= 10 ? result + 1 : result;
+		}
+
+		// writes exactly `length` digits, from the back
+		char* write_digits(char* out, unsigned long long value, unsigned length) noexcept {
+			auto const end = out + length;
+			auto ptr = end;
+			while (ptr - out >= 2) {
+				auto const pair = (value % 100) * 2;
+				value /= 100;
+				*--ptr = digit_pairs[pair + 1];
+				*--ptr = digit_pairs[pair];
+			}
+			if (ptr != out) *--ptr = static_cast<char>('0' + value % 10);
+			return end;
+		}
+
+		unsigned long long magnitude(long long value) noexcept {
+			return value < 0 ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+		}
+
+		unsigned zeros_in(unsigned long long denominator) noexcept {
+			unsigned result = 0;
+			while (denominator > 1) {
+				denominator /= 10;
+				++result;
+			}
+			return result;
+		}
+	}  // namespace
+
+	char* write(char* out, std::string_view text) noexcept { return std::copy(text.begin(), text.end(), out); }
+
+	char* write_unsigned(char* out, unsigned long long value) noexcept {
+		return write_digits(out, value, count_digits(value));
+	}
+
+	char* write_padded(char* out, long long value, unsigned width) noexcept {
+		if (value < 0) {
+			*out++ = '-';
+			if (width) --width;
+		}
+		auto const digits = magnitude(value);
+		return write_digits(out, digits, std::max(width, count_digits(digits)));
+	}
+
+	char* write_fixed(char* out, long long value, unsigned long long denominator) noexcept {
+		if (value < 0) *out++ = '-';
+		auto const digits = magnitude(value);
+		out = write_unsigned(out, digits / denominator);
+
+		auto const fraction_digits = zeros_in(denominator);
+		if (!fraction_digits) return out;
+
+		*out++ = '.';
+		return write_digits(out, digits % denominator, fraction_digits);
+	}
+
+	char* write(char* out, year_month const& date, char separator, date_order order) noexcept {
+		auto const year = static_cast<int>(date.year());
+		auto const month = static_cast<unsigned>(date.month());
+		if (order == date_order::year_first) {
+			out = write_padded(out, year, 4);
+			*out++ = separator;
+			return write_padded(out, month, 2);
+		}
+		out = write_padded(out, month, 2);
+		*out++ = separator;
+		return write_padded(out, year, 4);
+	}
+
+	char* write(char* out, year_month_day const& date, char separator, date_order order) noexcept {
+		auto const day = static_cast<unsigned>(date.day());
+		if (order == date_order::year_first) {
+			out = write(out, date.year() / date.month(), separator, order);
+			*out++ = separator;
+			return write_padded(out, day, 2);
+		}
+		out = write_padded(out, day, 2);
+		*out++ = separator;
+		return write(out, date.year() / date.month(), separator, order);
+	}
+}  // namespace quick_dra::chars
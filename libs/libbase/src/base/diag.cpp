@@ -0,0 +1,203 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <quick_dra/base/diag.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include "json_escape.hpp"
+
+using namespace std::literals;
+
+namespace quick_dra::diag {
+	namespace {
+		static constexpr std::array names{"debug"sv, "info"sv, "warning"sv, "error"sv};
+
+		// the background thread wakes up for a full chunk, or after a while
+		static constexpr auto chunk_size = size_t{64} * 1024;
+		static constexpr auto flush_period = 50ms;
+
+		struct sink {
+			// Held by whoever writes to the streams, so neither the chunks nor
+			// the lines written directly ever interleave. Taken before `mtx`.
+			std::mutex io{};
+			std::string spare{};
+
+			std::mutex mtx{};
+			std::condition_variable wake{};
+			std::string pending{};
+			std::thread worker{};
+			unsigned writers{};
+			bool stopping{false};
+		};
+
+		sink& current() {
+			static sink instance{};
+			return instance;
+		}
+
+		constinit std::atomic<format> output{format::text};
+		constinit std::atomic<bool> queued{false};
+		constinit thread_local std::string_view current_form{};
+		constinit thread_local capture* capture_head{nullptr};
+
+		void write(FILE* file, std::string_view text) {
+			if (!text.empty()) std::fwrite(text.data(), 1, text.size(), file);
+		}
+
+		// with `self.io` held
+		void write_pending(sink& self) {
+			{
+				std::lock_guard lock{self.mtx};
+				self.spare.swap(self.pending);
+			}
+			write(stdout, self.spare);
+			self.spare.clear();
+		}
+
+		std::string_view without_lead(std::string_view message) {
+			if (message.starts_with("--"sv)) message.remove_prefix(2);
+			auto const first = message.find_first_not_of(' ');
+			if (first == std::string_view::npos) return {};
+			message.remove_prefix(first);
+			return message.substr(0, message.find_last_not_of(' ') + 1);
+		}
+
+		void append_key(std::string& out, std::string_view key, std::string_view value) {
+			if (value.empty()) return;
+			out.append(",\""sv);
+			out.append(key);
+			out.append("\":\""sv);
+			json::append_escaped(out, value);
+			out.push_back('"');
+		}
+
+		void render(std::string& out, level severity, where const& at, std::string_view message) {
+			if (output.load(std::memory_order_relaxed) == format::text) {
+				out.append(message);
+				out.push_back('\n');
+				return;
+			}
+
+			auto const text = without_lead(message);
+			if (text.empty()) return;
+
+			out.append(R"({"level":")"sv);
+			out.append(name(severity));
+			out.push_back('"');
+			append_key(out, "form"sv, at.form.empty() ? current_form : at.form);
+			append_key(out, "section"sv, at.section);
+			append_key(out, "field"sv, at.field);
+			append_key(out, "message"sv, text);
+			out.append("}\n"sv);
+		}
+
+		void run(sink& self) {
+			std::unique_lock lock{self.mtx};
+			while (true) {
+				self.wake.wait_for(lock, flush_period,
+				                   [&self] { return self.stopping || self.pending.size() >= chunk_size; });
+				if (self.stopping) return;
+				if (self.pending.empty()) continue;
+
+				lock.unlock();
+				{
+					std::lock_guard io{self.io};
+					write_pending(self);
+					std::fflush(stdout);
+				}
+				lock.lock();
+			}
+		}
+	}  // namespace
+
+	std::string_view name(level severity) noexcept {
+		auto const index = static_cast<size_t>(severity);
+		return index < names.size() ? names[index] : "unknown"sv;
+	}
+
+	level set_level(level lowest) noexcept {
+		return static_cast<level>(detail::lowest.exchange(static_cast<unsigned>(lowest), std::memory_order_relaxed));
+	}
+
+	format set_format(format output_format) noexcept {
+		return output.exchange(output_format, std::memory_order_relaxed);
+	}
+
+	void emit(level severity, where const& at, std::string_view message, stream target) {
+		if (!enabled(severity) || capture::deliver(severity, message)) return;
+
+		auto& self = current();
+		auto const urgent = severity >= level::warning;
+		if (!urgent && queued.load(std::memory_order_acquire)) {
+			std::lock_guard lock{self.mtx};
+			if (self.writers) {
+				render(self.pending, severity, at, message);
+				if (self.pending.size() >= chunk_size) self.wake.notify_one();
+				return;
+			}
+		}
+
+		std::string line{};
+		render(line, severity, at, message);
+
+		std::lock_guard io{self.io};
+		write_pending(self);
+		if (urgent && target == stream::by_level && output.load(std::memory_order_relaxed) == format::text) {
+			std::fflush(stdout);
+			write(stderr, line);
+		} else {
+			write(stdout, line);
+		}
+	}
+
+	void flush() {
+		auto& self = current();
+		std::lock_guard io{self.io};
+		write_pending(self);
+		std::fflush(stdout);
+	}
+
+	std::string_view enter(std::string_view form) noexcept { return std::exchange(current_form, form); }
+
+	capture::capture(callback on_record) : on_record_{std::move(on_record)}, prev_{capture_head} {
+		capture_head = this;
+	}
+
+	capture::~capture() { capture_head = prev_; }
+
+	bool capture::deliver(level severity, std::string_view message) {
+		if (!capture_head) return false;
+		capture_head->on_record_(severity, message);
+		return true;
+	}
+
+	async_writer::async_writer() {
+		auto& self = current();
+		std::lock_guard lock{self.mtx};
+		if (self.writers++) return;
+		self.stopping = false;
+		self.worker = std::thread{run, std::ref(self)};
+		queued.store(true, std::memory_order_release);
+	}
+
+	async_writer::~async_writer() {
+		auto& self = current();
+		{
+			std::lock_guard lock{self.mtx};
+			if (--self.writers) return;
+			queued.store(false, std::memory_order_release);
+			self.stopping = true;
+		}
+		self.wake.notify_one();
+		self.worker.join();
+		flush();
+	}
+}  // namespace quick_dra::diag
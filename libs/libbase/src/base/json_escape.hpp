@@ -0,0 +1,38 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <fmt/format.h>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace quick_dra::json {
+	// the inside of a JSON string, for the trace and the diagnostic sink
+	inline void append_escaped(std::string& out, std::string_view text) {
+		using namespace std::literals;
+		for (auto const ch : text) {
+			switch (ch) {
+				case '"':
+					out.append("\\\""sv);
+					break;
+				case '\\':
+					out.append("\\\\"sv);
+					break;
+				case '\n':
+					out.append("\\n"sv);
+					break;
+				case '\t':
+					out.append("\\t"sv);
+					break;
+				default:
+					if (static_cast<unsigned char>(ch) < 0x20) {
+						fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(ch));
+					} else {
+						out.push_back(ch);
+					}
+			}
+		}
+	}
+}  // namespace quick_dra::json
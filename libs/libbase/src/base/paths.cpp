@@ -32,6 +32,26 @@ namespace quick_dra::platform {
 
 			return result;
 		}
+
+		std::filesystem::path _default_cache_dir() {
+#ifdef _WIN32
+			auto const* const LOCALAPPDATA = std::getenv("LOCALAPPDATA");
+			if (LOCALAPPDATA && *LOCALAPPDATA) {
+				return std::filesystem::path{LOCALAPPDATA} / "quick_dra"sv / "cache"sv;
+			}
+#else
+			auto const* const XDG_CACHE_HOME = std::getenv("XDG_CACHE_HOME");
+			if (XDG_CACHE_HOME && *XDG_CACHE_HOME) {
+				return std::filesystem::path{XDG_CACHE_HOME} / "quick_dra"sv;
+			}
+#endif
+			return home_path() / ".cache"sv / "quick_dra"sv;
+		}
+
+		std::filesystem::path& _cache_dir() {
+			static auto path = _default_cache_dir();
+			return path;
+		}
 	}  // namespace
 
 	std::filesystem::path const& config_data_dir() { return _config_data_dir(); }
@@ -41,4 +61,7 @@ namespace quick_dra::platform {
 		static auto const path = _home_path();
 		return path;
 	}
+
+	std::filesystem::path const& cache_dir() { return _cache_dir(); }
+	void cache_dir(std::filesystem::path const& new_value) { _cache_dir() = new_value; }
 }  // namespace quick_dra::platform
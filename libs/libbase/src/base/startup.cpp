@@ -0,0 +1,78 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <quick_dra/base/startup.hpp>
+
+using namespace std::literals;
+
+namespace quick_dra::startup {
+	namespace {
+		static constexpr auto count = static_cast<size_t>(subsystem::count);
+
+		static constexpr std::array<std::string_view, count> names{
+		    "curl"sv, "icu"sv, "locale"sv, "templates"sv, "config"sv,
+		};
+
+		struct counter {
+			std::atomic<duration::rep> ticks{};
+			std::atomic<bool> used{};
+		};
+
+		std::array<counter, count>& counters() noexcept {
+			static std::array<counter, count> all{};
+			return all;
+		}
+
+		counter& counter_for(subsystem which) noexcept { return counters()[static_cast<size_t>(which)]; }
+
+		void write_report() {
+			auto const* const path = std::getenv("QUICK_DRA_STARTUP_REPORT");
+			if (!path || !*path) return;
+
+			auto* file = std::fopen(path, "a");
+			if (!file) return;
+
+			for (size_t index = 0; index < count; ++index) {
+				auto const which = static_cast<subsystem>(index);
+				if (!used(which)) continue;
+				auto const micro = std::chrono::duration_cast<std::chrono::microseconds>(cost(which));
+				std::fprintf(file, "%.*s %lld\n", static_cast<int>(names[index].size()), names[index].data(),
+				             static_cast<long long>(micro.count()));
+			}
+
+			std::fclose(file);
+		}
+	}  // namespace
+
+	std::string_view name(subsystem which) noexcept {
+		auto const index = static_cast<size_t>(which);
+		return index < count ? names[index] : "unknown"sv;
+	}
+
+	void record(subsystem which, duration elapsed) noexcept {
+		auto& item = counter_for(which);
+		item.ticks.fetch_add(elapsed.count(), std::memory_order_relaxed);
+		item.used.store(true, std::memory_order_relaxed);
+	}
+
+	duration cost(subsystem which) noexcept {
+		return duration{counter_for(which).ticks.load(std::memory_order_relaxed)};
+	}
+
+	bool used(subsystem which) noexcept { return counter_for(which).used.load(std::memory_order_relaxed); }
+
+	void report_from_env() {
+		[[maybe_unused]] static bool const registered = [] {
+			auto const* const path = std::getenv("QUICK_DRA_STARTUP_REPORT");
+			if (!path || !*path) return false;
+
+			// the counters outlive the handler; commands may leave through exit()
+			counters();
+			return std::atexit(write_report) == 0;
+		}();
+	}
+}  // namespace quick_dra::startup
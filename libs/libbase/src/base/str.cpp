@@ -24,6 +24,20 @@ namespace quick_dra {
 		};
 	}  // namespace
 
+	size_t calc_separators(sep_view_t sep, std::string_view data, size_t max) {
+		auto pos = data.find(sep.value);
+		size_t result = 1;
+
+		while (max && pos != std::string_view::npos) {
+			pos = data.find(sep.value, pos + sep.size());
+			if (max != std::string::npos) --max;
+
+			++result;
+		}
+
+		return result;
+	}
+
 	template <typename String>
 	std::vector<String> split_impl(std::string_view data, sep_view_t sep, size_t max) {
 		std::vector<String> result{};
@@ -52,6 +66,8 @@ namespace quick_dra {
 			return result;
 		}
 
+		result.reserve(calc_separators(sep, data, max));
+
 		auto pos = data.find(sep.value);
 		decltype(pos) prev = 0;
 
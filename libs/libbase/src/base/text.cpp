@@ -0,0 +1,196 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <bit>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/text.hpp>
+#include <string>
+#include "case_tables.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+// SSE2 is the baseline of every x86-64 CPU, no run-time dispatch needed
+#define QUICK_DRA_TEXT_SSE2 1
+#include <emmintrin.h>
+#else
+#define QUICK_DRA_TEXT_SSE2 0
+#endif
+
+namespace quick_dra::text {
+	namespace {
+		static constexpr size_t kBlock = 16;
+
+		unsigned char byte_at(std::string_view utf8, size_t index) noexcept {
+			return static_cast<unsigned char>(utf8[index]);
+		}
+
+#if QUICK_DRA_TEXT_SSE2
+		__m128i load_block(std::string_view utf8, size_t index) noexcept {
+			return _mm_loadu_si128(reinterpret_cast<__m128i const*>(utf8.data() + index));
+		}
+#endif
+
+		size_t ascii_prefix(std::string_view utf8, size_t index) noexcept {
+			auto const size = utf8.size();
+#if QUICK_DRA_TEXT_SSE2
+			for (; index + kBlock <= size; index += kBlock) {
+				if (_mm_movemask_epi8(load_block(utf8, index))) break;
+			}
+#endif
+			while (index < size && byte_at(utf8, index) < 0x80) {
+				++index;
+			}
+			return index;
+		}
+
+		// length of a valid, shortest-form sequence at `index`, 0 otherwise
+		size_t sequence_length(std::string_view utf8, size_t index) noexcept {
+			auto const lead = byte_at(utf8, index);
+			size_t length = 0;
+			if (lead < 0x80) return 1;
+			if (lead < 0xC2) return 0;  // a continuation, or an overlong C0/C1
+			if (lead < 0xE0) {
+				length = 2;
+			} else if (lead < 0xF0) {
+				length = 3;
+			} else if (lead < 0xF5) {
+				length = 4;
+			} else {
+				return 0;
+			}
+
+			if (index + length > utf8.size()) return 0;
+
+			char32_t code_point = lead & (0x7Fu >> length);
+			for (size_t offset = 1; offset < length; ++offset) {
+				auto const next = byte_at(utf8, index + offset);
+				if ((next & 0xC0) != 0x80) return 0;
+				code_point = (code_point << 6) | (next & 0x3Fu);
+			}
+
+			if (length == 3 && code_point < 0x800) return 0;
+			if (length == 4 && (code_point < 0x10000 || code_point > 0x10FFFF)) return 0;
+			if (code_point >= 0xD800 && code_point <= 0xDFFF) return 0;
+			return length;
+		}
+
+		void append_utf8(std::string& out, char32_t code_point) {
+			if (code_point < 0x80) {
+				out.push_back(static_cast<char>(code_point));
+			} else if (code_point < 0x800) {
+				out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+				out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+			} else {
+				out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+				out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+			}
+		}
+
+		template <char First, char Last>
+		bool try_one_case(std::string_view utf8, std::string& out, char16_t const* table) {
+			out.clear();
+			out.reserve(utf8.size());
+
+			auto const size = utf8.size();
+			size_t index = 0;
+#if QUICK_DRA_TEXT_SSE2
+			auto const below = _mm_set1_epi8(First - 1);
+			auto const above = _mm_set1_epi8(Last + 1);
+			auto const flip = _mm_set1_epi8(0x20);
+#endif
+
+			while (index < size) {
+#if QUICK_DRA_TEXT_SSE2
+				// ASCII blocks flip the case bit of the letters in range
+				for (; index + kBlock <= size; index += kBlock) {
+					auto const chars = load_block(utf8, index);
+					if (_mm_movemask_epi8(chars)) break;
+
+					auto const letters = _mm_and_si128(_mm_cmpgt_epi8(chars, below), _mm_cmplt_epi8(chars, above));
+					alignas(kBlock) char block[kBlock];
+					_mm_store_si128(reinterpret_cast<__m128i*>(block), _mm_xor_si128(chars, _mm_and_si128(letters, flip)));
+					out.append(block, kBlock);
+				}
+				if (index == size) break;
+#endif
+
+				auto const ch = byte_at(utf8, index);
+				if (ch < 0x80) {
+					auto const is_letter = ch >= First && ch <= Last;
+					out.push_back(static_cast<char>(is_letter ? ch ^ 0x20 : ch));
+					++index;
+					continue;
+				}
+
+				// both tables cover the two-byte sequences from C2 80 to C5 BF
+				if (ch < 0xC2 || ch > 0xC5 || index + 1 == size) return false;
+				auto const next = byte_at(utf8, index + 1);
+				if ((next & 0xC0) != 0x80) return false;
+
+				auto const code_point = static_cast<char32_t>(((ch & 0x1Fu) << 6) | (next & 0x3Fu));
+				auto const mapped = table[code_point - tables::first];
+				if (!mapped) return false;
+
+				append_utf8(out, mapped);
+				index += 2;
+			}
+
+			return true;
+		}
+	}  // namespace
+
+	bool is_ascii(std::string_view utf8) noexcept { return ascii_prefix(utf8, 0) == utf8.size(); }
+
+	bool is_valid_utf8(std::string_view utf8) noexcept {
+		auto const size = utf8.size();
+		size_t index = 0;
+		while (true) {
+			index = ascii_prefix(utf8, index);
+			if (index == size) return true;
+
+			auto const length = sequence_length(utf8, index);
+			if (!length) return false;
+			index += length;
+		}
+	}
+
+	size_t count_code_points(std::string_view utf8) noexcept {
+		auto const size = utf8.size();
+		size_t count = 0;
+		size_t index = 0;
+#if QUICK_DRA_TEXT_SSE2
+		// continuation bytes, 80 to BF, are the only ones below C0 as signed
+		auto const lead_min = _mm_set1_epi8(static_cast<char>(0xC0));
+		for (; index + kBlock <= size; index += kBlock) {
+			auto const continuation = _mm_cmplt_epi8(load_block(utf8, index), lead_min);
+			count += kBlock - static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(continuation))));
+		}
+#endif
+		for (; index < size; ++index) {
+			count += static_cast<size_t>((byte_at(utf8, index) & 0xC0) != 0x80);
+		}
+		return count;
+	}
+
+	bool try_to_upper(std::string_view utf8, std::string& out) {
+		return try_one_case<'a', 'z'>(utf8, out, tables::upper);
+	}
+
+	bool try_to_lower(std::string_view utf8, std::string& out) {
+		return try_one_case<'A', 'Z'>(utf8, out, tables::lower);
+	}
+}  // namespace quick_dra::text
+
+namespace quick_dra {
+	std::string to_upper(std::string_view input) {
+		std::string result{};
+		if (text::try_to_upper(input, result)) return result;
+		return text::to_upper_full(input);
+	}
+
+	std::string to_lower(std::string_view input) {
+		std::string result{};
+		if (text::try_to_lower(input, result)) return result;
+		return text::to_lower_full(input);
+	}
+}  // namespace quick_dra
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <quick_dra/base/trace.hpp>
+#include <string>
+#include <vector>
+#include "json_escape.hpp"
+
+using namespace std::literals;
+
+namespace quick_dra::trace {
+	namespace {
+		struct event {
+			std::string_view name;
+			std::string detail;
+			clock::time_point begin;
+			clock::time_point end;
+		};
+
+		// Each thread appends to its own buffer, so the lock is only ever
+		// contended by stop(). Buffers outlive their threads.
+		struct thread_buffer {
+			unsigned tid{};
+			std::mutex mtx{};
+			std::vector<event> events{};
+		};
+
+		struct session {
+			std::mutex mtx{};
+			std::filesystem::path path{};
+			clock::time_point origin{};
+			std::vector<std::unique_ptr<thread_buffer>> threads{};
+			bool exit_handler{false};
+		};
+
+		session& current() {
+			static session instance{};
+			return instance;
+		}
+
+		thread_buffer& this_thread_buffer() {
+			thread_local thread_buffer* buffer = nullptr;
+			if (!buffer) {
+				auto& self = current();
+				std::lock_guard lock{self.mtx};
+				auto& added = self.threads.emplace_back(std::make_unique<thread_buffer>());
+				added->tid = static_cast<unsigned>(self.threads.size());
+				buffer = added.get();
+			}
+			return *buffer;
+		}
+
+		double micro_since(clock::time_point origin, clock::time_point when) {
+			return std::chrono::duration<double, std::micro>(when - origin).count();
+		}
+
+		void stop_at_exit() { stop(); }
+	}  // namespace
+
+	void start(std::filesystem::path const& path) {
+		auto& self = current();
+		{
+			std::lock_guard lock{self.mtx};
+			self.path = path;
+			self.origin = clock::now();
+			if (!self.exit_handler) self.exit_handler = std::atexit(stop_at_exit) == 0;
+		}
+
+		// the starting thread is the first one in the viewer
+		this_thread_buffer();
+		detail::active.store(true, std::memory_order_relaxed);
+	}
+
+	bool stop() {
+		if (!detail::active.exchange(false)) return true;
+
+		auto& self = current();
+		std::lock_guard lock{self.mtx};
+
+		std::string out{};
+		out.append(R"({"displayTimeUnit":"ms","traceEvents":[)"sv);
+		fmt::format_to(std::back_inserter(out),
+		               R"({{"name":"process_name","ph":"M","pid":1,"tid":0,"args":{{"name":"Quick-DRA"}}}})");
+
+		for (auto const& thread : self.threads) {
+			std::vector<event> events{};
+			{
+				std::lock_guard buffer_lock{thread->mtx};
+				events.swap(thread->events);
+			}
+
+			fmt::format_to(std::back_inserter(out),
+			               R"(,{{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+			               thread->tid, thread->tid == 1 ? "main"s : fmt::format("thread {}", thread->tid));
+
+			for (auto const& item : events) {
+				out.append(R"(,{"name":")"sv);
+				json::append_escaped(out, item.name);
+				fmt::format_to(std::back_inserter(out), R"(","cat":"quick_dra","ph":"X","ts":{:.3f},"dur":{:.3f},)",
+				               micro_since(self.origin, item.begin), micro_since(item.begin, item.end));
+				fmt::format_to(std::back_inserter(out), R"("pid":1,"tid":{})", thread->tid);
+				if (!item.detail.empty()) {
+					out.append(R"(,"args":{"detail":")"sv);
+					json::append_escaped(out, item.detail);
+					out.append(R"("})"sv);
+				}
+				out.push_back('}');
+			}
+		}
+		out.append("]}\n"sv);
+
+		std::ofstream file{self.path, std::ios::binary};
+		file.write(out.data(), static_cast<std::streamsize>(out.size()));
+		return static_cast<bool>(file);
+	}
+
+	void record(std::string_view name, std::string detail, clock::time_point begin, clock::time_point end) {
+		if (!enabled()) return;
+		auto& buffer = this_thread_buffer();
+		std::lock_guard lock{buffer.mtx};
+		buffer.events.push_back({.name = name, .detail = std::move(detail), .begin = begin, .end = end});
+	}
+}  // namespace quick_dra::trace
@@ -2,21 +2,38 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 // #define U_DISABLE_RENAMING 1
+#include <unicode/uclean.h>
 #include <unicode/unistr.h>
 
-#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/startup.hpp>
+#include <quick_dra/base/text.hpp>
 #include <string>
 
-namespace quick_dra {
-	std::string to_upper(std::string_view input) {
+namespace quick_dra::text {
+	namespace {
+		// only the text outside of the try_to_* tables gets here, and only
+		// then the ICU data is mapped in
+		void ensure_icu() {
+			[[maybe_unused]] static bool const ready = [] {
+				startup::scope timing{startup::subsystem::icu};
+				UErrorCode status = U_ZERO_ERROR;
+				u_init(&status);
+				return U_SUCCESS(status);
+			}();
+		}
+	}  // namespace
+
+	std::string to_upper_full(std::string_view input) {
+		ensure_icu();
 		std::string result{};
 		icu::UnicodeString::fromUTF8(input).toUpper().toUTF8String(result);
 		return result;
 	}  // GCOV_EXCL_LINE
 
-	std::string to_lower(std::string_view input) {
+	std::string to_lower_full(std::string_view input) {
+		ensure_icu();
 		std::string result{};
 		icu::UnicodeString::fromUTF8(input).toLower().toUTF8String(result);
 		return result;
 	}  // GCOV_EXCL_LINE
-}  // namespace quick_dra
+}  // namespace quick_dra::text
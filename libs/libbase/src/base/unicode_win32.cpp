@@ -3,11 +3,11 @@
 
 #define WINDOW
 #include <Windows.h>
-#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/text.hpp>
 #include <span>
 #include <string>
 
-namespace quick_dra {
+namespace quick_dra::text {
 	namespace {
 		auto conv_one_way(std::span<char const> src, wchar_t* dst, DWORD size) {
 			return MultiByteToWideChar(CP_UTF8, 0, src.data(), static_cast<DWORD>(src.size()), dst, size);
@@ -58,7 +58,7 @@ namespace quick_dra {
 		}
 	}  // namespace
 
-	std::string to_upper(std::string_view input) { return to_one_case(input, true); }
+	std::string to_upper_full(std::string_view input) { return to_one_case(input, true); }
 
-	std::string to_lower(std::string_view input) { return to_one_case(input, false); }
-}  // namespace quick_dra
+	std::string to_lower_full(std::string_view input) { return to_one_case(input, false); }
+}  // namespace quick_dra::text
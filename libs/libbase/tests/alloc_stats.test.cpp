@@ -0,0 +1,84 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/str.hpp>
+#include <string>
+#include <vector>
+
+namespace quick_dra::testing {
+	using namespace std::literals;
+
+	TEST(alloc_stats, names) {
+		EXPECT_EQ("other"sv, alloc::name(alloc::phase::other));
+		EXPECT_EQ("config"sv, alloc::name(alloc::phase::config));
+		EXPECT_EQ("calculation"sv, alloc::name(alloc::phase::calculation));
+		EXPECT_EQ("serialization"sv, alloc::name(alloc::phase::serialization));
+		EXPECT_EQ("store"sv, alloc::name(alloc::phase::store));
+		EXPECT_EQ("unknown"sv, alloc::name(alloc::phase::count));
+	}
+
+	TEST(alloc_stats, scopes_nest) {
+		if (!alloc::counting()) GTEST_SKIP() << "built without the counting operator new";
+
+		auto const store = alloc::of(alloc::phase::store);
+		auto const config = alloc::of(alloc::phase::config);
+		{
+			alloc::scope outer{alloc::phase::store};
+			auto const first = std::make_unique<int>();
+			{
+				alloc::scope inner{alloc::phase::config};
+				auto const second = std::make_unique<long long>();
+			}
+			auto const third = std::make_unique<int>();
+		}
+
+		auto const stored = alloc::of(alloc::phase::store) - store;
+		EXPECT_EQ(2u, stored.allocations);
+		EXPECT_EQ(2 * sizeof(int), stored.bytes);
+
+		auto const configured = alloc::of(alloc::phase::config) - config;
+		EXPECT_EQ(1u, configured.allocations);
+		EXPECT_EQ(sizeof(long long), configured.bytes);
+	}
+
+	TEST(alloc_stats, peak_follows_live_bytes) {
+		if (!alloc::counting()) GTEST_SKIP() << "built without the counting operator new";
+
+		static constexpr size_t size = 1024 * 1024;
+		auto const before = alloc::live_bytes();
+		{
+			auto const block = std::make_unique<char[]>(size);
+			EXPECT_GE(alloc::live_bytes(), before + size);
+			EXPECT_GE(alloc::peak_bytes(), before + size);
+		}
+		EXPECT_EQ(before, alloc::live_bytes());
+	}
+
+	// budgets of the hot paths
+	TEST(alloc_stats, split_reserves_once) {
+		if (!alloc::counting()) GTEST_SKIP() << "built without the counting operator new";
+
+		auto before = alloc::total();
+		auto const by_char = split_sv("ZUS,RCA,DRA,KEDU"sv, ','_sep);
+		auto const by_char_cost = alloc::total() - before;
+
+		before = alloc::total();
+		auto const by_view = split_sv("ZUS, RCA, DRA, KEDU"sv, ", "_sep);
+		auto const by_view_cost = alloc::total() - before;
+
+		// short strings stay inside their objects
+		before = alloc::total();
+		auto const strings = split_s("ZUS, RCA, DRA, KEDU"sv, ", "_sep);
+		auto const strings_cost = alloc::total() - before;
+
+		EXPECT_EQ(4u, by_char.size());
+		EXPECT_EQ(1u, by_char_cost.allocations);
+		EXPECT_EQ(4u, by_view.size());
+		EXPECT_EQ(1u, by_view_cost.allocations);
+		EXPECT_EQ(4u, strings.size());
+		EXPECT_EQ(1u, strings_cost.allocations);
+	}
+}  // namespace quick_dra::testing
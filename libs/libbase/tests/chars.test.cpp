@@ -0,0 +1,63 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <quick_dra/base/chars.hpp>
+#include <string>
+
+namespace quick_dra::testing {
+	namespace {
+		template <typename... Args>
+		std::string written(Args const&... args) {
+			chars::buffer buffer{};
+			return {buffer.data(), chars::write(buffer.data(), args...)};
+		}
+	}  // namespace
+
+	TEST(chars, same_as_fmt) {
+		for (long long value = -100'000; value <= 100'000; value += 7) {
+			ASSERT_EQ(written(currency{value}), fmt::format("{:.2f}", currency{value})) << value;
+			ASSERT_EQ(written(percent{value}), fmt::format("{:.2f}", percent{value})) << value;
+			auto const precise = calc_currency::base{value * 13};
+			ASSERT_EQ(written(precise), fmt::format("{:.2f}", precise)) << value;
+		}
+
+		for (auto const value : {0u, 1u, 9u, 10u, 99u, 100u, 12345u, std::numeric_limits<unsigned>::max()}) {
+			ASSERT_EQ(written(uint_value{value}), fmt::format("{}", uint_value{value}));
+		}
+
+		for (auto const value : {-12345ll, -5ll, 0ll, 7ll, 42ll, 2026ll, 123456ll}) {
+			chars::buffer buffer{};
+			for (auto const width : {0u, 2u, 4u}) {
+				auto const actual = std::string{buffer.data(), chars::write_padded(buffer.data(), value, width)};
+				ASSERT_EQ(actual, fmt::format("{:0{}}", value, width)) << value << " @" << width;
+			}
+		}
+	}
+
+	TEST(chars, fixed) {
+		chars::buffer buffer{};
+		auto const fixed = [&buffer](long long value, unsigned long long denominator) {
+			return std::string{buffer.data(), chars::write_fixed(buffer.data(), value, denominator)};
+		};
+
+		EXPECT_EQ(fixed(0, 1), "0"s);
+		EXPECT_EQ(fixed(-1234, 1), "-1234"s);
+		EXPECT_EQ(fixed(-5, 100), "-0.05"s);
+		EXPECT_EQ(fixed(1234567, 1000), "1234.567"s);
+		EXPECT_EQ(fixed(std::numeric_limits<long long>::min(), 100), "-92233720368547758.08"s);
+	}
+
+	TEST(chars, dates) {
+		using enum chars::date_order;
+
+		EXPECT_EQ(written(2026y / 2, '-'), "2026-02"s);
+		EXPECT_EQ(written(2026y / 2, '/', year_last), "02/2026"s);
+		EXPECT_EQ(written(1985y / 15, '/'), "1985/15"s);
+		EXPECT_EQ(written(2026y / 2 / 5, '-'), "2026-02-05"s);
+		EXPECT_EQ(written(2026y / 2 / 5, '-', year_last), "05-02-2026"s);
+		EXPECT_EQ(written(33y / 12 / 31, '/'), "0033/12/31"s);
+	}
+}  // namespace quick_dra::testing
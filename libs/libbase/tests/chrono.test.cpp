@@ -4,6 +4,10 @@
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <quick_dra/base/chrono.hpp>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <utility>
 
 namespace quick_dra::testing {
 	struct testcase {
@@ -33,4 +37,20 @@ namespace quick_dra::testing {
 	};
 
 	INSTANTIATE_TEST_SUITE_P(test, fmt_date, ::testing::ValuesIn(tests));
+
+	TEST(timeline, find_in_timeline) {
+		std::map<year_month, int> const timeline{{2024y / 1, 1}, {2024y / 7, 2}, {2025y / 1, 3}};
+
+		EXPECT_EQ(find_in_timeline(2023y / 12, timeline), (std::pair{null_month, 0}));
+		EXPECT_EQ(find_in_timeline(2024y / 1, timeline), (std::pair{2024y / 1, 1}));
+		EXPECT_EQ(find_in_timeline(2024y / 6, timeline), (std::pair{2024y / 1, 1}));
+		EXPECT_EQ(find_in_timeline(2024y / 7, timeline), (std::pair{2024y / 7, 2}));
+		EXPECT_EQ(find_in_timeline(2030y / 1, timeline), (std::pair{2025y / 1, 3}));
+		EXPECT_EQ(find_in_timeline(2024y / 1, std::map<year_month, int>{}), (std::pair{null_month, 0}));
+
+		EXPECT_EQ(find_in_timeline_opt(2023y / 12, timeline), (std::tuple{false, null_month, 0}));
+		EXPECT_EQ(find_in_timeline_opt(2024y / 8, timeline), (std::tuple{true, 2024y / 7, 2}));
+		EXPECT_EQ(timeline_at(2023y / 12, timeline), timeline.end());
+		EXPECT_EQ(timeline_at(2025y / 2, timeline), std::prev(timeline.end()));
+	}
 }  // namespace quick_dra::testing
@@ -0,0 +1,169 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <quick_dra/base/diag.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace quick_dra::testing {
+	using namespace std::literals;
+
+	struct json_lines {
+		json_lines() { diag::set_format(diag::format::json_lines); }
+		~json_lines() { diag::set_format(diag::format::text); }
+	};
+
+	TEST(diag, names) {
+		EXPECT_EQ("debug"sv, diag::name(diag::level::debug));
+		EXPECT_EQ("info"sv, diag::name(diag::level::info));
+		EXPECT_EQ("warning"sv, diag::name(diag::level::warning));
+		EXPECT_EQ("error"sv, diag::name(diag::level::error));
+		EXPECT_EQ("unknown"sv, diag::name(static_cast<diag::level>(4)));
+	}
+
+	TEST(diag, text_goes_to_both_streams) {
+		::testing::internal::CaptureStdout();
+		::testing::internal::CaptureStderr();
+		diag::debug("--   ZUS{}:", "RCA");
+		diag::info("-- output: {}", "report.xml");
+		diag::error("{}: error: cannot find p{}", "DRA/III", 5);
+		diag::error(diag::stream::out, "{}: error: cannot find {}", "qdra", "tax.yaml");
+		auto const err = ::testing::internal::GetCapturedStderr();
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		EXPECT_EQ("--   ZUSRCA:\n-- output: report.xml\nqdra: error: cannot find tax.yaml\n"sv, out);
+		EXPECT_EQ("DRA/III: error: cannot find p5\n"sv, err);
+	}
+
+	TEST(diag, capture_takes_the_records_of_its_thread) {
+		std::vector<std::string> records{};
+		::testing::internal::CaptureStdout();
+		::testing::internal::CaptureStderr();
+		{
+			diag::capture outer{[&](diag::level, std::string_view message) { records.emplace_back(message); }};
+			diag::info("-- outer {}", 1);
+			{
+				diag::capture inner{[&](diag::level severity, std::string_view message) {
+					records.push_back(fmt::format("{}: {}", diag::name(severity), message));
+				}};
+				diag::error(diag::stream::out, "cannot find {}", "tax.yaml");
+			}
+			std::thread{[] { diag::info("-- other thread"); }}.join();
+			diag::warning("-- outer {}", 2);
+		}
+		diag::info("-- after");
+		auto const err = ::testing::internal::GetCapturedStderr();
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		EXPECT_EQ((std::vector{"-- outer 1"s, "error: cannot find tax.yaml"s, "-- outer 2"s}), records);
+		EXPECT_EQ("-- other thread\n-- after\n"sv, out);
+		EXPECT_EQ(""sv, err);
+	}
+
+	TEST(diag, levels_below_are_dropped) {
+		::testing::internal::CaptureStdout();
+		diag::set_level(diag::level::info);
+		EXPECT_FALSE(diag::enabled(diag::level::debug));
+		diag::debug("-- dropped");
+		diag::info("-- kept");
+		diag::set_level(diag::level::debug);
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		EXPECT_EQ("-- kept\n"sv, out);
+	}
+
+	TEST(diag, json_lines) {
+		::testing::internal::CaptureStdout();
+		{
+			json_lines mode{};
+			diag::form_scope form{"RCA"sv};
+			diag::debug({.section = "III"sv, .field = "1"sv}, "--       1: {}", "'\"quoted\"'");
+			diag::debug("--");
+			diag::error({.form = "DRA"sv}, "error: p{} is not a number", 5);
+		}
+		diag::info("-- back to text");
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		EXPECT_EQ(
+		    R"({"level":"debug","form":"RCA","section":"III","field":"1","message":"1: '\"quoted\"'"})"
+		    "\n"
+		    R"({"level":"error","form":"DRA","message":"error: p5 is not a number"})"
+		    "\n"
+		    "-- back to text\n"sv,
+		    out);
+	}
+
+	TEST(diag, output_scope_puts_back_the_settings) {
+		::testing::internal::CaptureStdout();
+		{
+			diag::output_scope outer{diag::level::info, diag::format::json_lines};
+			diag::debug("-- dropped");
+			{
+				diag::output_scope inner{diag::level::debug, diag::format::text};
+				diag::debug("-- inner");
+			}
+			diag::info("-- outer");
+		}
+		diag::debug("-- after");
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		EXPECT_EQ("-- inner\n"
+		          R"({"level":"info","message":"outer"})"
+		          "\n-- after\n"sv,
+		          out);
+	}
+
+	TEST(diag, async_writer_keeps_the_order) {
+		::testing::internal::CaptureStdout();
+		::testing::internal::CaptureStderr();
+		{
+			diag::async_writer writer{};
+			for (int index = 0; index < 1000; ++index) {
+				diag::debug("-- line {}", index);
+			}
+			diag::error("error: after the lines");
+			diag::info("-- last");
+		}
+		auto const err = ::testing::internal::GetCapturedStderr();
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		std::string expected{};
+		for (int index = 0; index < 1000; ++index) {
+			expected.append(fmt::format("-- line {}\n", index));
+		}
+		expected.append("-- last\n"sv);
+		EXPECT_EQ(expected, out);
+		EXPECT_EQ("error: after the lines\n"sv, err);
+	}
+
+	TEST(diag, lines_of_threads_stay_whole) {
+		static constexpr auto count = 4;
+		static constexpr auto lines = 500;
+		static constexpr auto line = "-- 0123456789abcdef\n"sv;
+
+		::testing::internal::CaptureStdout();
+		{
+			diag::async_writer writer{};
+			std::vector<std::thread> threads{};
+			for (int index = 0; index < count; ++index) {
+				threads.emplace_back([] {
+					for (int counter = 0; counter < lines; ++counter) {
+						diag::debug("{}", line.substr(0, line.size() - 1));
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+		}
+		auto const out = ::testing::internal::GetCapturedStdout();
+
+		std::string expected{};
+		for (int index = 0; index < count * lines; ++index) {
+			expected.append(line);
+		}
+		EXPECT_EQ(expected, out);
+	}
+}  // namespace quick_dra::testing
@@ -48,4 +48,14 @@ namespace quick_dra::testing {
 		EXPECT_EQ(platform::config_data_dir(), changed);
 		platform::config_data_dir(original);
 	}
+
+	TEST(paths, cache_dir) {
+		auto const original = platform::cache_dir();
+		auto const changed = std::filesystem::path{"some"} / "cache"sv;
+
+		EXPECT_FALSE(original.empty());
+		platform::cache_dir(changed);
+		EXPECT_EQ(platform::cache_dir(), changed);
+		platform::cache_dir(original);
+	}
 }  // namespace quick_dra::testing
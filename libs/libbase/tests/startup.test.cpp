@@ -0,0 +1,37 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <quick_dra/base/startup.hpp>
+#include <thread>
+
+namespace quick_dra::testing {
+	using namespace std::literals;
+
+	TEST(startup, names) {
+		EXPECT_EQ("curl"sv, startup::name(startup::subsystem::curl));
+		EXPECT_EQ("icu"sv, startup::name(startup::subsystem::icu));
+		EXPECT_EQ("locale"sv, startup::name(startup::subsystem::locale));
+		EXPECT_EQ("templates"sv, startup::name(startup::subsystem::templates));
+		EXPECT_EQ("config"sv, startup::name(startup::subsystem::config));
+		EXPECT_EQ("unknown"sv, startup::name(startup::subsystem::count));
+	}
+
+	TEST(startup, scope_adds_up) {
+		// nothing in libbase tests touches the HTTP client
+		auto const which = startup::subsystem::curl;
+		ASSERT_FALSE(startup::used(which));
+
+		{
+			startup::scope timing{which};
+			std::this_thread::sleep_for(2ms);
+		}
+		EXPECT_TRUE(startup::used(which));
+		auto const first = startup::cost(which);
+		EXPECT_GE(first, 2ms);
+
+		startup::record(which, 5ms);
+		EXPECT_EQ(first + 5ms, startup::cost(which));
+	}
+}  // namespace quick_dra::testing
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/text.hpp>
+#include <string>
+
+namespace quick_dra::testing {
+	namespace {
+		using std::literals::operator""sv;
+
+		std::string encode(char32_t code_point) {
+			std::string result{};
+			if (code_point < 0x80) {
+				result.push_back(static_cast<char>(code_point));
+			} else {
+				result.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+				result.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+			}
+			return result;
+		}
+
+		// long enough for the vector code to see a couple of full blocks
+		std::string surrounded(std::string_view text) {
+			return fmt::format("Lorem ipsum dolor sit amet {} consectetur adipiscing elit", text);
+		}
+	}  // namespace
+
+#ifndef WIN32
+	TEST(text, latin_tables_match_full_mapping) {
+		for (char32_t code_point = 0; code_point < 0x180; ++code_point) {
+			auto const input = surrounded(encode(code_point));
+			std::string actual{};
+			if (text::try_to_upper(input, actual)) {
+				EXPECT_EQ(actual, text::to_upper_full(input)) << fmt::format("U+{:04X}", static_cast<unsigned>(code_point));
+			}
+			if (text::try_to_lower(input, actual)) {
+				EXPECT_EQ(actual, text::to_lower_full(input)) << fmt::format("U+{:04X}", static_cast<unsigned>(code_point));
+			}
+		}
+	}
+#endif
+
+	TEST(text, latin_fallbacks) {
+		std::string out{};
+		EXPECT_TRUE(text::try_to_upper("Zażółć gęślą jaźń"sv, out));
+		EXPECT_EQ(out, "ZAŻÓŁĆ GĘŚLĄ JAŹŃ"sv);
+		EXPECT_TRUE(text::try_to_lower(surrounded("ZAŻÓŁĆ GĘŚLĄ JAŹŃ"sv), out));
+		EXPECT_EQ(out, "lorem ipsum dolor sit amet zażółć gęślą jaźń consectetur adipiscing elit"sv);
+
+		// more than one code point in the result
+		EXPECT_FALSE(text::try_to_upper("große"sv, out));
+		// outside of the tables
+		EXPECT_FALSE(text::try_to_upper("γαζίες"sv, out));
+		EXPECT_FALSE(text::try_to_lower(surrounded("ΓΑΖΊΕΣ"sv), out));
+	}
+
+	TEST(text, count_code_points) {
+		EXPECT_EQ(text::count_code_points(""sv), 0u);
+		EXPECT_EQ(text::count_code_points("Iksiński"sv), 8u);
+		EXPECT_EQ(text::count_code_points(surrounded("Zażółć gęślą jaźń"sv)), 72u);
+		EXPECT_EQ(text::count_code_points("Γαζίες καὶ μυρτιὲς δὲν θὰ βρῶ πιὰ στὸ χρυσαφὶ ξέφωτο."sv), 53u);
+		EXPECT_EQ(text::count_code_points("\xF0\x9F\x98\x80 and a lot of ASCII after it"sv), 29u);
+	}
+
+	TEST(text, is_valid_utf8) {
+		EXPECT_TRUE(text::is_valid_utf8(""sv));
+		EXPECT_TRUE(text::is_valid_utf8(surrounded("Zażółć gęślą jaźń"sv)));
+		EXPECT_TRUE(text::is_valid_utf8(surrounded("\xF0\x9F\x98\x80"sv)));
+		EXPECT_TRUE(text::is_valid_utf8(surrounded("\xEF\xBF\xBF"sv)));
+
+		// lone continuation
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\x80"sv)));
+		// overlong forms
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xC0\xAF"sv)));
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xE0\x80\xAF"sv)));
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xF0\x80\x80\xAF"sv)));
+		// surrogates and above U+10FFFF
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xED\xA0\x80"sv)));
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xF4\x90\x80\x80"sv)));
+		EXPECT_FALSE(text::is_valid_utf8(surrounded("\xF5\x80\x80\x80"sv)));
+		// truncated at the end
+		EXPECT_FALSE(text::is_valid_utf8("ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC5"sv));
+		EXPECT_FALSE(text::is_valid_utf8("ABCDEFGHIJKLMNOPQRSTUVWXYZ\xE2\x82"sv));
+	}
+
+	TEST(text, is_ascii) {
+		EXPECT_TRUE(text::is_ascii(""sv));
+		EXPECT_TRUE(text::is_ascii(surrounded("plain"sv)));
+		EXPECT_FALSE(text::is_ascii(surrounded("ł"sv)));
+		EXPECT_FALSE(text::is_ascii("ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC5"sv));
+	}
+}  // namespace quick_dra::testing
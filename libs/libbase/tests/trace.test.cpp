@@ -0,0 +1,53 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <quick_dra/base/trace.hpp>
+#include <string>
+#include <thread>
+
+namespace quick_dra::testing {
+	using namespace std::literals;
+
+	namespace {
+		std::string read_file(std::filesystem::path const& path) {
+			std::ifstream in{path, std::ios::binary};
+			return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+		}
+	}  // namespace
+
+	TEST(trace, disabled) {
+		ASSERT_FALSE(trace::enabled());
+		trace::span span{"idle"sv, "nothing to see"sv};
+		EXPECT_FALSE(span.recording());
+		EXPECT_TRUE(trace::stop());
+	}
+
+	TEST(trace, chrome_json) {
+		auto const path = std::filesystem::temp_directory_path() / "quick_dra-trace.test.json"sv;
+
+		trace::start(path);
+		ASSERT_TRUE(trace::enabled());
+		{
+			trace::span outer{"outer"sv, "a \"quoted\"\tdetail"sv};
+			EXPECT_TRUE(outer.recording());
+			std::thread{[] { trace::span inner{"inner"sv}; }}.join();
+		}
+		ASSERT_TRUE(trace::stop());
+		EXPECT_FALSE(trace::enabled());
+
+		auto const json = read_file(path);
+		std::filesystem::remove(path);
+
+		EXPECT_TRUE(json.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"sv)) << json;
+		EXPECT_NE(std::string::npos, json.find(R"("name":"outer","cat":"quick_dra","ph":"X")"sv)) << json;
+		EXPECT_NE(std::string::npos, json.find(R"("args":{"detail":"a \"quoted\"\tdetail"})"sv)) << json;
+		EXPECT_NE(std::string::npos, json.find(R"("name":"inner")"sv)) << json;
+		EXPECT_NE(std::string::npos, json.find(R"("tid":1,"args":{"name":"main"})"sv)) << json;
+		EXPECT_NE(std::string::npos, json.find(R"("tid":2,"args":{"name":"thread 2"})"sv)) << json;
+		EXPECT_TRUE(json.ends_with("]}\n"sv)) << json;
+	}
+}  // namespace quick_dra::testing
@@ -4,6 +4,7 @@
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 #include <array>
+#include <limits>
 #include <optional>
 #include <quick_dra/base/types.hpp>
 #include <span>
@@ -104,6 +105,47 @@ namespace quick_dra::testing {
 		ASSERT_EQ(calc_currency(-30641).rounded(), currency(-306));
 	}
 
+	TEST(money, rounding_half_away_from_zero) {
+		// a long double does not hold 1.235 exactly, the integers do
+		EXPECT_EQ(calc_currency{1'2350}.rounded(), currency{1'24});
+		EXPECT_EQ(calc_currency{1'2349}.rounded(), currency{1'23});
+		EXPECT_EQ(calc_currency{-1'2350}.rounded(), currency{-1'24});
+		EXPECT_EQ(calc_currency{-1'2349}.rounded(), currency{-1'23});
+		EXPECT_EQ(calc_currency{50}.rounded(), currency{1});
+		EXPECT_EQ(calc_currency{-50}.rounded(), currency{-1});
+		EXPECT_EQ(calc_currency{49}.rounded(), currency{});
+
+		static_assert(rescale<100, 10'000>(1'2350) == 1'24);
+		static_assert(rescale<100, 10'000>(-1'2350) == -1'24);
+		static_assert(rescale<10'000, 100>(-1'23) == -1'2300);
+		static_assert(rescale<100, 100>(-1'23) == -1'23);
+		static_assert(rescale<1, 3>(-2) == -1);
+		static_assert(rescale<1, 3>(-1) == 0);
+
+		for (long long value = -100'000; value <= 100'000; ++value) {
+			auto const expected = (value < 0 ? value - 50 : value + 50) / 100;
+			ASSERT_EQ(calc_currency{value}.rounded().value, expected) << value;
+		}
+	}
+
+	TEST(money, multiplication_does_not_overflow) {
+		constexpr auto max = std::numeric_limits<long long>::max();
+		constexpr auto min = std::numeric_limits<long long>::min();
+
+		EXPECT_EQ((calc_currency{1'000'0000} * 12.34_per).value, 123'4000);
+		EXPECT_EQ((calc_currency{-30641} * 13_per).value, -3983);
+
+		// the product would not fit, the result does
+		auto const large = calc_currency{max / 50};
+		EXPECT_EQ((large * 32_per).value, max / 50 / 100'00 * 32'00 + max / 50 % 100'00 * 32'00 / 100'00);
+		EXPECT_EQ((calc_currency{-(max / 50)} * 32_per).value, -(large * 32_per).value);
+
+		// the result does not fit either
+		EXPECT_EQ((calc_currency{max} * 200_per).value, max);
+		EXPECT_EQ((calc_currency{min} * 200_per).value, min);
+		EXPECT_EQ((calc_currency{max} * -200_per).value, min);
+	}
+
 	TEST(money, contribution) {
 		auto local = rate{};
 		local.payer = 2_per;
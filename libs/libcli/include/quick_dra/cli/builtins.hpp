@@ -17,16 +17,19 @@ namespace quick_dra::builtin {
 	X(payer, "payer", "provide/modify the identity of the insurance payer")   \
 	X(insured, "insured", "manage the insured people data")                   \
 	X(list, "list", "list people in configuration")                           \
-	X(xml, "xml", "produce KEDU 5.6 XML file")
-
-#define CONFIG_BUILTINS_X(X)                                             \
-	X(upgrade, "upgrade", "upgrade the config schema to newest version") \
-	X(accident_insurance, "accident", "update data of insurance responsibility; setting a value implies upgrading")
-
-#define INSURED_BUILTINS_X(X)                                   \
-	X(add, "add", "add a new insured person")                   \
-	X(edit, "edit", "update data of a selected insured person") \
-	X(remove, "remove", "remove an insured person from configuration")
+	X(xml, "xml", "produce KEDU 5.6 XML file")                                \
+	X(serve, "serve", "produce KEDU files on request from a local socket")
+
+#define CONFIG_BUILTINS_X(X)                                                                                        \
+	X(upgrade, "upgrade", "upgrade the config schema to newest version")                                            \
+	X(accident_insurance, "accident", "update data of insurance responsibility; setting a value implies upgrading") \
+	X(journal, "journal", "append edits to a sidecar journal instead of rewriting the config each time")
+
+#define INSURED_BUILTINS_X(X)                                          \
+	X(add, "add", "add a new insured person")                          \
+	X(edit, "edit", "update data of a selected insured person")        \
+	X(remove, "remove", "remove an insured person from configuration") \
+	X(bulk_import, "import", "add many insured people from a CSV or TSV file")
 
 #define BUILTINS_X_DECL(NAME, TOOL, DSCR)                                                    \
 	namespace NAME {                                                                         \
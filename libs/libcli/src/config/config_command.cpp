@@ -14,6 +14,7 @@
 #include <quick_dra/conv/conversation.hpp>
 #include <quick_dra/conv/low_level.hpp>
 #include <quick_dra/conv/search.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <quick_dra/models/project_reader.hpp>
 #include <quick_dra/models/types.hpp>
 #include <string>
@@ -131,9 +132,12 @@ namespace quick_dra::builtin::config {
 				(*cfg.accident_insurance)[month] = *contribution;
 				fmt::print("\033[0;90mAccident contribution for {} set to \033[m{}%\n", fmt_date(month), *contribution);
 
-				upgrade_all(cfg, month);
-
-				if (!cfg.store(path)) {
+				// an upgrade touches every record, so it cannot be journaled
+				auto const stored =
+				    upgrade_all(cfg, month)
+				        ? cfg.store(path)
+				        : commit(cfg, path, journal_entry::accident_insurance_changed(*cfg.accident_insurance));
+				if (!stored) {
 					// GCOV_EXCL_START
 					fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", path);
 					return 1;
@@ -149,4 +153,66 @@ namespace quick_dra::builtin::config {
 			return 0;
 		}
 	}  // namespace accident_insurance
+
+	namespace journal {
+		int handle(std::string_view tool_name, args::arglist arguments, std::string_view description) {
+			std::optional<std::string> config_path;
+			bool enable{false};
+			bool disable{false};
+			bool compact{false};
+			unsigned compact_every{config_journal::kDefaultCompactEvery};
+
+			args::null_translator tr{};
+			args::parser parser{as_str(description), {tool_name, arguments}, &tr};
+
+			parser.arg(config_path, "config").meta("<path>").help("select config file; defaults to ~/.quick_dra.yaml");
+			parser.set<std::true_type>(enable, "enable").help("start journaling the edits").opt();
+			parser.set<std::true_type>(disable, "disable").help("fold the journal into the config and remove it").opt();
+			parser.set<std::true_type>(compact, "compact").help("fold the journal into the config now").opt();
+			parser.arg(compact_every, "every")
+			    .meta("<N>")
+			    .help("with --enable, rewrite the config every N edits; defaults to 64")
+			    .opt();
+
+			parser.parse();
+
+			if ((enable ? 1 : 0) + (disable ? 1 : 0) + (compact ? 1 : 0) > 1) {
+				parser.error("--enable, --disable and --compact are mutually exclusive");
+			}
+
+			if (compact_every < 1) {
+				parser.error("--every must be at least 1");
+			}
+
+			auto const path = platform::get_config_path(config_path);
+			auto const journal_path = config_journal::path_for(path);
+
+			if (enable || disable || compact) {
+				auto const result = enable    ? config_journal::enable(path, compact_every)
+				                    : disable ? config_journal::disable(path)
+				                              : config_journal::compact(path);
+				if (!result) {
+					fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", journal_path);
+					return 1;
+				}
+				return 0;
+			}
+
+			config_journal current{};
+			switch (current.load(path)) {
+				case load_status::file_not_found:
+					fmt::print("\033[0;90mJournal is \033[mdisabled\n");
+					break;
+				case load_status::loaded:
+					fmt::print("\033[0;90mJournal is \033[menabled\033[0;90m, {} pending edit(s), compacted every {}\033[m\n",
+					           current.entries.size(), current.compact_every);
+					break;
+				default:
+					fmt::print(stderr, "Quick-DRA: error: could not read {}\n", journal_path);
+					return 1;
+			}
+
+			return 0;
+		}
+	}  // namespace journal
 }  // namespace quick_dra::builtin::config
@@ -5,7 +5,9 @@
 #include <fmt/std.h>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/conv/args_parser.hpp>
+#include <quick_dra/conv/search_index.hpp>
 #include <quick_dra/conv/validators.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <utility>
 #include <vector>
 #include "insured_add_conversation.hpp"
@@ -80,11 +82,23 @@ namespace quick_dra::builtin::insured::add {
 			salary.select(conv.dst).reset();
 		}
 
+		// only an index already in use is worth keeping up to date
+		auto index = insured_index::load(conv.path);
+		if (index && index->size() != cfg.insured->size()) {
+			index.reset();
+		}
+
 		cfg.insured->push_back(std::move(conv.dst));
-		if (!cfg.store(conv.path)) {
+		if (!commit(cfg, conv.path, journal_entry::insured_added(cfg.insured->back()))) {
 			fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", conv.path);
 			return 1;
 		}
+
+		if (index) {
+			auto const position = static_cast<unsigned>(cfg.insured->size() - 1);
+			index->insert(position, cfg.insured->back());
+			index->store(conv.path);
+		}
 		return 0;
 	}
 }  // namespace quick_dra::builtin::insured::add
@@ -6,6 +6,7 @@
 #include <quick_dra/conv/args_parser.hpp>
 #include <quick_dra/conv/search.hpp>
 #include <quick_dra/conv/validators.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <string>
 #include <vector>
 #include "insured_edit_conversation.hpp"
@@ -58,7 +59,8 @@ namespace quick_dra::builtin::insured::edit {
 			cfg.insured.emplace();
 		}
 
-		auto found = search_insured_from_term(conv.search_term, *cfg.insured, match_level::none, nullptr,
+		auto index = insured_index::load_or_build(conv.path, *cfg.insured, conv.fuzzy);
+		auto found = search_insured_from_term(conv.search_term, *cfg.insured, index, match_level::none, nullptr,
 		                                      [&conv](std::string const& msg) { conv.parser.error(msg); });
 
 		year_month on_month{};
@@ -146,10 +148,13 @@ namespace quick_dra::builtin::insured::edit {
 		}
 
 		orig = conv.dst;
-		if (!cfg.store(conv.path)) {
+		if (!commit(cfg, conv.path, journal_entry::insured_edited(found.front(), orig))) {
 			fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", conv.path);
 			return 1;
 		}
+
+		index.update(found.front(), orig);
+		index.store(conv.path);
 		return 0;
 	}
 }  // namespace quick_dra::builtin::insured::edit
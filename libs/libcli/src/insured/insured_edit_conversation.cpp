@@ -35,6 +35,9 @@ namespace quick_dra::builtin::insured::edit {
 		    .help(
 		        "first or last name, or a document number to use as a "
 		        "search key");
+		parser.set<std::true_type>(fuzzy, "fuzzy")
+		    .help("with --find, also accept names without diacritics or with typos")
+		    .opt();
 		parser.set<std::false_type>(ask_questions, "y")
 		    .help(
 		        "use answers from command line; do not ask additional "
@@ -15,6 +15,7 @@ namespace quick_dra::builtin::insured::edit {
 	struct conversation : quick_dra::conversation<partial::insured_t>, arg_parser {
 		std::filesystem::path path;
 		std::variant<unsigned, std::string> search_term{};
+		bool fuzzy{false};
 
 		conversation(std::string_view tool_name, args::arglist arguments, std::string_view description);
 
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/conv/args_parser.hpp>
+#include <quick_dra/models/project_reader.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "insured_import_rows.hpp"
+
+namespace quick_dra::builtin::insured::bulk_import {
+	namespace {
+		std::optional<std::string> read_input(std::filesystem::path const& path) {
+			std::optional<std::string> result{};
+			std::ostringstream contents;
+			if (path == std::filesystem::path{"-"sv}) {
+				contents << std::cin.rdbuf();
+			} else {
+				std::ifstream in{path, std::ios::in | std::ios::binary};
+				if (!in) {
+					return result;
+				}
+				contents << in.rdbuf();
+			}
+
+			result = std::move(contents).str();
+			return result;
+		}
+
+		std::string document_key(partial::insured_t const& person) {
+			return fmt::format("{} {}", person.kind.value_or(""s), person.document.value_or(""s));
+		}
+	}  // namespace
+
+	int handle(std::string_view tool_name, args::arglist arguments, std::string_view description) {
+		std::optional<std::string> config_path;
+		std::optional<std::string> changes_date{};
+		std::string input_path{};
+
+		args::null_translator tr{};
+		args::parser parser{as_str(description), {tool_name, arguments}, &tr};
+
+		parser.arg(config_path, "config").meta("<path>").help("select config file; defaults to ~/.quick_dra.yaml");
+		parser.arg(changes_date, "on")
+		    .meta("<yyyy/mm>")
+		    .help("which month the scale and salary refer to, for rows without the last column; defaults to current month");
+		parser.arg(input_path)
+		    .meta("<file>")
+		    .help(
+		        "CSV or TSV file with the columns printed by `qdra list --pipe'; "
+		        "use - to read from standard input");
+
+		parser.parse();
+
+		auto month = month_today();
+		if (changes_date) {
+			if (!yaml::convert_string(*changes_date, month)) {
+				parser.error(fmt::format("--on expected YYYY/MM, got `{}`", *changes_date));
+			}
+		}
+
+		auto const input = std::filesystem::path{as_u8v(input_path)};
+		auto const contents = read_input(input);
+		if (!contents) {
+			fmt::print(stderr, "Quick-DRA: error: could not read {}\n", input);
+			return 1;
+		}
+
+		auto const path = platform::get_config_path(config_path);
+		auto cfg = partial::config::load_partial(path);
+		if (!cfg.insured) {
+			cfg.insured.emplace();
+		}
+
+		auto const rows = split_rows(*contents);
+		auto results = validate_rows(rows, month);
+
+		std::set<std::string> documents{};
+		for (auto const& person : *cfg.insured) {
+			documents.insert(document_key(person));
+		}
+
+		size_t bad_rows = 0;
+		for (size_t index = 0; index < rows.size(); ++index) {
+			auto& result = results[index];
+			if (result.insured && !documents.insert(document_key(*result.insured)).second) {
+				result.errors.push_back(fmt::format("another person with document {} {} is already present",
+				                                    *result.insured->kind, *result.insured->document));
+			}
+
+			if (result.errors.empty()) continue;
+
+			++bad_rows;
+			for (auto const& error : result.errors) {
+				fmt::print(stderr, "{}:{}: error: {}\n", input, rows[index].line, error);
+			}
+		}
+
+		if (bad_rows) {
+			fmt::print(stderr, "Quick-DRA: error: {} of {} row(s) need fixing; nothing was imported\n", bad_rows,
+			           rows.size());
+			return 1;
+		}
+
+		cfg.insured->reserve(cfg.insured->size() + results.size());
+		for (auto& result : results) {
+			cfg.insured->push_back(std::move(*result.insured));
+		}
+
+		if (!cfg.store(path)) {
+			fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", path);
+			return 1;
+		}
+
+		fmt::print("\033[0;90mImported \033[m{}\033[0;90m insured person(s)\033[m\n", results.size());
+		return 0;
+	}
+}  // namespace quick_dra::builtin::insured::bulk_import
@@ -0,0 +1,208 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "insured_import_rows.hpp"
+#include <fmt/format.h>
+#include <algorithm>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/lex/validators.hpp>
+#include <quick_dra/models/project_reader.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace quick_dra::builtin::insured::bulk_import {
+	namespace {
+		// below this, starting the threads costs more than the checks
+		static constexpr size_t kRowsPerWorker = 256;
+
+		char detect_separator(std::string_view contents) {
+			for (auto const line : split_sv(contents, '\n'_sep)) {
+				if (line.find('\t') != std::string_view::npos) return '\t';
+				if (line.find('\0') != std::string_view::npos) return '\0';
+				if (line.find(',') != std::string_view::npos) return ',';
+			}
+			return '\t';
+		}
+
+		std::vector<std::string> split_fields(std::string_view line, char separator) {
+			std::vector<std::string> result{};
+			result.reserve(column_count);
+
+			if (separator != ',') {
+				for (auto const field : split_sv(line, sep_char_t{separator})) {
+					result.emplace_back(field);
+				}
+				return result;
+			}
+
+			std::string field{};
+			bool in_quotes{false};
+			for (size_t index = 0; index < line.size(); ++index) {
+				auto const ch = line[index];
+				if (in_quotes) {
+					if (ch != '"') {
+						field.push_back(ch);
+					} else if (index + 1 < line.size() && line[index + 1] == '"') {
+						field.push_back('"');
+						++index;
+					} else {
+						in_quotes = false;
+					}
+					continue;
+				}
+
+				if (ch == '"') {
+					in_quotes = true;
+				} else if (ch == ',') {
+					result.push_back(std::move(field));
+					field.clear();
+				} else {
+					field.push_back(ch);
+				}
+			}
+			result.push_back(std::move(field));
+
+			return result;
+		}
+
+		void check_document(std::string_view kind, std::string_view document, std::vector<std::string>& errors) {
+			if (kind == "P"sv) {
+				if (!social_id_validator::is_valid(document)) {
+					errors.push_back(fmt::format("PESEL `{}` seems to be invalid", document));
+				}
+			} else if (kind == "1"sv) {
+				if (!id_card_validator::is_valid(document)) {
+					errors.push_back(fmt::format("ID card `{}` seems to be invalid", document));
+				}
+			} else if (kind == "2"sv) {
+				if (!pl_passport_validator::is_valid(document)) {
+					errors.push_back(fmt::format("passport number `{}` seems to be invalid", document));
+				}
+			} else {
+				errors.push_back(fmt::format("document kind `{}` is not one of P, 1 or 2", kind));
+			}
+		}
+	}  // namespace
+
+	std::vector<row> split_rows(std::string_view contents) {
+		std::vector<row> result{};
+		auto const separator = detect_separator(contents);
+
+		unsigned line_no = 0;
+		for (auto line : split_sv(contents, '\n'_sep)) {
+			++line_no;
+			if (!line.empty() && line.back() == '\r') line = line.substr(0, line.size() - 1);
+			if (line.empty() || line.front() == '#') continue;
+
+			auto fields = split_fields(line, separator);
+			if (fields.front() == "P"sv) continue;
+
+			result.push_back({.line = line_no, .fields = std::move(fields)});
+		}
+
+		return result;
+	}
+
+	row_result validate_row(row const& input, year_month const& default_month) {
+		row_result result{};
+		auto& errors = result.errors;
+
+		if (input.fields.size() < document + 1 || input.fields.size() > column_count) {
+			errors.push_back(fmt::format("expected between {} and {} columns, got {}", document + 1, column_count,
+			                             input.fields.size()));
+			return result;
+		}
+
+		auto const field = [&](column index) -> std::string_view {
+			if (index >= input.fields.size()) return {};
+			return strip_sv(input.fields[index]);
+		};
+
+		partial::insured_t person{};
+
+		if (field(last_name).empty()) errors.push_back("last name is missing"s);
+		if (field(first_name).empty()) errors.push_back("first name is missing"s);
+		person.last_name = std::string{field(last_name)};
+		person.first_name = std::string{field(first_name)};
+
+		check_document(field(kind), field(document), errors);
+		person.kind = std::string{field(kind)};
+		person.document = std::string{field(document)};
+
+		if (!field(title).empty()) {
+			insurance_title value{};
+			if (insurance_title::parse(field(title), value)) {
+				person.title = std::move(value);
+			} else {
+				errors.push_back(fmt::format("insurance title `{}` seems to be invalid", field(title)));
+			}
+		} else {
+			errors.push_back("insurance title is missing"s);
+		}
+
+		partial::employment_history employment{};
+
+		if (!field(part_time_scale).empty()) {
+			ratio value{};
+			if (!ratio::parse(field(part_time_scale), value)) {
+				errors.push_back(fmt::format("part-time scale `{}` seems to be invalid", field(part_time_scale)));
+			} else if (value != full_time) {
+				employment.part_time_scale = value;
+			}
+		}
+
+		auto const salary_value = field(salary);
+		if (!salary_value.empty() && salary_value != "minimal"sv && salary_value != "minimal for a given month"sv) {
+			currency value{};
+			if (currency::parse(salary_value, value)) {
+				employment.salary = value;
+			} else {
+				errors.push_back(fmt::format("salary `{}` seems to be invalid", salary_value));
+			}
+		}
+
+		auto month = default_month;
+		if (!field(since).empty() && !yaml::convert_string(field(since), month)) {
+			errors.push_back(fmt::format("expected YYYY/MM, got `{}`", field(since)));
+		}
+
+		person.history.emplace();
+		(*person.history)[month] = employment;
+
+		if (errors.empty()) {
+			result.insured = std::move(person);
+		}
+
+		return result;
+	}
+
+	std::vector<row_result> validate_rows(std::span<row const> rows, year_month const& default_month) {
+		std::vector<row_result> result(rows.size());
+
+		auto const validate_range = [&](size_t from, size_t to) {
+			for (auto index = from; index < to; ++index) {
+				result[index] = validate_row(rows[index], default_month);
+			}
+		};
+
+		auto const max_workers = std::max(1u, std::thread::hardware_concurrency());
+		auto const workers = std::min<size_t>(max_workers, (rows.size() + kRowsPerWorker - 1) / kRowsPerWorker);
+		if (workers < 2) {
+			validate_range(0, rows.size());
+			return result;
+		}
+
+		auto const chunk = (rows.size() + workers - 1) / workers;
+		{
+			std::vector<std::jthread> pool{};
+			pool.reserve(workers);
+			for (size_t from = 0; from < rows.size(); from += chunk) {
+				pool.emplace_back(validate_range, from, std::min(rows.size(), from + chunk));
+			}
+		}  // joins all the workers
+
+		return result;
+	}
+}  // namespace quick_dra::builtin::insured::bulk_import
@@ -0,0 +1,49 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <optional>
+#include <quick_dra/models/types.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace quick_dra::builtin::insured::bulk_import {
+	// Columns, in order, as printed by `qdra list --pipe`; the first one
+	// (the position, or "P" for the payer) is not imported.
+	enum column : unsigned {
+		position,
+		last_name,
+		first_name,
+		kind,
+		document,
+		title,
+		part_time_scale,
+		salary,
+		since,
+		column_count,
+	};
+
+	struct row {
+		unsigned line{};
+		std::vector<std::string> fields{};
+	};
+
+	struct row_result {
+		std::optional<partial::insured_t> insured{};
+		std::vector<std::string> errors{};
+	};
+
+	// Splits TSV, `-z` or CSV (with "quoted, fields") text into rows; the
+	// separator is taken from the first row having a tab, a NUL or a comma.
+	// Empty lines, lines starting with `#` and payer rows are skipped.
+	std::vector<row> split_rows(std::string_view contents);
+
+	row_result validate_row(row const& input, year_month const& default_month);
+
+	// Runs validate_row on every row, spreading larger inputs over all
+	// available cores; results keep the order of the input.
+	std::vector<row_result> validate_rows(std::span<row const> rows, year_month const& default_month);
+}  // namespace quick_dra::builtin::insured::bulk_import
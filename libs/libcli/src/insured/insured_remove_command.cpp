@@ -11,6 +11,7 @@
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/conv/args_parser.hpp>
 #include <quick_dra/conv/low_level.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <quick_dra/models/types.hpp>
 #include <string_view>
 #include <type_traits>
@@ -62,11 +63,14 @@ namespace quick_dra::builtin::insured::remove {
 		}
 
 		opts.cfg.insured->erase(std::next(opts.cfg.insured->begin(), opts.found.front()));
-		if (!opts.cfg.store(opts.path)) {
+		if (!commit(opts.cfg, opts.path, journal_entry::insured_removed(opts.found.front()))) {
 			fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", opts.path);
 			return 1;
 		}
 
+		opts.index.erase(opts.found.front());
+		opts.index.store(opts.path);
+
 		return 0;
 	}
 }  // namespace quick_dra::builtin::insured::remove
@@ -15,6 +15,7 @@ namespace quick_dra::builtin::insured::remove {
 		std::optional<std::string> config_path;
 		std::optional<unsigned> position;
 		std::optional<std::string> search_keyword;
+		bool fuzzy{false};
 
 		parser.arg(config_path, "config").meta("<path>").help("select config file; defaults to ~/.quick_dra.yaml");
 
@@ -30,6 +31,10 @@ namespace quick_dra::builtin::insured::remove {
 		        "first or last name, or a document number to use as a "
 		        "search key");
 
+		parser.set<std::true_type>(fuzzy, "fuzzy")
+		    .help("with --find, also accept names without diacritics or with typos")
+		    .opt();
+
 		parser.set<std::false_type>(out.ask_questions, "y")
 		    .help("remove record if possible; do not ask additional questions")
 		    .opt();
@@ -55,14 +60,14 @@ namespace quick_dra::builtin::insured::remove {
 			return 1;
 		}
 
+		out.index = insured_index::load_or_build(out.path, *out.cfg.insured, fuzzy);
 		out.found.clear();
 		auto const on_error = [&parser](std::string const& msg) { parser.error(msg); };
 
 		if (position) {
 			out.found = search_insured_from_position(*position, *out.cfg.insured, on_error);
 		} else {
-			out.found =
-			    search_insured_from_keyword(*search_keyword, *out.cfg.insured, match_level::none, nullptr, on_error);
+			out.found = search_insured_from_keyword(*search_keyword, out.index, match_level::none, nullptr, on_error);
 		}
 
 		return 0;
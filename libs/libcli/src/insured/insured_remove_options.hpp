@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <quick_dra/conv/args_parser.hpp>
+#include <quick_dra/conv/search_index.hpp>
 #include <quick_dra/models/types.hpp>
 #include <vector>
 
@@ -14,6 +15,7 @@ namespace quick_dra::builtin::insured::remove {
 		std::vector<unsigned> found{};
 		bool ask_questions{true};
 		partial::config cfg{};
+		insured_index index{};
 	};
 
 	int get_options(args::parser& parser, options& out);
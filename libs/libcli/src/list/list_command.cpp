@@ -19,6 +19,7 @@ namespace quick_dra::builtin::list {
 	int handle(std::string_view tool_name, args::arglist arguments, std::string_view description) {
 		std::optional<std::string> config_path;
 		std::optional<std::string> search_keyword;
+		bool fuzzy{false};
 		bool pipe{false};
 		bool zero_pipe{false};
 
@@ -33,6 +34,10 @@ namespace quick_dra::builtin::list {
 		        "first or last name, or a document number to use as a "
 		        "search key");
 
+		parser.set<std::true_type>(fuzzy, "fuzzy")
+		    .help("with --find, also accept names without diacritics or with typos")
+		    .opt();
+
 		parser.set<std::true_type>(pipe, "pipe").help("generate tab-separated output").opt();
 		parser.set<std::true_type>(zero_pipe, "z").help("use zero as field separator, when --pipe is also used").opt();
 
@@ -45,7 +50,8 @@ namespace quick_dra::builtin::list {
 
 		if (cfg.payer) {
 			if (search_keyword) {
-				payer_matches = match_payer_from_keyword(*search_keyword, *cfg.payer);
+				payer_matches = fuzzy ? match_payer_fuzzy(*search_keyword, *cfg.payer)
+				                      : match_payer_from_keyword(*search_keyword, *cfg.payer);
 			} else {
 				payer_matches = match_level::direct;
 			}
@@ -57,7 +63,8 @@ namespace quick_dra::builtin::list {
 
 		std::vector<unsigned> found{};
 		if (search_keyword) {
-			found = search_insured_from_keyword(*search_keyword, *cfg.insured, payer_matches, &insured_matches,
+			auto const index = insured_index::load_or_build(path, *cfg.insured, fuzzy);
+			found = search_insured_from_keyword(*search_keyword, index, payer_matches, &insured_matches,
 			                                    [&parser](std::string const& msg) { parser.error(msg); });
 		} else {
 			auto const size = cfg.insured->size();
@@ -72,6 +79,11 @@ namespace quick_dra::builtin::list {
 			payer_matches = match_level::none;
 		}
 
+		if (insured_matches != match_level::none && insured_matches != match_level::fuzzy &&
+		    payer_matches == match_level::fuzzy) {
+			payer_matches = match_level::none;
+		}
+
 		auto const today = get_today();
 		auto const date = today.year() / today.month();
 
@@ -6,6 +6,7 @@
 #include <quick_dra/conv/args_parser.hpp>
 #include <quick_dra/conv/low_level.hpp>
 #include <quick_dra/conv/validators.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <utility>
 #include "payer_conversation.hpp"
 
@@ -38,7 +39,7 @@ namespace quick_dra::builtin::payer {
 		conv.show_modified(policies::document, *cfg.payer);
 
 		cfg.payer = std::move(conv.dst);
-		if (!cfg.store(conv.path)) {
+		if (!commit(cfg, conv.path, journal_entry::payer_changed(*cfg.payer))) {
 			fmt::print(stderr, "Quick-DRA: error: could not write to {}\n", conv.path);
 			return 1;
 		}
@@ -3,6 +3,7 @@
 
 #include <fmt/format.h>
 #include <array>
+#include <quick_dra/base/startup.hpp>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/cli/builtins.hpp>
 #include <span>
@@ -22,6 +23,7 @@ namespace quick_dra::builtin {
 int tool(args::args_view const& arguments) {
 	using namespace quick_dra;
 
+	startup::report_from_env();
 	builtin::root_parser parser{arguments, builtin::command_groups};
 	return quick_dra::tools::run(parser, builtin::tools, "qdra"sv);
 }
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "resident_state.hpp"
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <fstream>
+#include <memory_resource>
+#include <optional>
+#include <quick_dra/base/chrono.hpp>
+#include <quick_dra/docs/file_set.hpp>
+#include <quick_dra/docs/xml.hpp>
+#include <quick_dra/models/journal.hpp>
+#include <sstream>
+#include <utility>
+
+namespace quick_dra::builtin::serve {
+	namespace {
+		// a journal replayed on load is as much a part of the config as the file itself
+		std::string config_stamp(std::filesystem::path const& path) {
+			auto stamp = file_stamp(path);
+			if (stamp.empty()) return stamp;
+			return fmt::format("{}|{}", stamp, file_stamp(config_journal::path_for(path)));
+		}
+	}  // namespace
+
+	resident_state::resident_state(tax_config const& tax, compiled_templates templates)
+	    : tax_{tax}, templates_{std::move(templates)} {}
+
+	reply resident_state::handle(request const& req) {
+		std::string error{};
+		auto const shared = config_for(req.config_path, error);
+		if (!shared) return reply::failed(std::move(error));
+
+		// the tax parameters of the month are looked up aside, the shared copy is only read
+		auto const& cfg = *shared;
+		std::optional<tax_parameters> overridden{};
+		auto const& params = lookup_parameters(overridden, tax_, cfg.accident_insurance, req.date);
+
+		std::string contents{};
+		{
+			std::pmr::monotonic_buffer_resource arena{};
+			auto const forms = prepare_form_set(verbose::none, req.report_index, req.date,
+			                                    req.today.value_or(get_today()), cfg, params, &rca_, &arena);
+			auto const file = build_file_set(verbose::none, forms, templates_, &arena);
+
+			std::ostringstream out{};
+			if (req.indent_xml)
+				out << file.indented();
+			else
+				out << file;
+			contents = std::move(out).str();
+		}
+
+		if (!req.output) return reply::inline_document(std::move(contents));
+
+		{
+			auto file = std::ofstream{*req.output, std::ios::out | std::ios::binary};
+			file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+			if (!file) return reply::failed(fmt::format("cannot write {}", *req.output));
+		}
+		return reply::stored(*req.output);
+	}
+
+	size_t resident_state::cached_configs() const {
+		std::lock_guard lock{configs_mtx_};
+		return configs_.size();
+	}
+
+	std::shared_ptr<config const> resident_state::config_for(std::filesystem::path const& path, std::string& error) {
+		std::error_code ec{};
+		auto const key = std::filesystem::weakly_canonical(path, ec);
+		if (ec) {
+			error = fmt::format("cannot find {}", path);
+			return {};
+		}
+
+		auto stamp = config_stamp(key);
+		if (stamp.empty()) {
+			error = fmt::format("cannot find {}", path);
+			return {};
+		}
+
+		{
+			std::lock_guard lock{configs_mtx_};
+			auto it = configs_.find(key);
+			if (it != configs_.end() && it->second.stamp == stamp) return it->second.data;
+		}
+
+		std::shared_ptr<config const> data{};
+		{
+			std::lock_guard lock{parser_mtx_};
+			// another worker might have been parsing the same file just now
+			{
+				std::lock_guard configs_lock{configs_mtx_};
+				auto it = configs_.find(key);
+				if (it != configs_.end() && it->second.stamp == stamp) return it->second.data;
+			}
+
+			// the payer's files are not ours to rewrite; the journal is only
+			// replayed in memory
+			auto parsed = config::parse_yaml_readonly(key);
+			if (!parsed) {
+				error = fmt::format("cannot read {}", path);
+				return {};
+			}
+			data = std::make_shared<config const>(std::move(*parsed));
+		}
+
+		std::lock_guard lock{configs_mtx_};
+		configs_[key] = {.stamp = std::move(stamp), .data = data};
+		return data;
+	}
+}  // namespace quick_dra::builtin::serve
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <quick_dra/docs/forms.hpp>
+#include <quick_dra/io/tax_config.hpp>
+#include <quick_dra/models/types.hpp>
+#include <string>
+#include "serve_protocol.hpp"
+
+namespace quick_dra::builtin::serve {
+	// Everything `qdra xml` would load on each run, kept between the requests.
+	// The tax parameters and the templates are read once; a payer config is
+	// parsed again only after it, or its journal, changes on disk.
+	class resident_state {
+	public:
+		resident_state(tax_config const& tax, compiled_templates templates);
+
+		// safe to call from many workers at once
+		reply handle(request const& req);
+
+		size_t cached_configs() const;
+
+	private:
+		struct cached_config {
+			std::string stamp{};
+			std::shared_ptr<config const> data{};
+		};
+
+		std::shared_ptr<config const> config_for(std::filesystem::path const& path, std::string& error);
+
+		resolved_tax_parameters tax_;
+		compiled_templates templates_;
+		rca_cache rca_{};
+
+		mutable std::mutex configs_mtx_{};
+		std::map<std::filesystem::path, cached_config> configs_{};
+
+		// the YAML parser reports errors through process-wide callbacks
+		std::mutex parser_mtx_{};
+	};
+}  // namespace quick_dra::builtin::serve
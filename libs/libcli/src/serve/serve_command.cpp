@@ -0,0 +1,321 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/verbose.hpp>
+#include <quick_dra/conv/args_parser.hpp>
+#include <quick_dra/io/tax_config.hpp>
+#include <quick_dra/models/types.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include "resident_state.hpp"
+#include "serve_protocol.hpp"
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+using namespace std::literals;
+
+namespace quick_dra::builtin::serve {
+	namespace {
+#ifndef _WIN32
+		static constexpr auto kMaxLineLength = size_t{64 * 1024};
+		// a client keeps its worker only for as long as it keeps talking
+		static constexpr auto kIdleTimeout = std::chrono::seconds{30};
+
+		std::atomic<bool> stop_requested{false};
+
+		void on_stop_signal(int) { stop_requested.store(true); }
+
+		std::filesystem::path default_socket_path() { return platform::cache_dir() / "qdra.sock"sv; }
+
+		// accepted connections, waiting for a free worker
+		class connection_queue {
+		public:
+			void push(int fd) {
+				{
+					std::lock_guard lock{mtx_};
+					fds_.push_back(fd);
+				}
+				cv_.notify_one();
+			}
+
+			std::optional<int> pop() {
+				std::unique_lock lock{mtx_};
+				cv_.wait(lock, [this] { return closed_ || !fds_.empty(); });
+				if (fds_.empty()) return std::nullopt;
+				auto const fd = fds_.front();
+				fds_.pop_front();
+				return fd;
+			}
+
+			void close() {
+				{
+					std::lock_guard lock{mtx_};
+					closed_ = true;
+				}
+				cv_.notify_all();
+			}
+
+		private:
+			std::mutex mtx_{};
+			std::condition_variable cv_{};
+			std::deque<int> fds_{};
+			bool closed_{false};
+		};
+
+		bool send_all(int fd, std::string_view data) {
+			while (!data.empty()) {
+				auto const sent = ::send(fd, data.data(), data.size(), 0);
+				if (sent < 0) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				data.remove_prefix(static_cast<size_t>(sent));
+			}
+			return true;
+		}
+
+		void log_request(verbose level, std::string_view line, reply const& result) {
+			if (result.type == reply::error) {
+				fmt::print(stderr, "qdra serve: error: {}: {}\n", line, result.payload);
+				return;
+			}
+
+			if (level == verbose::none) return;
+			if (result.type == reply::file) {
+				fmt::print("-- {}: {}\n", line, result.payload);
+			} else {
+				fmt::print("-- {}: {} bytes\n", line, result.payload.size());
+			}
+		}
+
+		// one request per line, for as long as the client keeps the connection
+		// and sends something at least every kIdleTimeout
+		void serve_connection(int fd, resident_state& state, verbose level) {
+			std::string buffer{};
+			char chunk[4096];
+			auto last_heard = std::chrono::steady_clock::now();
+
+			while (true) {
+				auto const pos = buffer.find('\n');
+				if (pos == std::string::npos) {
+					if (buffer.size() > kMaxLineLength) {
+						send_all(fd, reply::failed("request too long"s).to_wire());
+						break;
+					}
+
+					// a stopping server still answers the request it is reading
+					pollfd pfd{.fd = fd, .events = POLLIN, .revents = 0};
+					auto const ready = ::poll(&pfd, 1, 500);
+					if (ready == 0 && buffer.empty() && stop_requested.load()) break;
+					if (ready == 0 && std::chrono::steady_clock::now() - last_heard >= kIdleTimeout) break;
+					if (ready == 0 || (ready < 0 && errno == EINTR)) continue;
+
+					auto const received = ::recv(fd, chunk, sizeof(chunk), 0);
+					if (received < 0 && errno == EINTR) continue;
+					if (received <= 0) break;
+					buffer.append(chunk, static_cast<size_t>(received));
+					last_heard = std::chrono::steady_clock::now();
+					continue;
+				}
+
+				auto line = buffer.substr(0, pos);
+				buffer.erase(0, pos + 1);
+				if (!line.empty() && line.back() == '\r') line.pop_back();
+				if (line.find_first_not_of(" \t"sv) == std::string::npos) continue;
+
+				std::string error{};
+				auto const req = parse_request(line, error);
+				auto const result = req ? state.handle(*req) : reply::failed(std::move(error));
+				log_request(level, line, result);
+
+				if (!send_all(fd, result.to_wire())) break;
+			}
+
+			::close(fd);
+		}
+
+		// zero, when someone is listening on the other end
+		int connect_error(sockaddr_un const& addr) {
+			auto const fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if (fd < 0) return errno;
+			auto const connected = ::connect(fd, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr)) == 0;
+			auto const error = connected ? 0 : errno;
+			::close(fd);
+			return error;
+		}
+
+		int open_socket(std::filesystem::path const& path) {
+			auto const native = path.native();
+			sockaddr_un addr{};
+			if (native.size() >= sizeof(addr.sun_path)) {
+				fmt::print(stderr, "qdra serve: error: socket path too long: {}\n", path);
+				return -1;
+			}
+			addr.sun_family = AF_UNIX;
+			std::memcpy(addr.sun_path, native.c_str(), native.size() + 1);
+
+			std::error_code ec{};
+			if (std::filesystem::is_socket(path, ec)) {
+				auto const error = connect_error(addr);
+				if (!error) {
+					fmt::print(stderr, "qdra serve: error: a server is already listening on {}\n", path);
+					return -1;
+				}
+				// a socket left by a server which did not stop cleanly
+				if (error == ECONNREFUSED) std::filesystem::remove(path, ec);
+			}
+			if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), ec);
+
+			auto const fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if (fd < 0) {
+				fmt::print(stderr, "qdra serve: error: cannot create socket: {}\n", std::strerror(errno));
+				return -1;
+			}
+
+			// the payroll data stays with the user running the server
+			auto const mask = ::umask(S_IRWXG | S_IRWXO);
+			auto const bound = ::bind(fd, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr));
+			::umask(mask);
+
+			if (bound < 0 || ::listen(fd, SOMAXCONN) < 0) {
+				fmt::print(stderr, "qdra serve: error: cannot listen on {}: {}\n", path, std::strerror(errno));
+				::close(fd);
+				return -1;
+			}
+
+			return fd;
+		}
+
+		int run_server(std::filesystem::path const& path, unsigned workers, resident_state& state, verbose level) {
+			stop_requested.store(false);
+			std::signal(SIGPIPE, SIG_IGN);
+			auto const prev_int = std::signal(SIGINT, on_stop_signal);
+			auto const prev_term = std::signal(SIGTERM, on_stop_signal);
+
+			auto const listener = open_socket(path);
+			if (listener < 0) {
+				std::signal(SIGINT, prev_int);
+				std::signal(SIGTERM, prev_term);
+				return 1;
+			}
+
+			fmt::print("-- listening on {} with {} workers\n", path, workers);
+			std::fflush(stdout);
+
+			connection_queue queue{};
+			std::vector<std::thread> pool{};
+			pool.reserve(workers);
+			for (unsigned index = 0; index < workers; ++index) {
+				pool.emplace_back([&] {
+					while (auto const fd = queue.pop()) {
+						serve_connection(*fd, state, level);
+					}
+				});
+			}
+
+			while (!stop_requested.load()) {
+				pollfd pfd{.fd = listener, .events = POLLIN, .revents = 0};
+				auto const ready = ::poll(&pfd, 1, 500);
+				if (ready <= 0) continue;
+
+				auto const client = ::accept(listener, nullptr, nullptr);
+				if (client < 0) continue;
+				queue.push(client);
+			}
+
+			::close(listener);
+			queue.close();
+			for (auto& thread : pool) {
+				thread.join();
+			}
+
+			std::error_code ec{};
+			std::filesystem::remove(path, ec);
+			std::signal(SIGINT, prev_int);
+			std::signal(SIGTERM, prev_term);
+
+			if (level > verbose::none) {
+				fmt::print("-- stopped; {} configs were kept in memory\n", state.cached_configs());
+			}
+			return 0;
+		}
+#endif
+	}  // namespace
+
+	int handle(std::string_view tool_name, args::arglist arguments, std::string_view description) {
+		std::optional<std::string> socket_path;
+		std::optional<std::filesystem::path> tax_config_path;
+		unsigned verbose_counter{};
+		unsigned workers{std::max(1u, std::thread::hardware_concurrency())};
+
+		args::null_translator tr{};
+		args::parser parser{as_str(description), {tool_name, arguments}, &tr};
+
+		parser.custom([&] { ++verbose_counter; }, "v")
+		    .help("log every request served, not only the failing ones")
+		    .multi()
+		    .opt();
+		parser.arg(socket_path, "socket")
+		    .meta("<path>")
+		    .help("select the path of the socket; defaults to qdra.sock in the cache directory");
+		parser.arg(tax_config_path, "tax-config")
+		    .meta("<path>")
+		    .help(
+		        "provide tax parameters file; will take precedent before data "
+		        "from repository and installation");
+		parser.arg(workers, "workers")
+		    .meta("<N>")
+		    .help("choose how many requests are served at the same time; defaults to number of cores")
+		    .opt();
+		parser.parse();
+
+		if (workers < 1) {
+			parser.error("--workers: at least one worker is needed");
+		}
+
+#ifdef _WIN32
+		fmt::print(stderr, "qdra serve: error: local sockets are not supported on this platform\n");
+		return 1;
+#else
+		auto const level = verbose{verbose_counter};
+		auto tax = load_tax_config(level, tax_config_path);
+		if (!tax) {
+			return 1;
+		}
+
+		auto raw_templates = quick_dra::templates::parse_yaml(platform::config_data_dir() / "templates.yaml"sv);
+		if (!raw_templates) {
+			// GCOV_EXCL_START
+			// test would need to break installation
+			return 1;
+		}  // GCOV_EXCL_STOP
+
+		resident_state state{*tax, compiled_templates::compile(*raw_templates)};
+		auto const path = socket_path ? std::filesystem::path{as_u8v(*socket_path)} : default_socket_path();
+		return run_server(path, workers, state, level);
+#endif
+	}
+}  // namespace quick_dra::builtin::serve
@@ -0,0 +1,159 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "serve_protocol.hpp"
+#include <fmt/format.h>
+#include <cctype>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/types.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include "xml/ctre_parsing.hpp"
+
+using namespace std::literals;
+
+namespace quick_dra::builtin::serve {
+	namespace {
+		struct field {
+			std::string key{};
+			std::optional<std::string> value{};
+		};
+
+		bool is_space(char c) noexcept { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+		std::optional<std::string> quoted_value(std::string_view& line) {
+			std::string result{};
+			line.remove_prefix(1);
+			while (!line.empty()) {
+				auto const c = line.front();
+				line.remove_prefix(1);
+				if (c == '"') return result;
+				if (c == '\\') {
+					if (line.empty()) break;
+					result.push_back(line.front());
+					line.remove_prefix(1);
+					continue;
+				}
+				result.push_back(c);
+			}
+			return std::nullopt;
+		}
+
+		std::optional<std::vector<field>> split_fields(std::string_view line, std::string& error) {
+			std::vector<field> result{};
+			while (true) {
+				while (!line.empty() && is_space(line.front()))
+					line.remove_prefix(1);
+				if (line.empty()) break;
+
+				auto& item = result.emplace_back();
+				while (!line.empty() && !is_space(line.front()) && line.front() != '=') {
+					item.key.push_back(line.front());
+					line.remove_prefix(1);
+				}
+
+				if (line.empty() || line.front() != '=') continue;
+				line.remove_prefix(1);
+
+				if (!line.empty() && line.front() == '"') {
+					item.value = quoted_value(line);
+					if (!item.value) {
+						error = fmt::format("{}: missing closing quote", item.key);
+						return std::nullopt;
+					}
+					continue;
+				}
+
+				auto& value = item.value.emplace();
+				while (!line.empty() && !is_space(line.front())) {
+					value.push_back(line.front());
+					line.remove_prefix(1);
+				}
+			}
+			return result;
+		}
+	}  // namespace
+
+	std::optional<request> parse_request(std::string_view line, std::string& error) {
+		auto const fields = split_fields(line, error);
+		if (!fields) return std::nullopt;
+
+		request result{};
+		bool has_config{false};
+		bool has_month{false};
+
+		for (auto const& [key, value] : *fields) {
+			if (key == "pretty"sv && !value) {
+				result.indent_xml = true;
+				continue;
+			}
+
+			if (!value) {
+				error = fmt::format("{}: expected {}=<value>", key, key);
+				return std::nullopt;
+			}
+
+			if (key == "config"sv) {
+				result.config_path = as_u8v(*value);
+				has_config = true;
+			} else if (key == "month"sv) {
+				auto const date = xml::parse_month(*value);
+				if (!date) {
+					error = fmt::format("month: expected YYYY-MM, got `{}'", *value);
+					return std::nullopt;
+				}
+				result.date = *date;
+				has_month = true;
+			} else if (key == "serial"sv) {
+				if (!from_chars(*value, result.report_index) || result.report_index < 1 ||
+				    result.report_index > 99) {
+					error = "serial: serial number must be in range 1 to 99 inclusive"s;
+					return std::nullopt;
+				}
+			} else if (key == "today"sv) {
+				result.today = xml::parse_date(*value);
+				if (!result.today) {
+					error = fmt::format("today: expected YYYY-MM-DD, got `{}'", *value);
+					return std::nullopt;
+				}
+			} else if (key == "out"sv) {
+				result.output = as_u8v(*value);
+			} else {
+				error = fmt::format("unknown field `{}'", key);
+				return std::nullopt;
+			}
+		}
+
+		if (!has_config || result.config_path.empty()) {
+			error = "config: path to the config is required"s;
+			return std::nullopt;
+		}
+
+		if (!has_month) {
+			error = "month: month of the report is required"s;
+			return std::nullopt;
+		}
+
+		return result;
+	}
+
+	reply reply::stored(std::filesystem::path const& path) { return {file, as_str(path.u8string())}; }
+
+	std::string reply::to_wire() const {
+		switch (type) {
+			case file:
+				return fmt::format("file {}\n", payload);
+			case document:
+				return fmt::format("xml {}\n{}", payload.size(), payload);
+			case error:
+				break;
+		}
+
+		auto message = payload;
+		for (auto& c : message) {
+			if (c == '\n' || c == '\r') c = ' ';
+		}
+		return fmt::format("error {}\n", message);
+	}
+}  // namespace quick_dra::builtin::serve
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace quick_dra::builtin::serve {
+	// One line of the request, e.g.
+	//
+	//   config=/srv/payroll/acme.yaml month=2026-01 serial=2 out=/srv/out/acme.xml
+	//
+	// Values with spaces are put in double quotes, with \" and \\ inside.
+	struct request {
+		std::filesystem::path config_path{};
+		std::chrono::year_month date{};
+		unsigned report_index{1};
+		std::optional<std::chrono::year_month_day> today{};
+		std::optional<std::filesystem::path> output{};
+		bool indent_xml{false};
+	};
+
+	std::optional<request> parse_request(std::string_view line, std::string& error);
+
+	// Either `file <path>`, `xml <size>` followed by the document itself, or
+	// `error <message>`; each header ends with a new line.
+	struct reply {
+		enum kind { error, file, document };
+
+		kind type{error};
+		std::string payload{};
+
+		static reply failed(std::string message) { return {error, std::move(message)}; }
+		static reply stored(std::filesystem::path const& path);
+		static reply inline_document(std::string contents) { return {document, std::move(contents)}; }
+
+		std::string to_wire() const;
+	};
+}  // namespace quick_dra::builtin::serve
@@ -7,6 +7,7 @@
 #include <quick_dra/base/paths.hpp>
 #include <quick_dra/conv/args_parser.hpp>
 #include <string>
+#include <utility>
 #include "ctre_parsing.hpp"
 
 namespace quick_dra::builtin::xml {
@@ -19,6 +20,9 @@ namespace quick_dra::builtin::xml {
 		unsigned report_index{1};
 		bool indent_xml{false};
 		bool print_info{false};
+		std::optional<std::filesystem::path> trace_path;
+		bool print_stats{false};
+		bool json_lines{false};
 
 		args::null_translator tr{};
 		args::parser parser{as_str(description), arguments, &tr};
@@ -58,6 +62,15 @@ namespace quick_dra::builtin::xml {
 		parser.set<std::true_type>(print_info, "info")
 		    .help("end terminal printout with a summary of amounts to pay")
 		    .opt();
+		parser.arg(trace_path, "trace")
+		    .meta("<file>")
+		    .help("write the time spent in each phase as a Chrome/Perfetto trace");
+		parser.set<std::true_type>(print_stats, "stats")
+		    .help("end terminal printout with the allocations made in each phase")
+		    .opt();
+		parser.set<std::true_type>(json_lines, "json-lines")
+		    .help("print the verbose output and the errors as JSON lines")
+		    .opt();
 		parser.parse();
 
 		if (report_index < 1 || report_index > 99) {
@@ -78,6 +91,9 @@ namespace quick_dra::builtin::xml {
 		        .report_index = report_index,
 		        .date = date,
 		        .indent_xml = indent_xml,
-		        .print_info = print_info};
+		        .print_info = print_info,
+		        .trace_path = std::move(trace_path),
+		        .print_stats = print_stats,
+		        .json_lines = json_lines};
 	}  // GCOV_EXCL_LINE[WIN32]
 }  // namespace quick_dra::builtin::xml
@@ -38,4 +38,26 @@ namespace quick_dra::builtin::xml {
 		}
 		return std::nullopt;
 	}
+
+	std::optional<std::chrono::year_month> parse_month(std::string_view arg) {
+		auto const m = ctre::match<
+		    "^"
+		    "([12][0-9]{3})-"
+		    "([1-9]|0[0-9]|1[012])"
+		    "$">(arg);
+		if (auto const& [whole, year_str, month_str] = m; whole) {
+			int year{};
+			unsigned month{};
+			from_chars(year_str, year);
+			from_chars(month_str, month);
+
+			auto const result = std::chrono::year{year} / std::chrono::month{month};
+			if (!result.ok()) {
+				return std::nullopt;
+			}
+
+			return result;
+		}
+		return std::nullopt;
+	}
 }  // namespace quick_dra::builtin::xml
@@ -6,7 +6,9 @@
 #include <chrono>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace quick_dra::builtin::xml {
 	std::optional<std::chrono::year_month_day> parse_date(std::optional<std::string> const& arg);
+	std::optional<std::chrono::year_month> parse_month(std::string_view arg);
 }  // namespace quick_dra::builtin::xml
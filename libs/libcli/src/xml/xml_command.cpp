@@ -2,10 +2,15 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <fmt/format.h>
+#include <fmt/std.h>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <memory_resource>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/base/verbose.hpp>
 #include <quick_dra/cli/commands.hpp>
 #include <quick_dra/conv/args_parser.hpp>
@@ -24,17 +29,19 @@ using namespace std::literals;
 namespace quick_dra::builtin::xml {
 	int handle(std::string_view tool_name, args::arglist arguments, std::string_view description) {
 		auto const opt = options_from_cli({tool_name, arguments}, description);
+		trace::session tracing{opt.trace_path};
+		// the debug records are the ones asked for with -v
+		diag::output_scope output{opt.verbose_level > verbose::none ? diag::level::debug : diag::level::info,
+		                          opt.json_lines ? diag::format::json_lines : diag::format::text};
 
-		if (opt.verbose_level > verbose::none) {
-			fmt::print("-- config used: {}\n", opt.config_path.string());
-		}
+		diag::debug("-- config used: {}", opt.config_path.string());
 
 		if (opt.verbose_level >= verbose::names_and_summary) {
-			fmt::print("-- today: {}-{:02}-{:02}\n", static_cast<int>(opt.today.year()),
-			           static_cast<unsigned>(opt.today.month()), static_cast<unsigned>(opt.today.day()));
+			diag::debug("-- today: {}-{:02}-{:02}", static_cast<int>(opt.today.year()),
+			            static_cast<unsigned>(opt.today.month()), static_cast<unsigned>(opt.today.day()));
 		}
 
-		fmt::print("-- report: #{} {}-{:02}\n", opt.report_index, static_cast<int>(opt.date.year()),
+		diag::info("-- report: #{} {}-{:02}", opt.report_index, static_cast<int>(opt.date.year()),
 		           static_cast<unsigned>(opt.date.month()));
 
 		auto cfg = parse_config(opt.verbose_level, opt.date, opt.config_path, opt.tax_config_path);
@@ -49,21 +56,42 @@ namespace quick_dra::builtin::xml {
 			return 1;
 		}  // GCOV_EXCL_STOP
 
-		auto const forms = prepare_form_set(opt.verbose_level, opt.report_index, opt.date, opt.today, *cfg);
-		auto const file = build_file_set(opt.verbose_level, forms, compiled_templates::compile(*raw_templates));
+		// From here on, all the output goes through the sink, so the lines
+		// of the forms can be written out by a background thread. The
+		// config parsers above still print some of their errors directly.
+		diag::async_writer writer{};
+
+		// the forms and the document are released in one go, together with the arena
+		std::pmr::monotonic_buffer_resource arena{};
+		auto const forms =
+		    prepare_form_set(opt.verbose_level, opt.report_index, opt.date, opt.today, *cfg, nullptr, &arena);
+		auto const file =
+		    build_file_set(opt.verbose_level, forms, compiled_templates::compile(*raw_templates), &arena);
 		store_xml(file, set_filename(opt.report_index, opt.date), opt.indent_xml);
 
-		if (!opt.print_info && opt.verbose_level != verbose::none) {
-			fmt::print("-- use --info to print summary of amounts to pay\n");
+		if (!opt.print_info) {
+			diag::debug("-- use --info to print summary of amounts to pay");
 		}
 
+		// the summary and the statistics are printed past the sink
+		diag::flush();
+
 		if (opt.print_info) {
 			auto const lines = gather_summary_data(forms);
 			print_summary(lines);
 		}
 
+		if (opt.print_stats) {
+			alloc::print_report(forms.size());
+		}
+
 		if (opt.verbose_level >= verbose::last) {
-			fmt::print("-- (no more info to unveil)\n");
+			diag::debug("-- (no more info to unveil)");
+		}
+
+		if (!tracing.finish()) {
+			diag::error("Quick-DRA: error: could not write {}", *opt.trace_path);
+			return 1;
 		}
 
 		return 0;
@@ -21,6 +21,7 @@ known commands:
  insured       manage the insured people data
  list          list people in configuration
  xml           produce KEDU 5.6 XML file
+ serve         produce KEDU files on request from a local socket
 )"sv,
 	    },
 	    {
@@ -47,6 +48,7 @@ known commands:
  insured       manage the insured people data
  list          list people in configuration
  xml           produce KEDU 5.6 XML file
+ serve         produce KEDU files on request from a local socket
 )"sv,
 	    },
 	    {
@@ -67,6 +69,7 @@ known commands:
  insured manage the insured people data
  list    list people in configuration
  xml     produce KEDU 5.6 XML file
+ serve   produce KEDU files on request from a local socket
 )"sv,
 	        .returncode = 1,
 	    },
@@ -151,6 +151,14 @@ wypadkowe:
 	            },
 	    },
 
+	    // journal
+	    {
+	        .name = "journal is disabled by default"sv,
+	        .args = "config journal --config .quick_dra.yaml"sv,
+	        .config = "wersja: 2"sv,
+	        .stdout = "\033[0;90mJournal is \033[mdisabled\n"sv,
+	    },
+
 	    // unhappy paths:
 	    {
 	        .name = "upgrade has invalid date"sv,
@@ -190,6 +198,16 @@ Quick-DRA: error: .quick_dra.yaml needs to be updated before continuing
 	        .config = "wersja: 2"sv,
 	        .stderr = R"(usage: qdra config accident [-h] [--config <path>] [--on <yyyy/mm>] [<percent>]
 qdra config accident: error: <percent>: expecting a number with 0.01 increment, with optional % suffix
+)"sv,
+	        .returncode = 2,
+	    },
+	    {
+	        .name = "journal actions are exclusive"sv,
+	        .args = "config journal --config .quick_dra.yaml --enable --compact"sv,
+	        .config = "wersja: 2"sv,
+	        .stderr =
+	            R"(usage: qdra config journal [-h] [--config <path>] [--enable] [--disable] [--compact] [--every <N>]
+qdra config journal: error: --enable, --disable and --compact are mutually exclusive
 )"sv,
 	        .returncode = 2,
 	    },
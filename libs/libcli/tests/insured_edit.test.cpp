@@ -92,7 +92,7 @@ ubezpieczeni:
 	        .args =
 	            "insured edit -y --config .quick_dra.yaml --first Antoni --last Kowalski --social-id 78070707132 --scale 1/1 --salary 6500PLN"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: one of --pos and --find argument is required
 )"sv,
 	        .returncode = 2,
@@ -102,7 +102,7 @@ qdra insured edit: error: one of --pos and --find argument is required
 	        .args =
 	            "insured edit --pos 1 --find something -y --config .quick_dra.yaml --first Antoni --last Kowalski --social-id 78070707132 --scale 1/1 --salary 6500PLN"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: only one of --pos and --find is allowed
 )"sv,
 	        .returncode = 2,
@@ -146,7 +146,7 @@ ubezpieczeni:
 	        .args = "insured edit --find EH0123456 --config .quick_dra.yaml"sv,
 	        .stderr =
 	            R"(Quick-DRA: file .quick_dra.yaml will be created as needed.
-usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: --find: could not find any record using `EH0123456'
 )"sv,
 	        .returncode = 2,
@@ -268,7 +268,7 @@ ubezpieczeni:
     pensja: 7500 zł
 )"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: at least one of --social-id, --id-card and --passport is required with -y
 )"sv,
 	        .returncode = 2,
@@ -293,7 +293,7 @@ ubezpieczeni:
     pensja: 7500 zł
 )"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: at least one of --social-id, --id-card and --passport is required with -y
 )"sv,
 	        .returncode = 2,
@@ -318,7 +318,7 @@ ubezpieczeni:
     pensja: 7500 zł
 )"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: at least one of --social-id, --id-card and --passport is required with -y
 )"sv,
 	        .returncode = 2,
@@ -328,7 +328,7 @@ qdra insured edit: error: at least one of --social-id, --id-card and --passport
 	        .args = R"(insured edit -y --pos 1 --on 2026/14)"sv,
 	        .config = "wersja: 1"sv,
 	        .stderr =
-	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
+	            R"(usage: qdra insured edit [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y] [--first <name>] [--last <name>] [--social-id <number>] [--id-card <number>] [--passport <number>] [--title <code>] [--on <yyyy/mm>] [--scale <num>/<den>] [--salary <zł>]
 qdra insured edit: error: --on expected YYYY/MM, got `2026/14`
 )"sv,
 	        .returncode = 2,
@@ -0,0 +1,87 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "run.hpp"
+
+namespace quick_dra::builtin::testing::insured_import {
+	static constexpr runnable_testcase tests[] = {
+	    {
+	        .name = "list --pipe output"sv,
+	        .args = "insured import --config .quick_dra.yaml people.tsv"sv,
+	        .config_name = "people.tsv"sv,
+	        .config = "1\tSurname\tName\t1\tAAA000000\t0110 0 0\t1/4\tminimal for a given month\t2026/1\n"sv,
+	        .stdout = "\033[0;90mImported \033[m1\033[0;90m insured person(s)\033[m\n"sv,
+	        .stderr =
+	            R"(Quick-DRA: file .quick_dra.yaml will be created as needed.
+)"sv,
+	        .writes =
+	            new_file{
+	                .name = ".quick_dra.yaml"sv,
+	                .cmp = ".quick_dra.insured.AAA000000_25%.yaml"sv,
+	            },
+	    },
+	    {
+	        .name = "csv with defaults"sv,
+	        .args = "insured import --config .quick_dra.yaml --on 2026/1 people.csv"sv,
+	        .config_name = "people.csv"sv,
+	        .config = R"(# pos,last name,first name,kind,document,title,scale,salary,since
+P,Nowak,Jan,1,ABC523456,7680002466,26211012346
+1,"Surname",Name,1,AAA000000,0110 0 0,1/4
+)"sv,
+	        .stdout = "\033[0;90mImported \033[m1\033[0;90m insured person(s)\033[m\n"sv,
+	        .stderr =
+	            R"(Quick-DRA: file .quick_dra.yaml will be created as needed.
+)"sv,
+	        .writes =
+	            new_file{
+	                .name = ".quick_dra.yaml"sv,
+	                .cmp = ".quick_dra.insured.AAA000000_25%.yaml"sv,
+	            },
+	    },
+
+	    // unhappy paths:
+	    {
+	        .name = "every bad row is reported"sv,
+	        .args = "insured import --config .quick_dra.yaml people.csv"sv,
+	        .config_name = "people.csv"sv,
+	        .config = R"(1,Surname,Name,1,AAA000000,0110 0 0,,,
+2,Nowak,Jan,P,12345678901,0110 0 0,,,
+3,,Anna,2,XX,,,,
+4,Kowalski,Piotr,1,AAA000000,0110 0 0,1/2,9000 zł,2026/13
+5,Kowalski
+)"sv,
+	        .stderr =
+	            R"(Quick-DRA: file .quick_dra.yaml will be created as needed.
+people.csv:2: error: PESEL `12345678901` seems to be invalid
+people.csv:3: error: last name is missing
+people.csv:3: error: passport number `XX` seems to be invalid
+people.csv:3: error: insurance title is missing
+people.csv:4: error: expected YYYY/MM, got `2026/13`
+people.csv:5: error: expected between 5 and 9 columns, got 2
+Quick-DRA: error: 4 of 5 row(s) need fixing; nothing was imported
+)"sv,
+	        .returncode = 1,
+	    },
+	    {
+	        .name = "duplicated document"sv,
+	        .args = "insured import --config .quick_dra.yaml people.tsv"sv,
+	        .config_name = "people.tsv"sv,
+	        .config = "1\tSurname\tName\t1\tAAA000000\t0110 0 0\n"
+	                  "2\tSurname\tOther\t1\tAAA000000\t0110 0 0\n"sv,
+	        .stderr =
+	            R"(Quick-DRA: file .quick_dra.yaml will be created as needed.
+people.tsv:2: error: another person with document 1 AAA000000 is already present
+Quick-DRA: error: 1 of 2 row(s) need fixing; nothing was imported
+)"sv,
+	        .returncode = 1,
+	    },
+	    {
+	        .name = "missing input"sv,
+	        .args = "insured import --config .quick_dra.yaml people.tsv"sv,
+	        .stderr = "Quick-DRA: error: could not read people.tsv\n"sv,
+	        .returncode = 1,
+	    },
+	};
+
+	INSTANTIATE_TEST_SUITE_P(insured_import, cli_test, ::testing::ValuesIn(tests));
+}  // namespace quick_dra::builtin::testing::insured_import
@@ -96,7 +96,7 @@ ubezpieczeni:
     pensja: 7500 zł
 )"sv,
 	        .stderr =
-	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y]
+	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y]
 qdra insured remove: error: argument --pos must be between 1 and 3, inclusive
 )"sv,
 	        .returncode = 2,
@@ -121,7 +121,7 @@ ubezpieczeni:
     pensja: 7500 zł
 )"sv,
 	        .stderr =
-	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y]
+	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y]
 qdra insured remove: error: --find: could not find any record using `xyzzy'
 )"sv,
 	        .returncode = 2,
@@ -130,7 +130,7 @@ qdra insured remove: error: --find: could not find any record using `xyzzy'
 	        .name = "no find"sv,
 	        .args = "insured remove -y --config .quick_dra.yaml"sv,
 	        .stderr =
-	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y]
+	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y]
 qdra insured remove: error: one of --pos and --find argument is required
 )"sv,
 	        .returncode = 2,
@@ -139,7 +139,7 @@ qdra insured remove: error: one of --pos and --find argument is required
 	        .name = "find and pos"sv,
 	        .args = "insured remove --pos 1 --find something -y --config .quick_dra.yaml"sv,
 	        .stderr =
-	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [-y]
+	            R"(usage: qdra insured remove [-h] [--config <path>] [--pos <index>] [--find <keyword>] [--fuzzy] [-y]
 qdra insured remove: error: only one of --pos and --find is allowed
 )"sv,
 	        .returncode = 2,
@@ -205,11 +205,39 @@ ubezpieczeni:
 )"sv,
 	        .stdout = ""sv,
 	        .stderr =
-	            R"(usage: qdra list [-h] [--config <path>] [--find <keyword>] [--pipe] [-z]
+	            R"(usage: qdra list [-h] [--config <path>] [--find <keyword>] [--fuzzy] [--pipe] [-z]
 qdra list: error: --find: could not find any record using `xzyyz'
 )"sv,
 	        .returncode = 2,
 	    },
+	    {
+	        .name = "fuzzy search"sv,
+	        .args = "list --config .quick_dra.yaml --find iksinska --fuzzy"sv,
+	        .config = R"(wersja: 1
+płatnik:
+  nazwisko: 'Nowak, Marian'
+  paszport: AB4123456
+  nip: 7680002466
+  pesel: 26211012346
+ubezpieczeni:
+  - nazwisko: 'Iksiński, Piotr'
+    dowód: ABC523456
+    tytuł ubezpieczenia: 0110 0 0
+    wymiar: 1/4
+  - nazwisko: 'Iksiński, Jan'
+    paszport: EH0123456
+    tytuł ubezpieczenia: 0110 0 0
+    wymiar: 3/4
+    pensja: 9000 zł
+  - nazwisko: 'Iksińska, Maria'
+    tytuł ubezpieczenia: 0110 0 0
+    pesel: 26211012346
+    pensja: 7500 zł
+)"sv,
+	        .stdout =
+	            R"(#3: Maria Iksińska [P 26211012346] 7500 zł
+)"sv,
+	    },
 	    {
 	        .name = "pipe"sv,
 	        .args = "list --config .quick_dra.yaml --pipe"sv,
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <args/sys.hpp>
+#include <algorithm>
+#include <csignal>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "run.hpp"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#endif
+
+int tool(args::args_view const& arguments);
+
+namespace quick_dra::builtin::testing::serve {
+	static constexpr runnable_testcase tests[] = {
+	    {
+	        .name = "no workers"sv,
+	        .args = "serve --workers 0"sv,
+	        .stderr =
+	            R"(usage: qdra serve [-h] [-v ...] [--socket <path>] [--tax-config <path>] [--workers <N>]
+qdra serve: error: --workers: at least one worker is needed
+)"sv,
+	        .returncode = 2,
+	    },
+	};
+
+	INSTANTIATE_TEST_SUITE_P(serve, cli_test, ::testing::ValuesIn(tests));
+
+#ifndef _WIN32
+	namespace {
+		static constexpr auto config_yaml = R"(wersja: 1
+płatnik:
+  nazwisko: 'Nowak, Jan'
+  paszport: AB4123456
+  nip: 7680002466
+  pesel: 26211012346
+ubezpieczeni:
+  - nazwisko: 'Iksiński, Piotr'
+    tytuł ubezpieczenia: 0110 0 0
+    pesel: 50671500000
+)"sv;
+
+		class client {
+		public:
+			explicit client(std::filesystem::path const& path) {
+				sockaddr_un addr{};
+				addr.sun_family = AF_UNIX;
+				auto const native = path.native();
+				std::memcpy(addr.sun_path, native.c_str(), std::min(native.size() + 1, sizeof(addr.sun_path)));
+				fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+				if (::connect(fd_, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr)) < 0) {
+					::close(fd_);
+					fd_ = -1;
+				}
+			}
+			~client() {
+				if (fd_ >= 0) ::close(fd_);
+			}
+			client(client const&) = delete;
+			client& operator=(client const&) = delete;
+
+			bool connected() const noexcept { return fd_ >= 0; }
+
+			std::string ask(std::string_view line) {
+				auto const request = fmt::format("{}\n", line);
+				::send(fd_, request.data(), request.size(), 0);
+
+				auto header = read_until_eol();
+				if (header.starts_with("xml "sv)) {
+					auto const size = std::stoul(header.substr(4));
+					while (buffer_.size() < size && fill()) {
+					}
+					header.append(buffer_.substr(0, size));
+					buffer_.erase(0, size);
+				}
+				return header;
+			}
+
+		private:
+			bool fill() {
+				char chunk[4096];
+				auto const received = ::recv(fd_, chunk, sizeof(chunk), 0);
+				if (received <= 0) return false;
+				buffer_.append(chunk, static_cast<size_t>(received));
+				return true;
+			}
+
+			std::string read_until_eol() {
+				auto pos = buffer_.find('\n');
+				while (pos == std::string::npos && fill())
+					pos = buffer_.find('\n');
+				if (pos == std::string::npos) return std::exchange(buffer_, {});
+				auto result = buffer_.substr(0, pos + 1);
+				buffer_.erase(0, pos + 1);
+				return result;
+			}
+
+			int fd_{-1};
+			std::string buffer_{};
+		};
+
+		std::filesystem::path make_temp_dir() {
+			auto name = as_str((std::filesystem::temp_directory_path() / "qdraXXXXXX"sv).u8string());
+			return as_u8v(mkdtemp(name.data()));
+		}
+	}  // namespace
+
+	TEST(serve, round_trip) {
+		auto const dir = make_temp_dir();
+		auto const socket = dir / "qdra.sock"sv;
+		auto const config = dir / "payer.yaml"sv;
+		auto const output = dir / "out.xml"sv;
+		{
+			std::ofstream out{config};
+			out << config_yaml;
+		}
+
+		auto const socket_arg = as_str(socket.u8string());
+		std::string args_storage[] = {"serve"s, "--socket"s, socket_arg, "--workers"s, "2"s};
+		char* argv[] = {args_storage[0].data(), args_storage[1].data(), args_storage[2].data(),
+		                args_storage[3].data(), args_storage[4].data(), nullptr};
+
+		int returncode{-1};
+		std::thread server{[&] { returncode = tool({"qdra"sv, args::arglist{5u, argv}}); }};
+
+		for (int attempt = 0; attempt < 100 && !std::filesystem::exists(socket); ++attempt) {
+			std::this_thread::sleep_for(std::chrono::milliseconds{50});
+		}
+
+		if (std::filesystem::exists(socket)) {
+			auto const config_arg = as_str(config.u8string());
+			{
+				client first{socket};
+				EXPECT_TRUE(first.connected());
+
+				auto const inline_reply =
+				    first.ask(fmt::format("config=\"{}\" month=2025-12 serial=1 today=2026-01-01", config_arg));
+				EXPECT_TRUE(inline_reply.starts_with("xml "sv)) << inline_reply;
+				EXPECT_NE(inline_reply.find("<KEDU"sv), std::string::npos) << inline_reply;
+
+				auto const stored_reply = first.ask(fmt::format("config=\"{}\" month=2025-12 out=\"{}\" pretty",
+				                                                config_arg, as_str(output.u8string())));
+				EXPECT_EQ(fmt::format("file {}\n", as_str(output.u8string())), stored_reply);
+				EXPECT_TRUE(std::filesystem::is_regular_file(output));
+
+				EXPECT_EQ("error month: expected YYYY-MM, got `2025'\n"s,
+				          first.ask(fmt::format("config=\"{}\" month=2025", config_arg)));
+				auto const missing = dir / "nope.yaml"sv;
+				EXPECT_EQ(fmt::format("error cannot find {}\n", missing),
+				          first.ask(fmt::format("config=\"{}\" month=2025-12", as_str(missing.u8string()))));
+			}
+
+			// a second server leaves the running one alone
+			{
+				std::string second_storage[] = {"serve"s, "--socket"s, socket_arg};
+				char* second_argv[] = {second_storage[0].data(), second_storage[1].data(), second_storage[2].data(),
+				                       nullptr};
+				::testing::internal::CaptureStderr();
+				EXPECT_EQ(1, tool({"qdra"sv, args::arglist{3u, second_argv}}));
+				auto const err = ::testing::internal::GetCapturedStderr();
+				EXPECT_EQ(fmt::format("qdra serve: error: a server is already listening on {}\n", socket), err);
+
+				client again{socket};
+				EXPECT_TRUE(again.connected());
+				EXPECT_EQ("error month: expected YYYY-MM, got `2025'\n"s,
+				          again.ask(fmt::format("config=\"{}\" month=2025", config_arg)));
+			}
+
+			std::raise(SIGINT);
+		}
+
+		server.join();
+		EXPECT_EQ(0, returncode);
+		EXPECT_FALSE(std::filesystem::exists(socket));
+
+		std::error_code ec{};
+		std::filesystem::remove_all(dir, ec);
+	}
+#endif
+}  // namespace quick_dra::builtin::testing::serve
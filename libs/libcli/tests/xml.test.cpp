@@ -102,6 +102,65 @@ ubezpieczeni:
 	                .cmp = "quick-dra_202512-01.AB4123456_50671500000.xml"sv,
 	            },
 	    },
+	    {
+	        // the "--" lines between the forms are skipped; the cases below
+	        // check the text output is back
+	        .name = "json lines"sv,
+	        .args = "xml --pretty --today 2026-2-1 -vvvvv --json-lines --config .quick_dra.yaml"sv,
+	        .config = R"(wersja: 1
+płatnik:
+  nazwisko: "Nowak (HOME), Jan"
+  paszport: AB4123456
+  nip: 7680002466
+  pesel: 26211012346
+ubezpieczeni:
+  - nazwisko: Ubezpieczona, Osoba
+    tytuł ubezpieczenia: 0110 1 1
+    pesel: 50671500000
+    wymiar: 1/4
+    pensja: 8000
+)"sv,
+	        .stdout = R"({"level":"debug","form":"RCA","field":"today","message":"today: 2026/02/01"}
+{"level":"debug","form":"DRA","message":"DRA:"}
+{"level":"debug","form":"DRA","field":"accident_insurance","message":"accident_insurance:"}
+{"level":"debug","form":"DRA","field":"insured","message":"insured: 0.00 zł"}
+{"level":"debug","form":"DRA","field":"payer","message":"payer: 33.40 zł"}
+{"level":"debug","form":"DRA","field":"accident_insurance_contribution","message":"accident_insurance_contribution: 1.67%"}
+{"level":"debug","form":"DRA","field":"disability_insurance","message":"disability_insurance:"}
+{"level":"debug","form":"DRA","field":"insured","message":"insured: 30.00 zł"}
+{"level":"debug","form":"DRA","field":"payer","message":"payer: 130.00 zł"}
+{"level":"debug","form":"DRA","field":"health_insurance","message":"health_insurance:"}
+{"level":"debug","form":"DRA","field":"insured","message":"insured: 49.00 zł"}
+{"level":"debug","form":"DRA","field":"payer","message":"payer: 0.00 zł"}
+{"level":"debug","form":"DRA","field":"insurance_total","message":"insurance_total: 632.80 zł"}
+{"level":"debug","form":"DRA","field":"insured_count","message":"insured_count: 1"}
+{"level":"debug","form":"DRA","field":"payer","message":"payer:"}
+{"level":"debug","form":"DRA","field":"birthday","message":"birthday: 2026/01/10"}
+{"level":"debug","form":"DRA","field":"document","message":"document: 'AB4123456'"}
+{"level":"debug","form":"DRA","field":"document_kind","message":"document_kind: '2'"}
+{"level":"debug","form":"DRA","field":"first","message":"first: 'JAN'"}
+{"level":"debug","form":"DRA","field":"last","message":"last: 'NOWAK (HOME)'"}
+{"level":"debug","form":"DRA","field":"short_name","message":"short_name: 'JAN NOWAK (HOME)'"}
+{"level":"debug","form":"DRA","field":"social_id","message":"social_id: '26211012346'"}
+{"level":"debug","form":"DRA","field":"tax_id","message":"tax_id: '7680002466'"}
+{"level":"debug","form":"DRA","field":"pension_insurance","message":"pension_insurance:"}
+{"level":"debug","form":"DRA","field":"insured","message":"insured: 195.20 zł"}
+{"level":"debug","form":"DRA","field":"payer","message":"payer: 195.20 zł"}
+{"level":"debug","form":"DRA","field":"serial","message":"serial:"}
+{"level":"debug","form":"DRA","field":"DATE","message":"DATE: 2026/01"}
+{"level":"debug","form":"DRA","field":"NN","message":"NN: '01'"}
+{"level":"debug","form":"DRA","field":"tax_total","message":"tax_total: 0.00 zł"}
+{"level":"debug","form":"DRA","field":"today","message":"today: 2026/02/01"}
+{"level":"info","message":"output: quick-dra_202601-01.xml"}
+{"level":"debug","message":"use --info to print summary of amounts to pay"}
+)"sv,
+	        .writes =
+	            new_file{
+	                .name = "quick-dra_202601-01.xml"sv,
+	                .cmp = "homes/var_home/quick-dra_202601-01.xml"sv,
+	            },
+	        .check_stdout = compare::end,
+	    },
 	    {
 	        .name = "one quarter"sv,
 	        .args = "xml --pretty --info --today 2026-2-1 --config .quick_dra.yaml -vvv"sv,
@@ -933,7 +992,7 @@ ubezpieczeni:
     pesel: 50671500000
 )"sv,
 	        .stderr =
-	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info]
+	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info] [--trace <file>] [--stats] [--json-lines]
 qdra xml: error: --today: expected YYYY-MM-DD, got `2026-14-34'
 )"sv,
 	        .returncode = 2,
@@ -953,7 +1012,7 @@ ubezpieczeni:
     pesel: 50671500000
 )"sv,
 	        .stderr =
-	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info]
+	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info] [--trace <file>] [--stats] [--json-lines]
 qdra xml: error: --today: expected YYYY-MM-DD, got `something'
 )"sv,
 	        .returncode = 2,
@@ -973,7 +1032,7 @@ ubezpieczeni:
     pesel: 50671500000
 )"sv,
 	        .stderr =
-	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info]
+	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info] [--trace <file>] [--stats] [--json-lines]
 qdra xml: error: --today: expected YYYY-MM-DD, got `2026-02-31'
 )"sv,
 	        .returncode = 2,
@@ -993,7 +1052,7 @@ ubezpieczeni:
     pesel: 50671500000
 )"sv,
 	        .stderr =
-	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info]
+	            R"(usage: qdra xml [-h] [-v ...] [--config <path>] [--tax-config <path>] [-n <NN>] [-m <month>] [--today <YYYY-MM-DD>] [--pretty] [--info] [--trace <file>] [--stats] [--json-lines]
 qdra xml: error: serial number must be in range 1 to 99 inclusive
 )"sv,
 	        .returncode = 2,
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <functional>
+#include <quick_dra/conv/search_index.hpp>
 #include <quick_dra/models/types.hpp>
 #include <span>
 #include <string>
@@ -16,16 +17,23 @@ namespace quick_dra {
 		none,
 		direct,
 		partial,
+		fuzzy,
 	};
 
 	match_level match_payer_from_keyword(std::string_view search_keyword, partial::payer_t const& payer);
 
+	// same as above, but also accepts names without diacritics and with typos
+	match_level match_payer_fuzzy(std::string_view search_keyword, partial::payer_t const& payer);
+
 	std::vector<unsigned> search_insured_from_position(unsigned position,
 	                                                   std::span<partial::insured_t> insured,
 	                                                   std::function<void(std::string const&)> const& on_error);
 
+	// The index is built once by the caller and used for all the lookups;
+	// with its fuzzy part enabled, the closest of the fuzzy matches are used
+	// as the last resort.
 	std::vector<unsigned> search_insured_from_keyword(std::string_view search_keyword,
-	                                                  std::span<partial::insured_t> insured,
+	                                                  insured_index const& index,
 	                                                  match_level payer,
 	                                                  match_level* level,
 	                                                  std::function<void(std::string const&)> const& on_error);
@@ -35,6 +43,7 @@ namespace quick_dra {
 	inline static std::vector<unsigned> search_insured_from_term(
 	    search_term const& term,
 	    std::span<partial::insured_t> insured,
+	    insured_index const& index,
 	    match_level payer,
 	    match_level* level,
 	    std::function<void(std::string const&)> const& on_error) {
@@ -42,6 +51,6 @@ namespace quick_dra {
 			return search_insured_from_position(std::get<unsigned>(term), insured, on_error);
 		}
 
-		return search_insured_from_keyword(std::get<std::string>(term), insured, payer, level, on_error);
+		return search_insured_from_keyword(std::get<std::string>(term), index, payer, level, on_error);
 	}
 }  // namespace quick_dra
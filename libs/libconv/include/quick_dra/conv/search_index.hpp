@@ -0,0 +1,125 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <quick_dra/models/types.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace quick_dra {
+	struct search_key {
+		std::string key{};
+		unsigned position{};
+
+		auto operator<=>(search_key const&) const noexcept = default;
+	};
+
+	// Upper-cases ASCII and replaces Latin-1 and Latin Extended-A letters
+	// with their base letter, so "Żółkiewski" and "zolkiewski" both become
+	// "ZOLKIEWSKI"; anything else is copied as-is.
+	std::string fold_for_search(std::string_view text);
+
+	// Levenshtein distance between the two, or `limit + 1`, if it would be
+	// any larger than the limit.
+	unsigned bounded_distance(std::string_view lhs, std::string_view rhs, unsigned limit);
+
+	struct fuzzy_match {
+		unsigned distance{};
+		unsigned position{};
+
+		auto operator<=>(fuzzy_match const&) const noexcept = default;
+	};
+
+	// Trigrams of the folded keys, each with the list of keys it appears in.
+	// A lookup only visits the keys sharing enough trigrams with the keyword
+	// to be within the edit distance allowed for its length, and computes
+	// the distance for those keys alone.
+	class fuzzy_index {
+	public:
+		static fuzzy_index build(std::span<search_key const> keys);
+
+		// `folded key<TAB>position` lines, in the order of the key ids, then
+		// the trigrams section with `trigram<TAB>key ids` lines
+		void format(std::string& text) const;
+		static std::optional<fuzzy_index> parse(std::span<std::string_view const> lines, size_t size);
+
+		// incremental updates, with the upper-cased keys of the person
+		void insert(unsigned position, std::span<std::string const> keys);
+		void update(unsigned position, std::span<std::string const> keys);
+		void erase(unsigned position);
+
+		// sorted by the distance, then by the position; one match per position
+		std::vector<fuzzy_match> find(std::string_view keyword) const;
+
+		// how many edits are tolerated in a folded keyword of given length
+		static unsigned max_distance(size_t length) noexcept;
+
+	private:
+		void add_key(unsigned position, std::string_view key);
+		void remove_key(unsigned key_id);
+		void remove_keys(unsigned position);
+
+		std::vector<std::string> keys_{};
+		std::vector<unsigned> owners_{};
+		// sorted, each with the ids of the keys having it
+		std::vector<std::uint32_t> grams_{};
+		std::vector<std::vector<unsigned>> postings_{};
+	};
+
+	// Upper-cased document, first and last names of the insured, kept sorted
+	// for the whole-key and starts-with lookups, and kept a second time with
+	// every key reversed, for the ends-with lookups.
+	//
+	// The index can be stored next to the config (as `<config>.index`), with
+	// both arrays and the trigrams, if built, and is only trusted while the
+	// config and its journal are the ones it was stored with.
+	class insured_index {
+	public:
+		using entry = search_key;
+
+		static insured_index build(std::span<partial::insured_t const> insured);
+		static std::optional<insured_index> load(std::filesystem::path const& config_path);
+		// with `fuzzy`, the fuzzy part is enabled, and stored, if it was not
+		static insured_index load_or_build(std::filesystem::path const& config_path,
+		                                   std::span<partial::insured_t const> insured,
+		                                   bool fuzzy = false);
+		bool store(std::filesystem::path const& config_path) const;
+		static std::filesystem::path path_for(std::filesystem::path const& config_path);
+
+		// upper-cased document, first and last name, whichever are present
+		static std::vector<std::string> keys_of(partial::person const& person);
+
+		size_t size() const noexcept { return size_; }
+
+		// incremental updates, mirroring the edits done to the insured list
+		void insert(unsigned position, partial::person const& person);
+		void update(unsigned position, partial::person const& person);
+		void erase(unsigned position);
+
+		// both expect the keyword upper-cased already; positions are sorted
+		std::vector<unsigned> find_exact(std::string_view upper_keyword) const;
+		std::vector<unsigned> find_partial(std::string_view upper_keyword) const;
+
+		// the trigrams are built here, unless loaded with the index; from
+		// then on, they follow the updates and are stored with the rest
+		void enable_fuzzy();
+		fuzzy_index const* fuzzy() const noexcept { return fuzzy_ && fuzzy_enabled_ ? &*fuzzy_ : nullptr; }
+
+	private:
+		void add_keys(unsigned position, std::span<std::string const> keys);
+		void remove_keys(unsigned position);
+		void rebuild_reversed();
+
+		size_t size_{};
+		std::vector<entry> forward_{};
+		std::vector<entry> reversed_{};
+		std::optional<fuzzy_index> fuzzy_{};
+		bool fuzzy_enabled_{};
+	};
+}  // namespace quick_dra
@@ -0,0 +1,349 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <algorithm>
+#include <charconv>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/conv/search_index.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quick_dra {
+	namespace {
+		// Base letters for U+00C0 to U+017F; a dot keeps the original letter
+		static constexpr std::string_view kLatinFolding =
+		    // U+00C0: À-ß
+		    "AAAAAA.CEEEEIIIIDNOOOOO.OUUUUY.."
+		    // U+00E0: à-ÿ
+		    "AAAAAA.CEEEEIIIIDNOOOOO.OUUUUY.Y"
+		    // U+0100: Ā-ĥ
+		    "AAAAAACCCCCCCCDDDDEEEEEEEEEEGGGGGGGGHH"
+		    // U+0126: Ħ-ő
+		    "HHIIIIIIIIII..JJKKKLLLLLLLLLLNNNNNNNNNOOOOOO"
+		    // U+0152: Œ-ſ
+		    "..RRRRRRSSSSSSSSTTTTTTUUUUUUUUUUUUWWYYYZZZZZZS"sv;
+		static_assert(kLatinFolding.size() == 0x180 - 0xC0);
+
+		static constexpr size_t kGramSize = 3;
+		static constexpr auto kTrigramSection = "trigrams"sv;
+
+		std::uint32_t gram_at(std::string_view padded, size_t offset) noexcept {
+			return (std::uint32_t{static_cast<unsigned char>(padded[offset])} << 16) |
+			       (std::uint32_t{static_cast<unsigned char>(padded[offset + 1])} << 8) |
+			       std::uint32_t{static_cast<unsigned char>(padded[offset + 2])};
+		}
+
+		// two spaces in front make the first letters count more than the
+		// last ones, which is how names are usually misspelled
+		void append_grams(std::string_view folded, std::vector<std::uint32_t>& out) {
+			std::string padded{};
+			padded.reserve(folded.size() + 3);
+			padded.append("  "sv).append(folded).push_back(' ');
+			for (size_t offset = 0; offset + kGramSize <= padded.size(); ++offset) {
+				out.push_back(gram_at(padded, offset));
+			}
+		}
+
+		std::vector<std::uint32_t> grams_of(std::string_view folded) {
+			std::vector<std::uint32_t> result{};
+			append_grams(folded, result);
+			std::sort(result.begin(), result.end());
+			result.erase(std::unique(result.begin(), result.end()), result.end());
+			return result;
+		}
+
+		template <typename Number>
+		bool parse_number(std::string_view text, Number& out, int base = 10) {
+			auto const end = text.data() + text.size();
+			auto const [ptr, ec] = std::from_chars(text.data(), end, out, base);
+			return ec == std::errc{} && ptr == end;
+		}
+
+		unsigned distance_within(std::string_view lhs,
+		                         std::string_view rhs,
+		                         unsigned limit,
+		                         std::vector<unsigned>& row) {
+			auto const over = limit + 1;
+			auto const length_diff = lhs.size() > rhs.size() ? lhs.size() - rhs.size() : rhs.size() - lhs.size();
+			if (length_diff > limit) return over;
+			if (lhs.size() < rhs.size()) std::swap(lhs, rhs);
+
+			row.resize(rhs.size() + 1);
+			for (unsigned col = 0; col < row.size(); ++col) {
+				row[col] = col;
+			}
+
+			for (size_t line = 1; line <= lhs.size(); ++line) {
+				auto diagonal = row[0];
+				row[0] = static_cast<unsigned>(line);
+				auto best = row[0];
+				for (size_t col = 1; col < row.size(); ++col) {
+					auto const above = row[col];
+					auto const cost = lhs[line - 1] == rhs[col - 1] ? 0u : 1u;
+					row[col] = std::min({above + 1, row[col - 1] + 1, diagonal + cost});
+					diagonal = above;
+					best = std::min(best, row[col]);
+				}
+				// every later row can only grow from here
+				if (best > limit) return over;
+			}
+
+			return std::min(row.back(), over);
+		}
+	}  // namespace
+
+	std::string fold_for_search(std::string_view text) {
+		std::string result{};
+		result.reserve(text.size());
+
+		auto const bytes = text.size();
+		for (size_t index = 0; index < bytes; ++index) {
+			auto const ch = static_cast<unsigned char>(text[index]);
+			if (ch < 0x80) {
+				result.push_back(ch >= 'a' && ch <= 'z' ? static_cast<char>(ch - 'a' + 'A') : static_cast<char>(ch));
+				continue;
+			}
+
+			// both blocks are encoded in two bytes, from C3 80 to C5 BF
+			if (ch >= 0xC3 && ch <= 0xC5 && index + 1 < bytes) {
+				auto const next = static_cast<unsigned char>(text[index + 1]);
+				if ((next & 0xC0) == 0x80) {
+					auto const code_point = ((ch & 0x1Fu) << 6) | (next & 0x3Fu);
+					auto const folded = kLatinFolding[code_point - 0xC0];
+					if (folded != '.') {
+						result.push_back(folded);
+						++index;
+						continue;
+					}
+				}
+			}
+
+			result.push_back(static_cast<char>(ch));
+		}
+
+		return result;
+	}
+
+	unsigned bounded_distance(std::string_view lhs, std::string_view rhs, unsigned limit) {
+		std::vector<unsigned> row{};
+		return distance_within(lhs, rhs, limit, row);
+	}
+
+	unsigned fuzzy_index::max_distance(size_t length) noexcept {
+		if (length < 8) return 1;
+		if (length < 12) return 2;
+		return 3;
+	}
+
+	fuzzy_index fuzzy_index::build(std::span<search_key const> keys) {
+		fuzzy_index result{};
+		result.keys_.reserve(keys.size());
+		result.owners_.reserve(keys.size());
+
+		std::vector<std::pair<std::uint32_t, unsigned>> pairs{};
+		for (auto const& [key, position] : keys) {
+			auto const key_id = static_cast<unsigned>(result.keys_.size());
+			result.keys_.push_back(fold_for_search(key));
+			result.owners_.push_back(position);
+
+			for (auto const gram : grams_of(result.keys_.back())) {
+				pairs.emplace_back(gram, key_id);
+			}
+		}
+
+		std::sort(pairs.begin(), pairs.end());
+
+		for (auto const& [gram, key_id] : pairs) {
+			if (result.grams_.empty() || result.grams_.back() != gram) {
+				result.grams_.push_back(gram);
+				result.postings_.emplace_back();
+			}
+			result.postings_.back().push_back(key_id);
+		}
+
+		return result;
+	}
+
+	void fuzzy_index::format(std::string& text) const {
+		auto out = std::back_inserter(text);
+		for (size_t key_id = 0; key_id < keys_.size(); ++key_id) {
+			fmt::format_to(out, "{}\t{}\n", keys_[key_id], owners_[key_id]);
+		}
+
+		fmt::format_to(out, "{}\n", kTrigramSection);
+		for (size_t gram_index = 0; gram_index < grams_.size(); ++gram_index) {
+			fmt::format_to(out, "{:06x}\t{}\n", grams_[gram_index], fmt::join(postings_[gram_index], " "));
+		}
+	}
+
+	std::optional<fuzzy_index> fuzzy_index::parse(std::span<std::string_view const> lines, size_t size) {
+		auto const trigrams = std::find(lines.begin(), lines.end(), kTrigramSection);
+		if (trigrams == lines.end()) return std::nullopt;
+		auto const section = static_cast<size_t>(trigrams - lines.begin());
+
+		fuzzy_index result{};
+		for (auto const line : lines.first(section)) {
+			auto const tab = line.rfind('\t');
+			unsigned position{};
+			if (tab == std::string_view::npos || !parse_number(line.substr(tab + 1), position) || position >= size) {
+				return std::nullopt;
+			}
+
+			result.keys_.emplace_back(line.substr(0, tab));
+			result.owners_.push_back(position);
+		}
+
+		for (auto const line : lines.subspan(section + 1)) {
+			if (line.empty()) continue;
+
+			auto const tab = line.find('\t');
+			std::uint32_t gram{};
+			if (tab == std::string_view::npos || !parse_number(line.substr(0, tab), gram, 16) ||
+			    (!result.grams_.empty() && result.grams_.back() >= gram)) {
+				return std::nullopt;
+			}
+
+			std::vector<unsigned> key_ids{};
+			for (auto const id : split_sv(line.substr(tab + 1), ' '_sep)) {
+				unsigned key_id{};
+				if (!parse_number(id, key_id) || key_id >= result.keys_.size()) return std::nullopt;
+				key_ids.push_back(key_id);
+			}
+			if (key_ids.empty()) return std::nullopt;
+
+			result.grams_.push_back(gram);
+			result.postings_.push_back(std::move(key_ids));
+		}
+
+		return result;
+	}
+
+	void fuzzy_index::insert(unsigned position, std::span<std::string const> keys) {
+		for (auto& owner : owners_) {
+			if (owner >= position) ++owner;
+		}
+
+		for (auto const& key : keys) {
+			add_key(position, key);
+		}
+	}
+
+	void fuzzy_index::update(unsigned position, std::span<std::string const> keys) {
+		remove_keys(position);
+		for (auto const& key : keys) {
+			add_key(position, key);
+		}
+	}
+
+	void fuzzy_index::erase(unsigned position) {
+		remove_keys(position);
+		for (auto& owner : owners_) {
+			if (owner > position) --owner;
+		}
+	}
+
+	std::vector<fuzzy_match> fuzzy_index::find(std::string_view keyword) const {
+		auto const folded = fold_for_search(keyword);
+		if (folded.size() < kGramSize) return {};
+
+		auto const grams = grams_of(folded);
+
+		// a single edit can only break the three trigrams going over it
+		auto const limit = max_distance(folded.size());
+		auto const wanted = grams.size() > kGramSize * limit ? grams.size() - kGramSize * limit : 1u;
+
+		// a key shows up once per trigram it shares with the keyword, so the
+		// work follows the postings visited, not the size of the roster
+		std::vector<unsigned> candidates{};
+		for (auto const gram : grams) {
+			auto const it = std::lower_bound(grams_.begin(), grams_.end(), gram);
+			if (it == grams_.end() || *it != gram) continue;
+
+			auto const& key_ids = postings_[static_cast<size_t>(it - grams_.begin())];
+			candidates.insert(candidates.end(), key_ids.begin(), key_ids.end());
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		std::vector<fuzzy_match> result{};
+		std::vector<unsigned> row{};
+		for (auto first = candidates.begin(); first != candidates.end();) {
+			auto const key_id = *first;
+			auto const last = std::find_if(first, candidates.end(), [key_id](unsigned id) { return id != key_id; });
+			auto const hits = static_cast<size_t>(last - first);
+			first = last;
+			if (hits < wanted) continue;
+
+			auto const distance = distance_within(folded, keys_[key_id], limit, row);
+			if (distance <= limit) {
+				result.push_back({.distance = distance, .position = owners_[key_id]});
+			}
+		}
+
+		// keep the closest key of each person
+		std::sort(result.begin(), result.end(),
+		          [](fuzzy_match const& lhs, fuzzy_match const& rhs) {
+			          return std::pair{lhs.position, lhs.distance} < std::pair{rhs.position, rhs.distance};
+		          });
+		result.erase(std::unique(result.begin(), result.end(),
+		                         [](fuzzy_match const& lhs, fuzzy_match const& rhs) {
+			                         return lhs.position == rhs.position;
+		                         }),
+		             result.end());
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	void fuzzy_index::add_key(unsigned position, std::string_view key) {
+		auto const key_id = static_cast<unsigned>(keys_.size());
+		keys_.push_back(fold_for_search(key));
+		owners_.push_back(position);
+
+		for (auto const gram : grams_of(keys_.back())) {
+			auto const it = std::lower_bound(grams_.begin(), grams_.end(), gram);
+			auto const gram_index = it - grams_.begin();
+			if (it == grams_.end() || *it != gram) {
+				grams_.insert(it, gram);
+				postings_.emplace(postings_.begin() + gram_index);
+			}
+			postings_[static_cast<size_t>(gram_index)].push_back(key_id);
+		}
+	}
+
+	// the last key takes the place of the removed one, so the ids stay dense
+	void fuzzy_index::remove_key(unsigned key_id) {
+		auto const last = static_cast<unsigned>(keys_.size() - 1);
+
+		for (auto const gram : grams_of(keys_[key_id])) {
+			auto const gram_index = std::lower_bound(grams_.begin(), grams_.end(), gram) - grams_.begin();
+			auto& key_ids = postings_[static_cast<size_t>(gram_index)];
+			std::erase(key_ids, key_id);
+			if (key_ids.empty()) {
+				grams_.erase(grams_.begin() + gram_index);
+				postings_.erase(postings_.begin() + gram_index);
+			}
+		}
+
+		if (key_id != last) {
+			for (auto const gram : grams_of(keys_[last])) {
+				auto const gram_index = std::lower_bound(grams_.begin(), grams_.end(), gram) - grams_.begin();
+				auto& key_ids = postings_[static_cast<size_t>(gram_index)];
+				std::replace(key_ids.begin(), key_ids.end(), last, key_id);
+			}
+			keys_[key_id] = std::move(keys_[last]);
+			owners_[key_id] = owners_[last];
+		}
+
+		keys_.pop_back();
+		owners_.pop_back();
+	}
+
+	void fuzzy_index::remove_keys(unsigned position) {
+		// going down, the key moved into a freed id was already checked
+		for (auto key_id = static_cast<unsigned>(keys_.size()); key_id-- > 0;) {
+			if (owners_[key_id] == position) remove_key(key_id);
+		}
+	}
+}  // namespace quick_dra
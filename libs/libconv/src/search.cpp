@@ -3,34 +3,13 @@
 
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/conv/search.hpp>
+#include <quick_dra/conv/search_index.hpp>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace quick_dra {
 	namespace {
-		std::vector<std::string> make_record(partial::person const& person) {
-			std::vector<std::string> result{};
-			result.reserve(3);
-			for (auto const& field : {person.document, person.first_name, person.last_name}) {
-				auto const key = field.transform([](auto const& fld) { return to_upper(fld); });
-				if (key) {
-					result.push_back(std::move(*key));
-				}
-			}
-			return result;
-		}  // GCOV_EXCL_LINE[GCC]
-
-		auto make_records(std::span<partial::insured_t> insured) {
-			std::vector<std::vector<std::string>> records{};
-			records.reserve(insured.size());
-			for (auto const& person : insured) {
-				records.emplace_back(make_record(person));
-			}
-
-			return records;
-		}  // GCOV_EXCL_LINE[GCC]
-
 		bool record_matches(std::vector<std::string> const& record, auto const& predicate) {
 			for (auto const& field : record) {
 				if (predicate(field)) {
@@ -39,24 +18,10 @@ namespace quick_dra {
 			}
 			return false;
 		}
-
-		void search_insured_from_records(std::vector<unsigned>& found,
-		                                 std::vector<std::vector<std::string>> const& records,
-		                                 auto const& predicate) {
-			unsigned index = 0;
-
-			for (auto const& record : records) {
-				if (record_matches(record, predicate)) {
-					found.push_back(index);
-				}
-
-				++index;
-			}
-		}
 	}  // namespace
 
 	match_level match_payer_from_keyword(std::string_view search_keyword, partial::payer_t const& payer) {
-		auto const record = make_record(payer);
+		auto const record = insured_index::keys_of(payer);
 
 		auto const upper = to_upper(search_keyword);
 		auto const view = std::string_view{upper};
@@ -77,6 +42,24 @@ namespace quick_dra {
 		return match_level::none;
 	}
 
+	match_level match_payer_fuzzy(std::string_view search_keyword, partial::payer_t const& payer) {
+		auto const level = match_payer_from_keyword(search_keyword, payer);
+		if (level != match_level::none) return level;
+
+		auto const folded = fold_for_search(search_keyword);
+		// too short to tell a typo from another name
+		if (folded.size() < 3) return match_level::none;
+
+		auto const limit = fuzzy_index::max_distance(folded.size());
+		for (auto const& key : insured_index::keys_of(payer)) {
+			if (bounded_distance(folded, fold_for_search(key), limit) <= limit) {
+				return match_level::fuzzy;
+			}
+		}
+
+		return match_level::none;
+	}
+
 	std::vector<unsigned> search_insured_from_position(unsigned position,
 	                                                   std::span<partial::insured_t> insured,
 	                                                   std::function<void(std::string const&)> const& on_error) {
@@ -97,23 +80,27 @@ namespace quick_dra {
 	}
 
 	std::vector<unsigned> search_insured_from_keyword(std::string_view search_keyword,
-	                                                  std::span<partial::insured_t> insured,
+	                                                  insured_index const& index,
 	                                                  match_level payer,
 	                                                  match_level* level,
 	                                                  std::function<void(std::string const&)> const& on_error) {
-		std::vector<unsigned> result{};
-		auto const records = make_records(insured);
-
 		auto const upper = to_upper(search_keyword);
-		auto const view = std::string_view{upper};
 		if (level) *level = match_level::direct;
-		search_insured_from_records(result, records, [view](std::string const& field) { return field == view; });
+		auto result = index.find_exact(upper);
 
 		if (payer != match_level::direct && result.empty()) {
 			if (level) *level = match_level::partial;
-			search_insured_from_records(result, records, [view](std::string const& field) {
-				return field.starts_with(view) || field.ends_with(view);
-			});
+			result = index.find_partial(upper);
+		}
+
+		auto const fuzzy = index.fuzzy();
+		if (fuzzy && result.empty() && (payer == match_level::none || payer == match_level::fuzzy)) {
+			if (level) *level = match_level::fuzzy;
+			auto const matches = fuzzy->find(search_keyword);
+			for (auto const& match : matches) {
+				if (match.distance != matches.front().distance) break;
+				result.push_back(match.position);
+			}
 		}
 
 		if (result.empty()) {
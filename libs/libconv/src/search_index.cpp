@@ -0,0 +1,293 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/conv/search_index.hpp>
+#include <quick_dra/models/journal.hpp>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quick_dra {
+	namespace {
+		static constexpr auto kIndexHeader = "quick-dra index 3"sv;
+		static constexpr auto kForwardSection = "forward"sv;
+		static constexpr auto kReversedSection = "reversed"sv;
+		static constexpr auto kFuzzySection = "fuzzy"sv;
+
+		using entry = insured_index::entry;
+
+		std::string reversed(std::string_view key) { return {key.rbegin(), key.rend()}; }
+
+		auto key_less = [](entry const& lhs, std::string_view rhs) { return lhs.key < rhs; };
+
+		void insert_sorted(std::vector<entry>& entries, entry&& item) {
+			auto const it = std::upper_bound(entries.begin(), entries.end(), item);
+			entries.insert(it, std::move(item));
+		}
+
+		void find_prefixed(std::vector<entry> const& entries, std::string_view prefix, std::vector<unsigned>& out) {
+			for (auto it = std::lower_bound(entries.begin(), entries.end(), prefix, key_less);
+			     it != entries.end() && it->key.starts_with(prefix); ++it) {
+				out.push_back(it->position);
+			}
+		}
+
+		std::vector<unsigned> sorted_unique(std::vector<unsigned> positions) {
+			std::sort(positions.begin(), positions.end());
+			positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+			return positions;
+		}
+
+		// the index follows the config and the journal, if there is one
+		std::string config_stamp(std::filesystem::path const& config_path) {
+			return fmt::format("{}|{}", file_stamp(config_path), file_stamp(config_journal::path_for(config_path)));
+		}
+
+		template <typename Number>
+		bool parse_number(std::string_view text, Number& out) {
+			auto const end = text.data() + text.size();
+			auto const [ptr, ec] = std::from_chars(text.data(), end, out);
+			return ec == std::errc{} && ptr == end;
+		}
+
+		// `key<TAB>position` lines of one section, which must stay sorted
+		bool parse_entries(std::span<std::string_view const> lines, size_t size, std::vector<entry>& out) {
+			out.reserve(lines.size());
+			for (auto const line : lines) {
+				if (line.empty()) continue;
+
+				auto const tab = line.rfind('\t');
+				entry item{};
+				if (tab == std::string_view::npos || !parse_number(line.substr(tab + 1), item.position) ||
+				    item.position >= size) {
+					return false;
+				}
+
+				item.key.assign(line.substr(0, tab));
+				out.push_back(std::move(item));
+			}
+
+			return std::is_sorted(out.begin(), out.end());
+		}
+
+		void format_entries(std::string& text, std::string_view section, std::vector<entry> const& entries) {
+			fmt::format_to(std::back_inserter(text), "{}\n", section);
+			for (auto const& [key, position] : entries) {
+				fmt::format_to(std::back_inserter(text), "{}\t{}\n", key, position);
+			}
+		}
+	}  // namespace
+
+	std::vector<std::string> insured_index::keys_of(partial::person const& person) {
+		std::vector<std::string> result{};
+		result.reserve(3);
+		for (auto const& field : {person.document, person.first_name, person.last_name}) {
+			auto const key = field.transform([](auto const& fld) { return to_upper(fld); });
+			if (key) {
+				result.push_back(std::move(*key));
+			}
+		}
+		return result;
+	}  // GCOV_EXCL_LINE[GCC]
+
+	insured_index insured_index::build(std::span<partial::insured_t const> insured) {
+		insured_index result{};
+		result.size_ = insured.size();
+		result.forward_.reserve(insured.size() * 3);
+
+		unsigned position = 0;
+		for (auto const& person : insured) {
+			for (auto& key : keys_of(person)) {
+				result.forward_.push_back({.key = std::move(key), .position = position});
+			}
+			++position;
+		}
+
+		std::sort(result.forward_.begin(), result.forward_.end());
+		result.rebuild_reversed();
+		return result;
+	}
+
+	std::optional<insured_index> insured_index::load(std::filesystem::path const& config_path) {
+		std::ifstream in{path_for(config_path), std::ios::in | std::ios::binary};
+		if (!in) return std::nullopt;
+
+		std::ostringstream contents;
+		contents << in.rdbuf();
+		auto const text = std::move(contents).str();
+		auto const lines = split_sv(text, '\n'_sep);
+
+		if (lines.size() < 4 || lines[0] != kIndexHeader || lines[1] != config_stamp(config_path) ||
+		    lines[3] != kForwardSection) {
+			return std::nullopt;
+		}
+
+		insured_index result{};
+		if (!parse_number(lines[2], result.size_)) return std::nullopt;
+
+		// both arrays are stored, so nothing is sorted again here
+		auto const body = std::span{lines}.subspan(4);
+		auto const section = static_cast<size_t>(std::find(body.begin(), body.end(), kReversedSection) - body.begin());
+		auto const fuzzy = static_cast<size_t>(std::find(body.begin(), body.end(), kFuzzySection) - body.begin());
+		if (section >= fuzzy || !parse_entries(body.first(section), result.size_, result.forward_) ||
+		    !parse_entries(body.subspan(section + 1, fuzzy - section - 1), result.size_, result.reversed_) ||
+		    result.forward_.size() != result.reversed_.size()) {
+			return std::nullopt;
+		}
+
+		// the trigrams are only there, once someone needed them
+		if (fuzzy < body.size()) {
+			result.fuzzy_ = fuzzy_index::parse(body.subspan(fuzzy + 1), result.size_);
+			if (!result.fuzzy_) return std::nullopt;
+		}
+
+		return result;
+	}
+
+	insured_index insured_index::load_or_build(std::filesystem::path const& config_path,
+	                                           std::span<partial::insured_t const> insured,
+	                                           bool fuzzy) {
+		auto stored = load(config_path);
+		if (stored && stored->size() != insured.size()) stored.reset();
+		auto const complete = stored && (!fuzzy || stored->fuzzy_);
+
+		auto result = stored ? std::move(*stored) : build(insured);
+		if (fuzzy) result.enable_fuzzy();
+
+		std::error_code ec{};
+		if (!complete && std::filesystem::exists(config_path, ec)) {
+			// a missing index is only a slower lookup
+			result.store(config_path);
+		}
+
+		return result;
+	}
+
+	bool insured_index::store(std::filesystem::path const& config_path) const {
+		std::string text{};
+		text.reserve(forward_.size() * 48);
+		fmt::format_to(std::back_inserter(text), "{}\n{}\n{}\n", kIndexHeader, config_stamp(config_path), size_);
+		format_entries(text, kForwardSection, forward_);
+		format_entries(text, kReversedSection, reversed_);
+		if (fuzzy_) {
+			fmt::format_to(std::back_inserter(text), "{}\n", kFuzzySection);
+			fuzzy_->format(text);
+		}
+
+		// read-only commands store it too, so it is never seen half-written
+		auto const target = path_for(config_path);
+		auto temp = target;
+		temp += ".tmp"sv;
+
+		std::error_code ec{};
+		{
+			std::ofstream out{temp, std::ios::out | std::ios::binary | std::ios::trunc};
+			if (!out) return false;
+			out.write(text.data(), static_cast<std::streamsize>(text.size()));
+			out.flush();
+
+			if (!out) {
+				out.close();
+				std::filesystem::remove(temp, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(temp, target, ec);
+		if (ec) {
+			std::filesystem::remove(temp, ec);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::filesystem::path insured_index::path_for(std::filesystem::path const& config_path) {
+		auto result = config_path;
+		result += ".index"sv;
+		return result;
+	}
+
+	void insured_index::insert(unsigned position, partial::person const& person) {
+		for (auto* entries : {&forward_, &reversed_}) {
+			for (auto& item : *entries) {
+				if (item.position >= position) ++item.position;
+			}
+		}
+
+		++size_;
+		auto const keys = keys_of(person);
+		add_keys(position, keys);
+		if (fuzzy_) fuzzy_->insert(position, keys);
+	}
+
+	void insured_index::update(unsigned position, partial::person const& person) {
+		auto const keys = keys_of(person);
+		remove_keys(position);
+		add_keys(position, keys);
+		if (fuzzy_) fuzzy_->update(position, keys);
+	}
+
+	void insured_index::erase(unsigned position) {
+		remove_keys(position);
+
+		for (auto* entries : {&forward_, &reversed_}) {
+			for (auto& item : *entries) {
+				if (item.position > position) --item.position;
+			}
+		}
+
+		if (size_) --size_;
+		if (fuzzy_) fuzzy_->erase(position);
+	}
+
+	std::vector<unsigned> insured_index::find_exact(std::string_view upper_keyword) const {
+		std::vector<unsigned> result{};
+		for (auto it = std::lower_bound(forward_.begin(), forward_.end(), upper_keyword, key_less);
+		     it != forward_.end() && it->key == upper_keyword; ++it) {
+			result.push_back(it->position);
+		}
+		return sorted_unique(std::move(result));
+	}
+
+	std::vector<unsigned> insured_index::find_partial(std::string_view upper_keyword) const {
+		std::vector<unsigned> result{};
+		find_prefixed(forward_, upper_keyword, result);
+		find_prefixed(reversed_, reversed(upper_keyword), result);
+		return sorted_unique(std::move(result));
+	}
+
+	void insured_index::enable_fuzzy() {
+		if (!fuzzy_) fuzzy_ = fuzzy_index::build(forward_);
+		fuzzy_enabled_ = true;
+	}
+
+	void insured_index::add_keys(unsigned position, std::span<std::string const> keys) {
+		for (auto const& key : keys) {
+			insert_sorted(reversed_, {.key = reversed(key), .position = position});
+			insert_sorted(forward_, {.key = key, .position = position});
+		}
+	}
+
+	void insured_index::remove_keys(unsigned position) {
+		auto const is_removed = [position](entry const& item) { return item.position == position; };
+		std::erase_if(forward_, is_removed);
+		std::erase_if(reversed_, is_removed);
+	}
+
+	void insured_index::rebuild_reversed() {
+		reversed_.clear();
+		reversed_.reserve(forward_.size());
+		for (auto const& [key, position] : forward_) {
+			reversed_.push_back({.key = reversed(key), .position = position});
+		}
+		std::sort(reversed_.begin(), reversed_.end());
+	}
+}  // namespace quick_dra
@@ -8,6 +8,7 @@
 #include <concepts>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/conv/search.hpp>
+#include <quick_dra/conv/search_index.hpp>
 #include <sstream>
 #include <tuple>
 #include <variant>
@@ -21,6 +22,7 @@ namespace quick_dra {
 			CASE(match_level::none);
 			CASE(match_level::partial);
 			CASE(match_level::direct);
+			CASE(match_level::fuzzy);
 		}
 		return out << "match_level{" << std::to_underlying(level) << '}';
 	}
@@ -54,7 +56,7 @@ namespace quick_dra::testing {
 
 	class search : public ::testing::TestWithParam<testcase> {
 	public:
-		void test_lookup(testcase const& param, std::span<partial::insured_t> insured) {
+		void test_lookup(testcase const& param, std::span<partial::insured_t> insured, insured_index const& index) {
 			auto const& [term_view, expected_indexes_span, expected_output, expected_level, payer_matched] = param;
 			struct conv {
 				search_term operator()(unsigned index) const { return index; }
@@ -70,10 +72,11 @@ namespace quick_dra::testing {
 			std::vector<unsigned> actual{};
 			match_level level{match_level::none};
 			try {
-				actual = search_insured_from_term(term, insured, payer_matched, &level, [&log](std::string const& err) {
-					log = err;
-					throw carry_on{};
-				});
+				actual = search_insured_from_term(term, insured, index, payer_matched, &level,
+				                                  [&log](std::string const& err) {
+					                                  log = err;
+					                                  throw carry_on{};
+				                                  });
 			} catch (carry_on const&) {  // -V565
 				                         // pass
 			}
@@ -84,7 +87,7 @@ namespace quick_dra::testing {
 		}
 	};
 
-	TEST_P(search, lookup) {
+	static std::vector<partial::insured_t> make_insured() {
 		std::vector<partial::insured_t> insured{};
 		insured.reserve(std::size(people));
 		std::transform(std::begin(people), std::end(people), std::back_inserter(insured), [](auto const& person) {
@@ -102,8 +105,13 @@ namespace quick_dra::testing {
 			    std::nullopt,
 			};
 		});
+		return insured;
+	}
 
-		test_lookup(GetParam(), insured);
+	TEST_P(search, lookup) {
+		static auto insured = make_insured();
+		static auto const index = insured_index::build(insured);
+		test_lookup(GetParam(), insured, index);
 	}
 
 	static consteval search_term_view with(unsigned id) { return id; };
@@ -130,10 +138,11 @@ namespace quick_dra::testing {
 
 	TEST_F(search, pos_lookup_in_short_list) {
 		std::vector<partial::insured_t> insured{};
-		test_lookup({with(2), none, "insured list is empty"sv, match_level::none}, insured);
+		test_lookup({with(2), none, "insured list is empty"sv, match_level::none}, insured, insured_index{});
 
 		insured.emplace_back();
-		test_lookup({with(2), none, "argument --pos must be equal to 1"sv, match_level::none}, insured);
+		test_lookup({with(2), none, "argument --pos must be equal to 1"sv, match_level::none}, insured,
+		            insured_index::build(insured));
 	}
 
 	TEST_F(search, match_payer_from_keyword) {
@@ -153,5 +162,40 @@ namespace quick_dra::testing {
 		EXPECT_EQ(match_payer_from_keyword("abcdef"sv, person), match_level::direct);
 		EXPECT_EQ(match_payer_from_keyword("uiop"sv, person), match_level::partial);
 		EXPECT_EQ(match_payer_from_keyword("foobar"sv, person), match_level::none);
+
+		EXPECT_EQ(match_payer_fuzzy("abcdef"sv, person), match_level::direct);
+		EXPECT_EQ(match_payer_fuzzy("uiop"sv, person), match_level::partial);
+		EXPECT_EQ(match_payer_fuzzy("abcdeg"sv, person), match_level::fuzzy);
+		EXPECT_EQ(match_payer_fuzzy("foobar"sv, person), match_level::none);
+	}
+
+	TEST_F(search, fuzzy_keyword) {
+		auto const insured = make_insured();
+		auto index = insured_index::build(insured);
+		auto const ignore = [](std::string const&) {};
+
+		match_level level{match_level::none};
+		EXPECT_EQ(search_insured_from_keyword("iksinska"sv, index, match_level::none, &level, ignore),
+		          std::vector<unsigned>{});
+		EXPECT_EQ(level, match_level::none);
+
+		index.enable_fuzzy();
+		EXPECT_EQ(search_insured_from_keyword("iksinska"sv, index, match_level::none, &level, ignore),
+		          std::vector<unsigned>{2});
+		EXPECT_EQ(level, match_level::fuzzy);
+
+		EXPECT_EQ(search_insured_from_keyword("iksinski"sv, index, match_level::fuzzy, &level, ignore),
+		          (std::vector<unsigned>{0, 1}));
+		EXPECT_EQ(level, match_level::fuzzy);
+
+		// a better match in the payer wins over the fuzzy matches
+		EXPECT_EQ(search_insured_from_keyword("iksinska"sv, index, match_level::partial, &level, ignore),
+		          std::vector<unsigned>{});
+		EXPECT_EQ(level, match_level::none);
+
+		// the fuzzy matches are the last resort
+		EXPECT_EQ(search_insured_from_keyword("iksiń"sv, index, match_level::none, &level, ignore),
+		          (std::vector<unsigned>{0, 1, 2}));
+		EXPECT_EQ(level, match_level::partial);
 	}
 }  // namespace quick_dra::testing
@@ -0,0 +1,262 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/conv/search_index.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace quick_dra::testing {
+	namespace {
+		partial::insured_t person(std::string_view first_name, std::string_view last_name, std::string_view document) {
+			partial::insured_t result{};
+			result.first_name = std::string{first_name};
+			result.last_name = std::string{last_name};
+			result.kind = "1"s;
+			result.document = std::string{document};
+			return result;
+		}
+
+		std::vector<partial::insured_t> people() {
+			return {
+			    person("Piotr"sv, "Iksiński"sv, "ABC523456"sv),
+			    person("Jan"sv, "Iksiński"sv, "EH0123456"sv),
+			    person("Maria"sv, "Kowalska"sv, "ABD523456"sv),
+			};
+		}
+
+		std::filesystem::path temp_config(std::string_view name) {
+			auto const basename = std::filesystem::temp_directory_path() / name;
+			auto filename = basename;
+			auto counter = 0u;
+
+			while (exists(filename) || exists(insured_index::path_for(filename))) {
+				++counter;
+				filename = fmt::format("{}-{}", basename, counter);
+			}
+
+			std::ofstream out{filename, std::ios::out | std::ios::binary};
+			out << "wersja: 2\n";
+
+			return filename;
+		}
+
+		using positions = std::vector<unsigned>;
+	}  // namespace
+
+	TEST(search_index, exact) {
+		auto const index = insured_index::build(people());
+
+		EXPECT_EQ(index.size(), 3u);
+		EXPECT_EQ(index.find_exact(to_upper("Iksiński"sv)), (positions{0, 1}));
+		EXPECT_EQ(index.find_exact("MARIA"sv), (positions{2}));
+		EXPECT_EQ(index.find_exact("IKS"sv), positions{});
+	}
+
+	TEST(search_index, partial) {
+		auto const index = insured_index::build(people());
+
+		// starts with
+		EXPECT_EQ(index.find_partial("AB"sv), (positions{0, 2}));
+		EXPECT_EQ(index.find_partial("IKS"sv), (positions{0, 1}));
+		// ends with
+		EXPECT_EQ(index.find_partial("523456"sv), (positions{0, 2}));
+		EXPECT_EQ(index.find_partial("SKA"sv), (positions{2}));
+		EXPECT_EQ(index.find_partial("3456"sv), (positions{0, 1, 2}));
+		// neither
+		EXPECT_EQ(index.find_partial("523"sv), positions{});
+	}
+
+	TEST(search_index, incremental) {
+		auto insured = people();
+		auto index = insured_index::build(insured);
+
+		index.erase(0);
+		insured.erase(insured.begin());
+		EXPECT_EQ(index.size(), 2u);
+		EXPECT_EQ(index.find_exact("JAN"sv), (positions{0}));
+		EXPECT_EQ(index.find_exact("PIOTR"sv), positions{});
+
+		insured.insert(insured.begin() + 1, person("Anna"sv, "Nowak"sv, "XYZ000000"sv));
+		index.insert(1, insured[1]);
+		EXPECT_EQ(index.size(), 3u);
+		EXPECT_EQ(index.find_partial("NOW"sv), (positions{1}));
+		EXPECT_EQ(index.find_exact("MARIA"sv), (positions{2}));
+
+		insured[2].first_name = "Marianna"s;
+		index.update(2, insured[2]);
+		EXPECT_EQ(index.find_exact("MARIA"sv), positions{});
+		EXPECT_EQ(index.find_partial("ANNA"sv), (positions{1, 2}));
+
+		auto const rebuilt = insured_index::build(insured);
+		for (auto const keyword : {"JAN"sv, "ANNA"sv, "AB"sv, "456"sv, "000"sv, "IKSIŃSKI"sv}) {
+			EXPECT_EQ(index.find_partial(keyword), rebuilt.find_partial(keyword)) << keyword;
+			EXPECT_EQ(index.find_exact(keyword), rebuilt.find_exact(keyword)) << keyword;
+		}
+	}
+
+	TEST(search_index, fold_for_search) {
+		EXPECT_EQ(fold_for_search("Żółkiewski"sv), "ZOLKIEWSKI"sv);
+		EXPECT_EQ(fold_for_search("zażółć gęślą jaźń"sv), "ZAZOLC GESLA JAZN"sv);
+		EXPECT_EQ(fold_for_search("Łódź, Ærø"sv), "LODZ, ÆRO"sv);
+		EXPECT_EQ(fold_for_search("ABC523456"sv), "ABC523456"sv);
+	}
+
+	TEST(search_index, bounded_distance) {
+		EXPECT_EQ(bounded_distance("KITTEN"sv, "SITTING"sv, 3), 3u);
+		EXPECT_EQ(bounded_distance("KITTEN"sv, "SITTING"sv, 2), 3u);
+		EXPECT_EQ(bounded_distance("KOWALSKI"sv, "KOWALSKI"sv, 0), 0u);
+		EXPECT_EQ(bounded_distance("ANNA"sv, "KOWALSKA"sv, 2), 3u);
+	}
+
+	TEST(search_index, fuzzy) {
+		auto insured = people();
+		insured.push_back(person("Stanisław"sv, "Żółkiewski"sv, "XYZ000000"sv));
+		auto index = insured_index::build(insured);
+		EXPECT_FALSE(index.fuzzy());
+
+		index.enable_fuzzy();
+		ASSERT_TRUE(index.fuzzy());
+		auto const& fuzzy = *index.fuzzy();
+
+		auto const positions_of = [&fuzzy](std::string_view keyword) {
+			positions result{};
+			for (auto const& match : fuzzy.find(keyword)) {
+				result.push_back(match.position);
+			}
+			return result;
+		};
+
+		EXPECT_EQ(positions_of("zolkiewski"sv), (positions{3}));
+		EXPECT_EQ(positions_of("Zolkievsky"sv), (positions{3}));
+		EXPECT_EQ(positions_of("stanislaw"sv), (positions{3}));
+		EXPECT_EQ(positions_of("kowalsky"sv), (positions{2}));
+		EXPECT_EQ(positions_of("ABC523465"sv), (positions{0}));
+		EXPECT_EQ(positions_of("xy"sv), positions{});
+		EXPECT_EQ(positions_of("nobody"sv), positions{});
+
+		// closest first
+		auto const matches = fuzzy.find("abd523456"sv);
+		ASSERT_EQ(matches.size(), 2u);
+		EXPECT_EQ(matches[0], (fuzzy_match{.distance = 0, .position = 2}));
+		EXPECT_EQ(matches[1], (fuzzy_match{.distance = 1, .position = 0}));
+
+		// the updates carry over to the fuzzy part
+		index.erase(0);
+		EXPECT_EQ(index.fuzzy()->find("zolkiewski"sv).front().position, 2u);
+	}
+
+	TEST(search_index, fuzzy_incremental) {
+		auto insured = people();
+		auto index = insured_index::build(insured);
+		index.enable_fuzzy();
+
+		index.erase(0);
+		insured.erase(insured.begin());
+		insured.insert(insured.begin() + 1, person("Stanisław"sv, "Żółkiewski"sv, "XYZ000000"sv));
+		index.insert(1, insured[1]);
+		insured[2].last_name = "Kowalczyk"s;
+		index.update(2, insured[2]);
+		insured.push_back(person("Anna"sv, "Nowak"sv, "ABC523457"sv));
+		index.insert(3, insured[3]);
+		index.erase(0);
+		insured.erase(insured.begin());
+
+		auto rebuilt = insured_index::build(insured);
+		rebuilt.enable_fuzzy();
+		for (auto const keyword : {"zolkiewski"sv, "kowalczik"sv, "kowalska"sv, "abc523456"sv, "nowack"sv, "jan"sv}) {
+			EXPECT_EQ(index.fuzzy()->find(keyword), rebuilt.fuzzy()->find(keyword)) << keyword;
+		}
+	}
+
+	TEST(search_index, store_and_load) {
+		auto const path = temp_config("search_index.yaml"sv);
+		auto const insured = people();
+
+		EXPECT_FALSE(insured_index::load(path));
+
+		auto const built = insured_index::load_or_build(path, insured);
+		ASSERT_TRUE(exists(insured_index::path_for(path)));
+		auto temp = insured_index::path_for(path);
+		temp += ".tmp"sv;
+		EXPECT_FALSE(exists(temp));
+
+		auto const loaded = insured_index::load(path);
+		ASSERT_TRUE(loaded);
+		EXPECT_EQ(loaded->size(), built.size());
+		EXPECT_EQ(loaded->find_exact("JAN"sv), (positions{1}));
+		EXPECT_EQ(loaded->find_partial("SKA"sv), (positions{2}));
+
+		EXPECT_FALSE(loaded->fuzzy());
+
+		// the trigrams are stored, once asked for, and used from there on
+		auto const with_fuzzy = insured_index::load_or_build(path, insured, true);
+		ASSERT_TRUE(with_fuzzy.fuzzy());
+		auto stored = insured_index::load(path);
+		ASSERT_TRUE(stored);
+		EXPECT_FALSE(stored->fuzzy());
+		stored->enable_fuzzy();
+		ASSERT_TRUE(stored->fuzzy());
+		EXPECT_EQ(stored->fuzzy()->find("kowalsky"sv), with_fuzzy.fuzzy()->find("kowalsky"sv));
+
+		// and kept up to date with the rest
+		stored->update(1, person("Jan"sv, "Nowak"sv, "EH0123456"sv));
+		stored->store(path);
+		auto const updated = insured_index::load_or_build(path, insured, true);
+		ASSERT_TRUE(updated.fuzzy());
+		EXPECT_EQ(updated.fuzzy()->find("nowack"sv), (std::vector{fuzzy_match{.distance = 1, .position = 1}}));
+
+		{
+			std::ofstream out{path, std::ios::out | std::ios::binary | std::ios::app};
+			out << "# rewritten behind the index\n";
+		}
+		EXPECT_FALSE(insured_index::load(path));
+
+		std::filesystem::remove(insured_index::path_for(path));
+		std::filesystem::remove(path);
+	}
+
+	TEST(search_index, damaged) {
+		auto const path = temp_config("search_index.yaml"sv);
+		auto const insured = people();
+		insured_index::build(insured).store(path);
+
+		std::string text{};
+		{
+			std::ifstream in{insured_index::path_for(path), std::ios::in | std::ios::binary};
+			std::getline(in, text);
+			text.push_back('\n');
+			std::string stamp{};
+			std::getline(in, stamp);
+			text.append(stamp);
+		}
+		{
+			std::ofstream out{insured_index::path_for(path), std::ios::out | std::ios::binary | std::ios::trunc};
+			out << text << "\n3\nforward\nJAN\tfour\nreversed\nNAJ\t1\n";
+		}
+		EXPECT_FALSE(insured_index::load(path));
+
+		// the reversed keys are not rebuilt, when missing
+		{
+			std::ofstream out{insured_index::path_for(path), std::ios::out | std::ios::binary | std::ios::trunc};
+			out << text << "\n3\nforward\nJAN\t1\n";
+		}
+		EXPECT_FALSE(insured_index::load(path));
+
+		// neither are the trigrams, when damaged
+		{
+			std::ofstream out{insured_index::path_for(path), std::ios::out | std::ios::binary | std::ios::trunc};
+			out << text << "\n3\nforward\nJAN\t1\nreversed\nNAJ\t1\nfuzzy\nJAN\t1\ntrigrams\n204a41\t1\n";
+		}
+		EXPECT_FALSE(insured_index::load(path));
+
+		std::filesystem::remove(insured_index::path_for(path));
+		std::filesystem::remove(path);
+	}
+}  // namespace quick_dra::testing
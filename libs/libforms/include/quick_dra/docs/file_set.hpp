@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory_resource>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/docs/xml.hpp>
 #include <quick_dra/io/options.hpp>
@@ -12,5 +13,8 @@
 #include <vector>
 
 namespace quick_dra {
-	xml build_file_set(verbose level, std::vector<form> const& forms, compiled_templates const& templates);
+	xml build_file_set(verbose level,
+	                   std::vector<form> const& forms,
+	                   compiled_templates const& templates,
+	                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 }  // namespace quick_dra
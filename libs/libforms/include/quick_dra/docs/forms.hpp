@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <quick_dra/base/verbose.hpp>
+#include <quick_dra/lex/roster.hpp>
 #include <quick_dra/models/types.hpp>
 #include <string>
 #include <vector>
@@ -16,9 +21,76 @@ namespace quick_dra {
 		std::vector<calculated_section> fill(verbose level, std::vector<compiled_section> const& tmplt) const;
 	};
 
+	// The amounts on an RCA form depend only on the salary, the part-time
+	// scale and the tax parameters; the personal fields are added later.
+	struct rca_amounts {
+		currency baseline{};
+		contributions all_contributions{};
+		currency taxed_baseline{};
+		currency tax_owed{};
+		currency health_contribution{};
+		currency net{};
+		currency payer_gross{};
+	};
+
+	// Remembers the amounts for every employment profile seen, so insured
+	// people with the same salary and part-time scale (e.g. everybody on the
+	// minimal pay) are computed once. The entries are grouped by the tax
+	// parameters they were computed with, so one cache can be shared by any
+	// number of configs and months, also from several threads. A form set
+	// looks its segment up once; only the most recently used segments are
+	// kept, as a session of the GUI may visit any number of months.
+	class rca_cache {
+	public:
+		struct statistics {
+			size_t hits{};
+			size_t misses{};
+		};
+
+		class segment;
+		static constexpr size_t max_segments = 16;
+
+		rca_cache();
+		~rca_cache();
+		rca_cache(rca_cache const&) = delete;
+		rca_cache& operator=(rca_cache const&) = delete;
+
+		// stays valid for the caller, even if dropped from the cache meanwhile
+		std::shared_ptr<segment> segment_for(tax_parameters const& params);
+		rca_amounts lookup(segment& seg, currency salary, unsigned scale_num, unsigned scale_den, statistics& local);
+		statistics stats() const;
+		size_t segments() const;
+		void clear();
+
+	private:
+		mutable std::mutex mtx_{};
+		// the most recently used one last
+		std::vector<std::shared_ptr<segment>> segments_{};
+		std::atomic<size_t> hits_{};
+		std::atomic<size_t> misses_{};
+	};
+
+	// Without a cache, the one used is local to the call. The state of each
+	// form is allocated from the resource, and so are the sections filled
+	// from it later.
 	std::vector<form> prepare_form_set(verbose level,
 	                                   unsigned report_index,
 	                                   std::chrono::year_month const& date,
 	                                   std::chrono::year_month_day const& today,
-	                                   config const& cfg);
+	                                   config const& cfg,
+	                                   rca_cache* cache = nullptr,
+	                                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+	// The same, with the tax parameters of the month given apart from the
+	// config, so neither has to be copied to put them together.
+	std::vector<form> prepare_form_set(verbose level,
+	                                   unsigned report_index,
+	                                   std::chrono::year_month const& date,
+	                                   std::chrono::year_month_day const& today,
+	                                   config const& cfg,
+	                                   tax_parameters const& params,
+	                                   rca_cache* cache = nullptr,
+	                                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+	roster make_roster(std::chrono::year_month const& date, config const& cfg);
 }  // namespace quick_dra
@@ -11,6 +11,11 @@
 
 namespace quick_dra::locale {
 	static constexpr auto nbsp = std::string_view{"\xC2\xA0", 2};
+
+	// std::localeconv() of the calling thread, read again only after the
+	// locale changes
+	std::lconv const* system_conv();
+
 	struct symbol_decorator {
 		struct number_view {
 			std::string_view sign{};
@@ -36,7 +41,7 @@ namespace quick_dra::locale {
 		}
 
 		static symbol_decorator from(std::lconv const* conv, std::string_view space = nbsp);
-		static symbol_decorator from_locale(std::string_view space = nbsp) { return from(std::localeconv(), space); }
+		static symbol_decorator from_locale(std::string_view space = nbsp) { return from(system_conv(), space); }
 		static symbol_decorator symmetric(std::string_view symbol,
 		                                  std::string_view space,
 		                                  std::string_view positive_sign,
@@ -62,8 +67,8 @@ namespace quick_dra::locale {
 
 		static number_grouping monetary_from(std::lconv const* conv);
 		static number_grouping numeric_from(std::lconv const* conv);
-		static number_grouping monetary_from_locale() { return monetary_from(std::localeconv()); }
-		static number_grouping numeric_from_locale() { return numeric_from(std::localeconv()); }
+		static number_grouping monetary_from_locale() { return monetary_from(system_conv()); }
+		static number_grouping numeric_from_locale() { return numeric_from(system_conv()); }
 	};
 
 	struct formatter {
@@ -79,20 +84,20 @@ namespace quick_dra::locale {
 
 		static formatter monetary_from(std::lconv const* conv, std::string_view space = nbsp);
 		static formatter monetary_from_locale(std::string_view space = nbsp) {
-			return monetary_from(std::localeconv(), space);
+			return monetary_from(system_conv(), space);
 		}
 
 		static formatter percent_with(number_grouping const& grouping);
 		static formatter percent_from(std::lconv const* conv) {
 			return percent_with(number_grouping::numeric_from(conv));
 		}
-		static formatter percent_from_locale() { return percent_from(std::localeconv()); }
+		static formatter percent_from_locale() { return percent_from(system_conv()); }
 
 		static formatter PLN_with(number_grouping const& grouping, std::string_view space = nbsp);
 		static formatter PLN_from(std::lconv const* conv, std::string_view space = nbsp) {
 			return PLN_with(number_grouping::monetary_from(conv), space);
 		}
-		static formatter PLN_from_locale(std::string_view space = nbsp) { return PLN_from(std::localeconv(), space); }
+		static formatter PLN_from_locale(std::string_view space = nbsp) { return PLN_from(system_conv(), space); }
 
 		template <intmax_t Den>
 		static std::string from_system(currency_base<Den> const& curr, std::string_view space = nbsp) {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <map>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -14,8 +15,10 @@ using namespace std::literals;
 namespace quick_dra {
 	std::string xml_escape(std::string_view value);
 
+	// The children live in the memory resource given to E(); the nodes built
+	// for a whole file set may share one arena.
 	struct xml {
-		using vector = std::vector<xml>;
+		using vector = std::pmr::vector<xml>;
 
 		std::string tag;
 		std::map<std::string, std::string> attributes;
@@ -24,6 +27,10 @@ namespace quick_dra {
 		bool has_text() const noexcept { return std::holds_alternative<std::string>(inside); }
 		vector& children() { return std::get<vector>(inside); }
 		std::string const& text() const { return std::get<std::string>(inside); }
+		std::pmr::memory_resource* resource() const noexcept {
+			if (auto const list = std::get_if<vector>(&inside)) return list->get_allocator().resource();
+			return std::pmr::get_default_resource();
+		}
 
 		xml& with(std::string_view child);
 		xml& with(xml&& child);
@@ -53,7 +60,9 @@ namespace quick_dra {
 		indented_t indented(std::string_view indentation = "\t"sv) const { return {*this, indentation}; }
 	};
 
-	inline xml E(std::string_view tag, std::map<std::string, std::string> const& attributes = {}) {
-		return xml{{tag.data(), tag.size()}, attributes};
+	inline xml E(std::string_view tag,
+	             std::map<std::string, std::string> const& attributes = {},
+	             std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		return xml{{tag.data(), tag.size()}, attributes, xml::vector{resource}};
 	}
 }  // namespace quick_dra
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <quick_dra/base/verbose.hpp>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/models/model.hpp>
@@ -12,8 +13,11 @@
 namespace quick_dra {
 	struct xml;
 
-	xml build_kedu_doc(std::string_view program_name, std::string_view version);
+	xml build_kedu_doc(std::string_view program_name,
+	                   std::string_view version,
+	                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
+	// the document is allocated from the resource of the root
 	void attach_document(xml& root,
 	                     verbose level,
 	                     form const& form,
@@ -3,12 +3,27 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
 #include <optional>
+#include <stop_token>
 #include <string>
 #include <vector>
 
 namespace quick_dra {
+	// ETag and Last-Modified of a response; sent back as If-None-Match and
+	// If-Modified-Since, they turn the next request into a conditional one
+	struct http_validators {
+		std::string etag{};
+		std::string last_modified{};
+
+		bool empty() const noexcept { return etag.empty() && last_modified.empty(); }
+		bool operator==(http_validators const&) const noexcept = default;
+	};
+
 	struct http_response {
 		unsigned status{};
 		struct {
@@ -17,6 +32,7 @@ namespace quick_dra {
 		} content_type{};
 		std::string charset{};
 		std::vector<std::byte> content{};
+		http_validators validators{};
 
 		http_response& cleaned() noexcept {
 			status = 0;
@@ -24,9 +40,12 @@ namespace quick_dra {
 			content_type.subtype.clear();
 			charset.clear();
 			content.clear();
+			validators = {};
 			return *this;
 		}
 
+		bool not_modified() const noexcept { return status == 304; }
+
 		std::string_view text() const noexcept {
 			return {reinterpret_cast<char const*>(content.data()), content.size()};
 		}
@@ -34,5 +53,50 @@ namespace quick_dra {
 		explicit operator bool() const noexcept { return (status / 100) == 2; }
 	};
 
-	http_response http_get(std::string const& url);
+	struct http_request {
+		std::string url{};
+		http_validators conditions{};
+		// the whole transfer, and the connecting alone
+		std::chrono::milliseconds timeout{std::chrono::seconds{30}};
+		std::chrono::milliseconds connect_timeout{std::chrono::seconds{10}};
+		// a stop requested before the transfer ends gives an empty response
+		std::stop_token stop{};
+	};
+
+	// Called once per request, on the thread driving the client.
+	using http_callback = std::function<void(http_response&&)>;
+
+	// All requests of a client go through one curl multi handle: they run
+	// concurrently on a single thread, share the connection pool and the
+	// DNS cache and, where the server allows, one multiplexed HTTP/2
+	// connection. Unfinished requests get an empty response when the
+	// client is destroyed.
+	class http_client {
+	public:
+		struct limits {
+			long total_connections{8};
+			long host_connections{4};
+		};
+
+		http_client();
+		explicit http_client(limits const& config);
+		~http_client();
+		http_client(http_client const&) = delete;
+		http_client& operator=(http_client const&) = delete;
+
+		// the one used by http_get
+		static http_client& shared();
+
+		void get(http_request const& request, http_callback callback);
+		std::future<http_response> get(http_request const& request);
+
+	private:
+		struct impl;
+		std::unique_ptr<impl> impl_;
+	};
+
+	// blocks until the shared client is done with the request
+	http_response http_get(std::string const& url,
+	                       http_validators const& conditions = {},
+	                       std::stop_token stop = {});
 }  // namespace quick_dra
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <quick_dra/io/http.hpp>
+#include <stop_token>
+#include <string>
+
+namespace quick_dra {
+	struct http_cache_options {
+		// nothing is cached, when empty
+		std::filesystem::path dir{};
+		// how long a stored copy is used without asking the server
+		std::chrono::seconds ttl{std::chrono::hours{1}};
+	};
+
+	enum class http_cache_source {
+		network,      // downloaded (or failed to)
+		revalidated,  // server answered 304 to a conditional request
+		fresh,        // stored copy, still within the TTL
+		stale,        // stored copy, server could not be reached
+	};
+
+	struct cached_response {
+		http_response response{};
+		http_cache_source source{http_cache_source::network};
+	};
+
+	// A stored copy within the TTL is used as-is; an older one is revalidated
+	// with If-None-Match/If-Modified-Since, and used anyway when the server
+	// cannot be reached. Once stopped, nothing is written to the cache.
+	cached_response cached_http_get(std::string const& url,
+	                                http_cache_options const& options,
+	                                std::chrono::system_clock::time_point now = std::chrono::system_clock::now(),
+	                                std::stop_token stop = {});
+}  // namespace quick_dra
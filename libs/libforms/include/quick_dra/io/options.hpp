@@ -23,6 +23,9 @@ namespace quick_dra {
 		year_month date{};
 		bool indent_xml{};
 		bool print_info{};
+		std::optional<std::filesystem::path> trace_path{};
+		bool print_stats{};
+		bool json_lines{};
 	};
 
 	std::string set_filename(unsigned report_index, year_month const& date);
@@ -4,17 +4,77 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <map>
 #include <optional>
 #include <quick_dra/base/chrono.hpp>
 #include <quick_dra/base/verbose.hpp>
 #include <quick_dra/io/github_config.hpp>
+#include <quick_dra/io/http_cache.hpp>
 #include <quick_dra/models/types.hpp>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace quick_dra {
+	// Where the tax parameters are downloaded from and how long the copy in
+	// platform::cache_dir() is trusted. QUICK_DRA_TAX_CONFIG_URL and
+	// QUICK_DRA_TAX_CONFIG_TTL (in seconds) override the defaults, e.g. to
+	// point at a tools/server.py started in the root of a checkout.
+	struct tax_config_source {
+		std::string url{};
+		http_cache_options cache{};
+
+		static tax_config_source from_environment();
+	};
+
+	tax_config_source const& tax_config_download_source();
+	void tax_config_download_source(tax_config_source const&);
+
+	// The tax_config.yaml download, running in the background while the
+	// local files are parsed; without a response, when skipped. Dropped
+	// before the response is collected, it cancels the transfer and waits
+	// for the thread, so nothing outlives the caller.
+	struct tax_config_download {
+		std::string url{};
+		std::future<cached_response> response{};
+		std::jthread worker{};
+	};
+
+	tax_config_download start_tax_config_download(github_config download = github_config::download);
+
 	std::optional<tax_config> load_tax_config(verbose level,
 	                                          std::optional<std::filesystem::path> const& tax_config_path,
 	                                          github_config download = github_config::download);
+	std::optional<tax_config> load_tax_config(verbose level,
+	                                          std::optional<std::filesystem::path> const& tax_config_path,
+	                                          tax_config_download&& download);
+
+	// Every month between two changes of any of the tax_config timelines
+	// shares the same parameters; this table keeps one copy per such segment
+	// and finds the segment for a month with a binary search.
+	class resolved_tax_parameters {
+	public:
+		resolved_tax_parameters() = default;
+		explicit resolved_tax_parameters(tax_config const& config);
+
+		tax_parameters const& at(year_month const& key) const noexcept;
+		size_t size() const noexcept { return segments_.size(); }
+
+	private:
+		// sorted, starting months_[i] until months_[i + 1]
+		std::vector<year_month> months_{};
+		std::vector<tax_parameters> segments_{};
+		tax_parameters before_first_{};
+	};
+
+	// The parameters of the month, as kept by `resolved`. Only with the
+	// accident insurance overridden are they copied, to `storage`.
+	tax_parameters const& lookup_parameters(
+	    std::optional<tax_parameters>& storage,
+	    resolved_tax_parameters const& resolved,
+	    std::optional<std::map<std::chrono::year_month, percent>> const& accident_insurance_override,
+	    year_month const& key);
 	void lookup_parameters(tax_parameters& out,
 	                       tax_config const& config,
 	                       std::optional<std::map<std::chrono::year_month, percent>> const& accident_insurance_override,
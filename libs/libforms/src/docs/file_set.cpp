@@ -1,6 +1,9 @@
 // Copyright (c) 2026 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/diag.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/docs/file_set.hpp>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/docs/xml_builder.hpp>
@@ -8,16 +11,21 @@
 #include <vector>
 
 namespace quick_dra {
-	xml build_file_set(verbose level, std::vector<quick_dra::form> const& forms, compiled_templates const& templates) {
+	xml build_file_set(verbose level,
+	                   std::vector<quick_dra::form> const& forms,
+	                   compiled_templates const& templates,
+	                   std::pmr::memory_resource* resource) {
+		trace::span span{"build_file_set"sv};
+		alloc::scope accounting{alloc::phase::serialization};
 		auto doc_id = 0u;
-		auto root = build_kedu_doc(version::program, version::string);
+		auto root = build_kedu_doc(version::program, version::string, resource);
 
 		if (level == verbose::templates) {
 			templates.debug_print();
 		}
 
 		if (level == verbose::calculated_sections) {
-			fmt::print("-- filled forms:\n");
+			diag::debug("-- filled forms:");
 		}
 
 		for (auto const& form : forms) {
@@ -5,11 +5,21 @@
 #include <array>
 #include <chrono>
 #include <concepts>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/chars.hpp>
+#include <quick_dra/base/diag.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/lex/tax.hpp>
 #include <quick_dra/lex/validators.hpp>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -38,11 +48,12 @@ namespace quick_dra {
 			return result;
 		}
 
-		currency get_currency(global_object const& data, varname const& var) { return data.typed_value<currency>(var); }
+		currency get_currency(global_object const& data, compiletime_varname const& var) {
+			return data.typed_value<currency>(var);
+		}
 
-		void reduce_contribution(global_object& dst, global_object const& src, compiletime_varname path) {
+		void reduce_contribution(global_object& dst, global_object const& src, compiletime_varname const& var) {
 			static auto const dummy = global_object{};
-			auto const var = varname::parse(path.name);
 			auto& tgt = dst.get(var);
 			auto ptr = src.peek(var);
 			if (!ptr) ptr = &dummy;
@@ -58,8 +69,7 @@ namespace quick_dra {
 			tgt = contribution{.payer = from_payer + tgt_payer, .insured = from_insured + tgt_insured};
 		}
 
-		void reduce_currency(global_object& dst, global_object const& src, compiletime_varname path) {
-			auto const var = varname::parse(path.name);
+		void reduce_currency(global_object& dst, global_object const& src, compiletime_varname const& var) {
 			auto& tgt = dst.get(var);
 
 			tgt = get_currency(tgt, {}) + get_currency(src, var);
@@ -78,10 +88,12 @@ namespace quick_dra {
 		                 unsigned report_index,
 		                 year_month const& date,
 		                 year_month_day const& today,
-		                 config const& cfg) {
-			form result = {.key = kedu};
+		                 config const& cfg,
+		                 std::pmr::memory_resource* resource) {
+			form result = {.key = kedu, .state = global_object{global_object::allocator_type{resource}}};
 			auto& serial = result.state.get(var::serial);
-			serial.insert(var::NN, fmt::format("{:02}", report_index));
+			chars::buffer index{};
+			serial.insert(var::NN, std::string{index.data(), chars::write_padded(index.data(), report_index, 2)});
 			serial.insert(var::DATE, date);
 			result.state.insert(var::today, today);
 
@@ -101,58 +113,184 @@ namespace quick_dra {
 
 			return result;
 		}
+
+		rca_amounts calc_rca_amounts(currency salary,
+		                             unsigned scale_num,
+		                             unsigned scale_den,
+		                             rates const& contributions,
+		                             currency costs_of_obtaining,
+		                             tax_scale const& tax) {
+			auto const baseline = [salary, scale_num, scale_den]() {
+				auto const calc = salary.calc();
+				return calc_currency{calc.value * scale_num / scale_den}.rounded();
+			}();
+
+			auto const tax_lowering_amount = tax.lowering_amount();
+
+			auto const all_contributions = contributions.contribution_on(baseline);
+
+			auto const insured_contributions = all_contributions.insured();
+			auto const taxed_baseline = round_to_whole(clamp(baseline - (insured_contributions + costs_of_obtaining)));
+
+			auto const tax_owed = tax.owed(taxed_baseline);
+
+			auto const health_lowered = clamp(tax_owed - tax_lowering_amount);
+			auto const health_contribution_intermediate =
+			    (clamp(baseline - insured_contributions).calc() * contributions.health.insured).rounded();
+
+			auto const health_contribution =
+			    health_contribution_intermediate < health_lowered ? health_contribution_intermediate : health_lowered;
+
+			auto const cost_on_insured = insured_contributions + tax_owed + health_contribution;
+			auto const cost_on_payer = all_contributions.payer();
+
+			return {
+			    .baseline = baseline,
+			    .all_contributions = all_contributions,
+			    .taxed_baseline = taxed_baseline,
+			    .tax_owed = tax_owed,
+			    .health_contribution = health_contribution,
+			    .net = clamp(baseline - cost_on_insured),
+			    .payer_gross = baseline + cost_on_payer,
+			};
+		}
+
+		struct profile {
+			long long salary{};
+			unsigned scale_num{};
+			unsigned scale_den{};
+
+			constexpr bool operator==(profile const&) const noexcept = default;
+		};
+
+		struct profile_hash {
+			size_t operator()(profile const& key) const noexcept {
+				auto const scale = static_cast<unsigned long long>(key.scale_num) << 32 | key.scale_den;
+				return std::hash<long long>{}(key.salary) ^ (std::hash<unsigned long long>{}(scale) * 31);
+			}
+		};
 	}  // namespace
 
 	std::vector<calculated_section> form::fill(verbose level, std::vector<compiled_section> const& tmplt) const {
-		auto result = calculate(tmplt, state);
+		trace::span span{"fill"sv, key};
+		alloc::scope accounting{alloc::phase::calculation};
+		auto result = calculate(tmplt, state, state.get_allocator().resource());
 
 		if (level == verbose::calculated_sections) {
 			auto doc_id = state.typed_value(var::insured.document, ""s);
 			if (!doc_id.empty()) doc_id = fmt::format(" [{}]", doc_id);
-			fmt::print("--   ZUS{}{}\n", key, doc_id);
+			diag::form_scope context{key};
+			diag::debug("--   ZUS{}{}", key, doc_id);
 			debug_print(result);
 		}
 
 		return result;
 	}  // GCOV_EXCL_LINE[GCC]
 
+	class rca_cache::segment {
+	public:
+		explicit segment(tax_parameters const& params)
+		    : scale{params.scale},
+		      costs_of_obtaining{params.costs_of_obtaining.local},
+		      contributions{params.contributions},
+		      tax{params.scale} {}
+
+		bool matches(tax_parameters const& params) const noexcept {
+			return costs_of_obtaining == params.costs_of_obtaining.local && contributions == params.contributions &&
+			       scale == params.scale;
+		}
+
+		std::optional<rca_amounts> find(profile const& key) const {
+			std::shared_lock lock{mtx};
+			auto const it = entries.find(key);
+			if (it == entries.end()) return std::nullopt;
+			return it->second;
+		}
+
+		rca_amounts compute(profile const& key, currency salary) {
+			auto const amounts =
+			    calc_rca_amounts(salary, key.scale_num, key.scale_den, contributions, costs_of_obtaining, tax);
+			std::unique_lock lock{mtx};
+			entries.emplace(key, amounts);
+			return amounts;
+		}
+
+	private:
+		std::map<currency, percent> scale{};
+		currency costs_of_obtaining{};
+		rates contributions{};
+		tax_scale tax{};
+		mutable std::shared_mutex mtx{};
+		std::unordered_map<profile, rca_amounts, profile_hash> entries{};
+	};
+
+	rca_cache::rca_cache() = default;
+	rca_cache::~rca_cache() = default;
+
+	std::shared_ptr<rca_cache::segment> rca_cache::segment_for(tax_parameters const& params) {
+		std::lock_guard lock{mtx_};
+		auto const it = std::ranges::find_if(segments_, [&](auto const& seg) { return seg->matches(params); });
+		if (it != segments_.end()) {
+			std::rotate(it, std::next(it), segments_.end());
+			return segments_.back();
+		}
+
+		if (segments_.size() >= max_segments) segments_.erase(segments_.begin());
+		return segments_.emplace_back(std::make_shared<segment>(params));
+	}
+
+	rca_amounts rca_cache::lookup(segment& seg,
+	                              currency salary,
+	                              unsigned scale_num,
+	                              unsigned scale_den,
+	                              statistics& local) {
+		auto const key = profile{.salary = salary.value, .scale_num = scale_num, .scale_den = scale_den};
+		if (auto const amounts = seg.find(key)) {
+			hits_.fetch_add(1, std::memory_order_relaxed);
+			++local.hits;
+			return *amounts;
+		}
+
+		misses_.fetch_add(1, std::memory_order_relaxed);
+		++local.misses;
+		return seg.compute(key, salary);
+	}
+
+	rca_cache::statistics rca_cache::stats() const {
+		return {.hits = hits_.load(std::memory_order_relaxed), .misses = misses_.load(std::memory_order_relaxed)};
+	}
+
+	size_t rca_cache::segments() const {
+		std::lock_guard lock{mtx_};
+		return segments_.size();
+	}
+
+	void rca_cache::clear() {
+		std::lock_guard lock{mtx_};
+		segments_.clear();
+		hits_.store(0, std::memory_order_relaxed);
+		misses_.store(0, std::memory_order_relaxed);
+	}
+
 	form calc_rca(insured_t const& insured,
 	              unsigned report_index,
 	              year_month const& date,
 	              year_month_day const& today,
-	              config const& cfg) {
+	              config const& cfg,
+	              tax_parameters const& params,
+	              rca_cache& cache,
+	              rca_cache::segment& segment,
+	              rca_cache::statistics& stats,
+	              std::pmr::memory_resource* resource) {
 		auto const [_1, _2, cfg_part_time_scale, cfg_salary] = insured.lookup(date);
 		auto const scale = cfg_part_time_scale.value_or(ratio{});
 		auto const scale_num = std::max(1u, scale.num);
 		auto const scale_den = std::max(1u, scale.den);
-		auto const salary = cfg_salary.value_or(cfg.params.minimal_pay);
-
-		auto const baseline = [salary, scale_num, scale_den]() {
-			auto const calc = salary.calc();
-			return calc_currency{calc.value * scale_num / scale_den}.rounded();
-		}();
-
-		auto const tax_lowering_amount = calc_tax_lowering_amount(cfg.params.scale);
-
-		auto const all_contributions = cfg.params.contributions.contribution_on(baseline);
-
-		auto const insured_contributions = all_contributions.insured();
-		auto const taxed_baseline =
-		    round_to_whole(clamp(baseline - (insured_contributions + cfg.params.costs_of_obtaining.local)));
+		auto const salary = cfg_salary.value_or(params.minimal_pay);
 
-		auto const tax_owed = calc_tax_owed(cfg.params.scale, taxed_baseline);
+		auto const amounts = cache.lookup(segment, salary, scale_num, scale_den, stats);
 
-		auto const health_lowered = clamp(tax_owed - tax_lowering_amount);
-		auto const health_contribution_intermediate =
-		    (clamp(baseline - insured_contributions).calc() * cfg.params.contributions.health.insured).rounded();
-
-		auto const health_contribution =
-		    health_contribution_intermediate < health_lowered ? health_contribution_intermediate : health_lowered;
-
-		auto const cost_on_insured = insured_contributions + tax_owed + health_contribution;
-		auto const cost_on_payer = all_contributions.payer();
-
-		auto result = calc_common("RCA"s, report_index, date, today, cfg);
+		auto result = calc_common("RCA"s, report_index, date, today, cfg, resource);
 		auto& person = result.state.get(var::insured);
 		person.insert(var::document_kind, insured.kind);
 		person.insert(var::document, insured.document);
@@ -163,21 +301,21 @@ namespace quick_dra {
 		result.state.insert(var::scale.num, uint_value{scale_num});
 		result.state.insert(var::scale.den, uint_value{scale_den});
 
-		result.state.insert(var::salary.gross, baseline);
-		result.state.insert(var::salary.net, clamp(baseline - cost_on_insured));
-		result.state.insert(var::salary.payer_gross, baseline + cost_on_payer);
+		result.state.insert(var::salary.gross, amounts.baseline);
+		result.state.insert(var::salary.net, amounts.net);
+		result.state.insert(var::salary.payer_gross, amounts.payer_gross);
 
-		result.state.insert(var::health_insurance, all_contributions.health_insurance);
-		result.state.insert(var::pension_insurance, all_contributions.pension_insurance);
-		result.state.insert(var::disability_insurance, all_contributions.disability_insurance);
-		result.state.insert(var::accident_insurance, all_contributions.accident_insurance);
+		result.state.insert(var::health_insurance, amounts.all_contributions.health_insurance);
+		result.state.insert(var::pension_insurance, amounts.all_contributions.pension_insurance);
+		result.state.insert(var::disability_insurance, amounts.all_contributions.disability_insurance);
+		result.state.insert(var::accident_insurance, amounts.all_contributions.accident_insurance);
 		result.state.insert(var::guaranteed_employee_benefits_fund, contribution{});
 
-		result.state.insert(var::health_baseline, taxed_baseline);
-		result.state.insert(var::health_contribution, health_contribution);
+		result.state.insert(var::health_baseline, amounts.taxed_baseline);
+		result.state.insert(var::health_contribution, amounts.health_contribution);
 
-		result.state.insert(var::insurance_total, all_contributions.total());
-		result.state.insert(var::tax_total, tax_owed);
+		result.state.insert(var::insurance_total, amounts.all_contributions.total());
+		result.state.insert(var::tax_total, amounts.tax_owed);
 		return result;
 	}  // GCOV_EXCL_LINE[GCC]
 
@@ -185,10 +323,12 @@ namespace quick_dra {
 	              year_month const& date,
 	              year_month_day const& today,
 	              config const& cfg,
-	              std::vector<form> const& forms) {
-		auto result = calc_common("DRA"s, report_index, date, today, cfg);
+	              tax_parameters const& params,
+	              std::vector<form> const& forms,
+	              std::pmr::memory_resource* resource) {
+		auto result = calc_common("DRA"s, report_index, date, today, cfg, resource);
 		result.state.insert(var::insured_count, uint_value{static_cast<unsigned>(cfg.insured.size())});
-		result.state.insert(var::accident_insurance_contribution, cfg.params.contributions.accident_insurance.total());
+		result.state.insert(var::accident_insurance_contribution, params.contributions.accident_insurance.total());
 
 		reduce_form(result.state, {});
 		for (auto const& src : forms) {
@@ -203,29 +343,70 @@ namespace quick_dra {
 	                                   unsigned report_index,
 	                                   std::chrono::year_month const& date,
 	                                   std::chrono::year_month_day const& today,
-	                                   config const& cfg) {
+	                                   config const& cfg,
+	                                   rca_cache* cache,
+	                                   std::pmr::memory_resource* resource) {
+		return prepare_form_set(level, report_index, date, today, cfg, cfg.params, cache, resource);
+	}
+
+	std::vector<form> prepare_form_set(verbose level,
+	                                   unsigned report_index,
+	                                   std::chrono::year_month const& date,
+	                                   std::chrono::year_month_day const& today,
+	                                   config const& cfg,
+	                                   tax_parameters const& params,
+	                                   rca_cache* cache,
+	                                   std::pmr::memory_resource* resource) {
+		trace::span span{"prepare_form_set"sv};
+		alloc::scope accounting{alloc::phase::calculation};
 		std::vector<form> forms;
 		forms.reserve(cfg.insured.size() + 1);
 
+		std::optional<rca_cache> local_cache{};
+		if (!cache) cache = &local_cache.emplace();
+
+		// the same tax parameters for the whole set
+		auto const segment = cache->segment_for(params);
+		rca_cache::statistics stats{};
 		for (auto const& insured : cfg.insured) {
-			forms.emplace_back(calc_rca(insured, report_index, date, today, cfg));
+			forms.emplace_back(
+			    calc_rca(insured, report_index, date, today, cfg, params, *cache, *segment, stats, resource));
 		}
 
-		forms.emplace_back(calc_dra(report_index, date, today, cfg, forms));
+		forms.emplace_back(calc_dra(report_index, date, today, cfg, params, forms, resource));
 		if (level >= verbose::raw_form_data) {
-			fmt::print("-- form data:\n");
+			auto const lookups = stats.hits + stats.misses;
+			if (lookups) {
+				diag::debug("-- RCA cache: {} hit(s), {} miss(es), {}% hit rate", stats.hits, stats.misses,
+				            stats.hits * 100 / lookups);
+			} else {
+				diag::debug("-- RCA cache: {} hit(s), {} miss(es)", stats.hits, stats.misses);
+			}
+			diag::debug("-- form data:");
 			for (auto const& form : forms) {
+				diag::form_scope context{form.key};
 				auto const doc_id = form.state.typed_value(var::insured.document, ""s);
 				if (doc_id.empty()) {
-					fmt::print("--   {}:", form.key);
+					form.state.debug_print(2, fmt::format("--   {}:", form.key));
 				} else {
-					fmt::print("--   {} [{}]:", form.key, doc_id);
+					form.state.debug_print(2, fmt::format("--   {} [{}]:", form.key, doc_id));
 				}
-				form.state.debug_print(2);
-				fmt::print("--\n");
+				diag::debug("--");
 			}
 		}
 
 		return forms;
 	}  // GCOV_EXCL_LINE[GCC]
+
+	roster make_roster(std::chrono::year_month const& date, config const& cfg) {
+		roster result{};
+		result.reserve(cfg.insured.size());
+
+		for (auto const& insured : cfg.insured) {
+			auto const [_1, _2, part_time_scale, salary] = insured.lookup(date);
+			result.push_back(salary.value_or(cfg.params.minimal_pay), part_time_scale.value_or(ratio{}));
+		}
+
+		return result;
+	}  // GCOV_EXCL_LINE[GCC]
 };  // namespace quick_dra
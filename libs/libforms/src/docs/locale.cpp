@@ -2,12 +2,13 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <array>
-#include <format>
+#include <clocale>
+#include <quick_dra/base/chars.hpp>
+#include <quick_dra/base/startup.hpp>
 #include <quick_dra/docs/locale.hpp>
 #include <string>
 #include <string_view>
 #include <utility>
-#include <vector>
 
 using namespace std::literals;
 
@@ -31,16 +32,19 @@ namespace quick_dra::locale {
 		                            size_t format_index) {
 			if (use_parens) {
 				if (was_neg) {
-					return std::format("({})", decorate_number(symbol, space, ""sv, value, false, false, format_index));
+					auto result = "("s;
+					result.append(decorate_number(symbol, space, ""sv, value, false, false, format_index));
+					result.push_back(')');
+					return result;
 				} else {  // GCOV_EXCL_LINE[WIN32]
 					return decorate_number(symbol, space, ""sv, value, false, false, format_index);
 				}
 			}
 
-#define SIGN "{0}"
-#define QUANTITY "{1}"
-#define SPACE "{2}"
-#define SYMBOL "{3}"
+#define SIGN "0"
+#define QUANTITY "1"
+#define SPACE "2"
+#define SYMBOL "3"
 
 			static constexpr auto number_formats = std::array{
 			    SIGN QUANTITY SYMBOL ""sv, /* The sign string precedes the quantity and currency_symbol.*/
@@ -68,7 +72,20 @@ namespace quick_dra::locale {
 #undef SPACE
 #undef SYMBOL
 
-			return std::vformat(number_formats[format_index], std::make_format_args(sign, value, space, symbol));
+			auto const parts = std::array{sign, value, space, symbol};
+			auto const format = number_formats[format_index];
+
+			size_t length = 0;
+			for (auto const part : format) {
+				length += parts[static_cast<size_t>(part - '0')].size();
+			}
+
+			std::string result{};
+			result.reserve(length);
+			for (auto const part : format) {
+				result.append(parts[static_cast<size_t>(part - '0')]);
+			}
+			return result;
 		}
 
 		std::string group_by(std::string_view number,
@@ -76,52 +93,88 @@ namespace quick_dra::locale {
 		                     std::string_view group_separator,
 		                     size_t additional_size) {
 			static constexpr auto stop_repeating_blocks = static_cast<size_t>(number_grouping::stop_repeating_blocks);
-			auto last_size = stop_repeating_blocks;
-			auto const size = number.size() + additional_size;
-
-			std::vector<std::string_view> chunks{};
-			{
-				size_t chunk_number = 1;
-				auto length = number.size();
-				for (auto const group_size_char : grouping) {
-					auto const group_size = static_cast<size_t>(group_size_char);
-					if (group_size == stop_repeating_blocks) break;
-					if (group_size >= length) break;
-					length -= group_size;
-					chunk_number += 1;
-				}
-				chunks.reserve(chunk_number);
-			}
 
+			// lengths of the groups, starting from the right; a long long has no
+			// more than 20 digits, so a zero-length group is the only way to get
+			// more than that
+			std::array<size_t, 32> chunks{};
+			size_t chunk_count = 0;
+			auto rest = number.size();
+			auto const add_chunk = [&](size_t length) {
+				if (chunk_count == chunks.size()) return false;
+				chunks[chunk_count++] = length;
+				rest -= length;
+				return true;
+			};
+
+			auto last_size = stop_repeating_blocks;
 			for (auto const group_size : grouping) {
 				last_size = static_cast<size_t>(group_size);
 				if (last_size == stop_repeating_blocks) break;
-				if (last_size >= number.size()) break;
-
-				chunks.push_back(number.substr(number.length() - last_size));
-				number = number.substr(0, number.length() - last_size);
+				if (last_size >= rest) break;
+				if (!add_chunk(last_size)) break;
 			}
 
 			if (last_size != stop_repeating_blocks) {
-				while (last_size <= number.size()) {
-					chunks.push_back(number.substr(number.length() - last_size));
-					number = number.substr(0, number.length() - last_size);
+				while (last_size <= rest && add_chunk(last_size)) {
 				}
 			}
 
-			chunks.push_back(number);
-
 			std::string result{};
-			result.reserve(size + (chunks.size() + 1) * group_separator.size());
-			for (auto it = chunks.rbegin(); it != chunks.rend(); ++it) {
+			result.reserve(number.size() + additional_size + (chunk_count + 1) * group_separator.size());
+			result.append(number.substr(0, rest));
+
+			auto position = rest;
+			for (auto index = chunk_count; index > 0; --index) {
+				auto const length = chunks[index - 1];
 				if (!result.empty()) result.append(group_separator);
-				result.append(*it);
+				result.append(number.substr(position, length));
+				position += length;
 			}
 
 			return result;
 		}
+
+		// localeconv() strings are overwritten by the next call, or by
+		// setlocale(); this keeps a copy for as long as the locale is the same
+		struct conv_snapshot {
+			static constexpr auto members = std::array{
+			    &std::lconv::decimal_point,     &std::lconv::thousands_sep,   &std::lconv::grouping,
+			    &std::lconv::int_curr_symbol,   &std::lconv::currency_symbol, &std::lconv::mon_decimal_point,
+			    &std::lconv::mon_thousands_sep, &std::lconv::mon_grouping,    &std::lconv::positive_sign,
+			    &std::lconv::negative_sign,
+			};
+
+			std::string locale_name{};
+			std::array<std::string, members.size()> texts{};
+			std::lconv conv{};
+			bool filled{false};
+
+			bool is_current(char const* name) const noexcept {
+				return filled && name && locale_name == std::string_view{name};
+			}
+
+			void refill(char const* name) {
+				startup::scope timing{startup::subsystem::locale};
+				locale_name.assign(name ? name : "");
+				conv = *std::localeconv();
+				for (size_t index = 0; index < members.size(); ++index) {
+					auto const member = members[index];
+					texts[index].assign(conv.*member ? conv.*member : "");
+					conv.*member = texts[index].data();
+				}
+				filled = true;
+			}
+		};
 	}  // namespace
 
+	std::lconv const* system_conv() {
+		thread_local conv_snapshot snapshot{};
+		auto const* const name = std::setlocale(LC_ALL, nullptr);
+		if (!snapshot.is_current(name)) snapshot.refill(name);
+		return &snapshot.conv;
+	}
+
 	std::string symbol_decorator::number_view::format(std::string_view symbol,
 	                                                  std::string_view space,
 	                                                  std::string_view value,
@@ -195,20 +248,14 @@ namespace quick_dra::locale {
 	}  // GCOV_EXCL_LINE[GCC]
 
 	std::string number_grouping::group(long long value, unsigned denominator) const {
-		size_t digits = 0;
-		{
-			auto den = denominator;
-			while (den > 1) {
-				den /= 10;
-				++digits;
-			}
-		}
-
-		auto const absolute = std::abs(value);
-		auto number = std::format("{}", absolute / denominator);
-		auto fraction = digits ? std::format("{:0{}}", absolute % denominator, digits) : ""s;
-
-		return group(number, fraction);
+		// the sign is left for the decorator
+		chars::buffer buffer{};
+		auto const text = std::string_view{buffer.data(), chars::write_fixed(buffer.data(), value, denominator)};
+		auto const number = text.substr(value < 0 ? 1 : 0);
+		auto const point = number.find('.');
+
+		if (point == std::string_view::npos) return group(number);
+		return group(number.substr(0, point), number.substr(point + 1));
 	}
 
 	number_grouping number_grouping::monetary_from(std::lconv const* conv) {
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <array>
 #include <map>
+#include <quick_dra/base/chars.hpp>
+#include <quick_dra/base/startup.hpp>
 #include <quick_dra/docs/locale.hpp>
 #include <quick_dra/docs/presentation.hpp>
 #include <string>
@@ -33,8 +35,16 @@ namespace quick_dra::report_format {
 		    .grouping = "\003"sv,
 		};
 
-		static auto const pln_formatter = locale::formatter::PLN_with(pl_grouping);
-		static auto const percent_formatter = locale::formatter::percent_with(pl_grouping);
+		// built on first use, not while the program is loaded
+		locale::formatter const& pln_formatter() {
+			static auto const formatter = locale::formatter::PLN_with(pl_grouping);
+			return formatter;
+		}
+
+		locale::formatter const& percent_formatter() {
+			static auto const formatter = locale::formatter::percent_with(pl_grouping);
+			return formatter;
+		}
 	}  // namespace
 
 	using yaml::read_key;
@@ -56,15 +66,14 @@ namespace quick_dra::report_format {
 		std::string operator()(std::monostate) const noexcept { return {}; }
 		// GCOV_EXCL_STOP
 		std::string operator()(std::string const& str) const noexcept { return str; }
-		std::string operator()(currency const& value) const noexcept { return pln_formatter.format(value); }
-		std::string operator()(percent const& value) const noexcept { return percent_formatter.format(value); }
-		std::string operator()(uint_value const& value) const noexcept { return fmt::format("{}", value); }
+		std::string operator()(currency const& value) const noexcept { return pln_formatter().format(value); }
+		std::string operator()(percent const& value) const noexcept { return percent_formatter().format(value); }
+		std::string operator()(uint_value const& value) const noexcept { return chars::to_string(value); }
 		std::string operator()(year_month const& var) const {
-			return fmt::format("{:02}-{:04}", static_cast<unsigned>(var.month()), static_cast<int>(var.year()));
+			return chars::to_string(var, '-', chars::date_order::year_last);
 		}
 		std::string operator()(year_month_day const& var) const {
-			return fmt::format("{:02}-{:02}-{:04}", static_cast<unsigned>(var.day()),
-			                   static_cast<unsigned>(var.month()), static_cast<int>(var.year()));
+			return chars::to_string(var, '-', chars::date_order::year_last);
 		}
 	};
 
@@ -264,6 +273,7 @@ namespace quick_dra::report_format {
 	}  // GCOV_EXCL_LINE[GCC]
 
 	std::map<std::string, formatting> formatting::parse(std::string const& text, std::string const& path) {
+		startup::scope timing{startup::subsystem::templates};
 		auto split = yaml::parser::parse_yaml_text<yaml_shape>(text, path);
 		if (!split) {
 			return {};
@@ -4,6 +4,7 @@
 #include <fmt/format.h>
 #include <algorithm>
 #include <numeric>
+#include <quick_dra/base/text.hpp>
 #include <quick_dra/docs/forms.hpp>
 #include <quick_dra/docs/summary.hpp>
 #include <ranges>
@@ -14,7 +15,7 @@
 namespace quick_dra {
 	namespace {
 		template <typename T>
-		std::optional<T> get_typed_value(global_object const& root, varname const& ref) {
+		std::optional<T> get_typed_value(global_object const& root, compiletime_varname const& ref) {
 			auto const ptr = root.peek(ref);
 			if (!ptr || !ptr->value) {
 				return std::nullopt;
@@ -33,14 +34,6 @@ namespace quick_dra {
 			return result;
 		}  // GCOV_EXCL_LINE[GCC]
 
-		size_t codepoints(std::string_view utf8) {
-			size_t len = 0;
-			for (auto const c : utf8) {
-				len += static_cast<size_t>((static_cast<unsigned char>(c) & 0xC0) != 0x80);
-			}
-			return len;
-		}
-
 		std::string to_string(currency const& v) { return fmt::format("{:.02f} zł", v); }
 
 		std::string format(std::optional<currency> const& value) {
@@ -100,7 +93,9 @@ namespace quick_dra {
 			    return std::pair{std::max(lhs.first, rhs.first), std::max(lhs.second, rhs.second)};
 		    },
 		    // transform: codepoint count in string
-		    [](auto const& line) { return std::pair{codepoints(line.first), codepoints(line.second)}; });
+		    [](auto const& line) {
+			    return std::pair{text::count_code_points(line.first), text::count_code_points(line.second)};
+		    });
 
 		fmt::print("-- payments:\n");
 		for (auto const& [label, value] : lines) {
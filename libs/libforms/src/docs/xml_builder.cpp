@@ -2,6 +2,10 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <fstream>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/chars.hpp>
+#include <quick_dra/base/diag.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/docs/xml.hpp>
 #include <quick_dra/docs/xml_builder.hpp>
 #include <string>
@@ -15,28 +19,29 @@ namespace quick_dra {
 			std::string operator()(std::monostate) const noexcept { return {}; }
 			// GCOV_EXCL_STOP
 			std::string operator()(std::string const& str) const noexcept { return str; }
-			std::string operator()(currency const& value) const noexcept { return fmt::format("{:.2f}", value); }
-			std::string operator()(percent const& value) const noexcept { return fmt::format("{:.2f}", value); }
-			std::string operator()(uint_value const& value) const noexcept { return fmt::format("{}", value); }
+			std::string operator()(currency const& value) const noexcept { return chars::to_string(value); }
+			std::string operator()(percent const& value) const noexcept { return chars::to_string(value); }
+			std::string operator()(uint_value const& value) const noexcept { return chars::to_string(value); }
 			// KEDU: xs:gYearMonth
 			// https://www.w3.org/TR/xmlschema-2/: YYYY "-" MM
-			std::string operator()(year_month const& var) const {
-				return fmt::format("{:04}-{:02}", static_cast<int>(var.year()), static_cast<unsigned>(var.month()));
-			}
+			std::string operator()(year_month const& var) const { return chars::to_string(var, '-'); }
 			// KEDU: xs:date
 			// https://www.w3.org/TR/xmlschema-2/: YYYY "-" MM "-" DD
-			std::string operator()(year_month_day const& var) const {
-				return fmt::format("{:04}-{:02}-{:02}", static_cast<int>(var.year()),
-				                   static_cast<unsigned>(var.month()), static_cast<unsigned>(var.day()));
-			}
+			std::string operator()(year_month_day const& var) const { return chars::to_string(var, '-'); }
 		};
 
+		std::string field_name(unsigned key) {
+			chars::buffer buffer{};
+			auto const prefix = chars::write(buffer.data(), "p"sv);
+			return {buffer.data(), chars::write(prefix, uint_value{key})};
+		}
+
 		void append_field(xml& parent, unsigned key, calculated_value const& value) {
 			if (std::holds_alternative<std::monostate>(value)) {
 				return;
 			}
 
-			parent.with(E(fmt::format("p{}", key)).with(std::visit(xml_printer{}, value)));
+			parent.with(E(field_name(key), {}, parent.resource()).with(std::visit(xml_printer{}, value)));
 		}
 
 		void append_block(xml& parent, mapped_value<calculated_value> const& fields) {
@@ -47,7 +52,7 @@ namespace quick_dra {
 					continue;
 				}
 
-				auto compound = E(fmt::format("p{}", key));
+				auto compound = E(field_name(key), {}, parent.resource());
 				unsigned index = 0;
 				for (auto const& item : std::get<std::vector<calculated_value>>(field)) {
 					append_field(compound, ++index, item);
@@ -57,8 +62,8 @@ namespace quick_dra {
 			}
 		}
 
-		xml from_section(calculated_section const& section) {
-			auto result = E(section.id);
+		xml from_section(calculated_section const& section, std::pmr::memory_resource* resource) {
+			auto result = E(section.id, {}, resource);
 			if (section.repeatable) {
 				result.attributes["id_bloku"] = "1";
 			}
@@ -70,7 +75,7 @@ namespace quick_dra {
 					if (block.id.empty()) {
 						append_block(result, block.fields);
 					} else {
-						append_block(result.with(E(block.id)).children().back(), block.fields);
+						append_block(result.with(E(block.id, {}, resource)).children().back(), block.fields);
 					}
 				}
 			}
@@ -80,27 +85,30 @@ namespace quick_dra {
 
 		xml map_sections(xml&& root, std::vector<calculated_section> const& sections) {
 			for (auto const& section : sections) {
-				root.with(from_section(section));
+				root.with(from_section(section, root.resource()));
 			}
 			return root;
 		}
 
-		xml naglowek_kedu(std::string_view program_name, std::string_view version) {
-			return E("naglowek.KEDU"sv)
-			    .with(E("program"sv)
-			              .with(E("producent"sv).with("midnightBITS"sv))
-			              .with(E("symbol"sv).with(program_name))
-			              .with(E("wersja"sv).with(version)));
+		xml naglowek_kedu(std::string_view program_name,
+		                  std::string_view version,
+		                  std::pmr::memory_resource* resource) {
+			return E("naglowek.KEDU"sv, {}, resource)
+			    .with(E("program"sv, {}, resource)
+			              .with(E("producent"sv, {}, resource).with("midnightBITS"sv))
+			              .with(E("symbol"sv, {}, resource).with(program_name))
+			              .with(E("wersja"sv, {}, resource).with(version)));
 		}
 	};  // namespace
 
-	xml build_kedu_doc(std::string_view program_name, std::string_view version) {
+	xml build_kedu_doc(std::string_view program_name, std::string_view version, std::pmr::memory_resource* resource) {
 		return E("KEDU"sv,
 		         {
 		             {"xmlns"s, "http://www.zus.pl/2024/KEDU_5_6"s},
 		             {"wersja_schematu"s, "1"s},
-		         })
-		    .with(naglowek_kedu(program_name, version));
+		         },
+		         resource)
+		    .with(naglowek_kedu(program_name, version, resource));
 	}
 
 	void attach_document(xml& root,
@@ -109,12 +117,14 @@ namespace quick_dra {
 	                     std::vector<compiled_section> const& tmplt,
 	                     unsigned doc_id) {
 		auto const sections = form.fill(level, tmplt);
-		root.with(
-		    map_sections(E(fmt::format("ZUS{}", form.key), {{"id_dokumentu", fmt::to_string(doc_id)}}), sections));
+		root.with(map_sections(
+		    E(fmt::format("ZUS{}", form.key), {{"id_dokumentu", fmt::to_string(doc_id)}}, root.resource()), sections));
 	}
 
 	void store_xml(xml const& tree, std::string const& filename, bool indented) {
-		fmt::print("-- output: {}\n", filename);
+		trace::span span{"store_xml"sv, filename};
+		alloc::scope accounting{alloc::phase::serialization};
+		diag::info("-- output: {}", filename);
 		auto file = std::ofstream{filename};
 		if (indented)
 			file << tree.indented();
@@ -6,13 +6,25 @@
 #include <curl/curl.h>
 #include <fmt/format.h>
 #include <algorithm>
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <quick_dra/base/startup.hpp>
 #include <quick_dra/base/str.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/io/http.hpp>
 #include <quick_dra/version.hpp>
+#include <optional>
 #include <span>
 #include <stdexcept>
+#include <stop_token>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace quick_dra {
 	namespace {
@@ -31,8 +43,43 @@ namespace quick_dra {
 
 		using curl_ptr = std::unique_ptr<CURL, curl_cleanup>;
 
+		struct slist_cleanup {
+			void operator()(curl_slist* p) const { ::curl_slist_free_all(p); }
+		};
+
+		using slist_ptr = std::unique_ptr<curl_slist, slist_cleanup>;
+
+		slist_ptr conditional_headers(http_validators const& conditions) {
+			slist_ptr result{};
+			auto const append = [&result](std::string_view name, std::string const& value) {
+				if (value.empty()) return;
+				auto const line = fmt::format("{}: {}", name, value);
+				// the head only changes for the first item
+				auto const head = ::curl_slist_append(result.get(), line.c_str());
+				if (head && head != result.get()) result.reset(head);
+			};
+			append("If-None-Match"sv, conditions.etag);
+			append("If-Modified-Since"sv, conditions.last_modified);
+			return result;
+		}
+
+		std::string header_value(curl_ptr const& curl, char const* name) {
+			curl_header* header{};
+			if (curl_easy_header(curl.get(), name, 0, CURLH_HEADER, -1, &header) != CURLHE_OK) {
+				return {};
+			}
+			return std::string{strip_sv(header->value)};
+		}
+
+		void ensure_curl_global() {
+			static const curl_global_initer init = [] {
+				startup::scope timing{startup::subsystem::curl};
+				return curl_global_initer{};
+			}();
+		}
+
 		curl_ptr curl_easy_init() {
-			static const curl_global_initer init{};
+			ensure_curl_global();
 			return curl_ptr{::curl_easy_init()};
 		}
 
@@ -40,8 +87,6 @@ namespace quick_dra {
 			return ::curl_easy_setopt(curl.get(), option, arg);
 		}
 
-		CURLcode curl_easy_perform(curl_ptr const& curl) { return ::curl_easy_perform(curl.get()); }
-
 		auto ua_version() noexcept {
 			if constexpr (version::major < 1) {
 				return version::string;
@@ -49,66 +94,266 @@ namespace quick_dra {
 				return version::string_short;
 			}
 		}
-	}  // namespace
-
-	http_response http_get(std::string const& url) try {
-		http_response response{};
 
-		auto curl = curl_easy_init();
-		if (!curl) return response;
+		struct multi_cleanup {
+			void operator()(CURLM* p) const { ::curl_multi_cleanup(p); }
+		};
 
-		auto const ua = fmt::format("{}/{}", version::program, ua_version());
+		using multi_ptr = std::unique_ptr<CURLM, multi_cleanup>;
 
-		curl_easy_setopt(curl, CURLOPT_USERAGENT, ua.c_str());
-		curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-		curl_write_callback write_cb = [](char* contents, std::size_t size, std::size_t nmemb,
-		                                  void* userp) -> std::size_t {
+		std::size_t append_content(char* contents, std::size_t size, std::size_t nmemb, void* userp) {
 			auto& resp = *static_cast<http_response*>(userp);
 			auto realsize = size * nmemb;
 			auto bytes = reinterpret_cast<std::byte*>(contents);
 			resp.content.insert(resp.content.end(), bytes, bytes + realsize);
 			return realsize;
-		};
-		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_cb);
-		curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-		curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, false);
-		if (curl_easy_perform(curl) != CURLE_OK) {
-			return response.cleaned();
 		}
 
-		long code;
-		if (curl_easy_getinfo(curl.get(), CURLINFO_RESPONSE_CODE, &code) != CURLE_OK) {
-			return response.cleaned();
+		// everything a finished transfer tells about the response
+		void read_response(curl_ptr const& curl, http_response& response) {
+			long code;
+			if (curl_easy_getinfo(curl.get(), CURLINFO_RESPONSE_CODE, &code) != CURLE_OK) {
+				response.cleaned();
+				return;
+			}
+			response.status = static_cast<unsigned>(std::max(code, 0l));
+			response.validators = {
+			    .etag = header_value(curl, "ETag"),
+			    .last_modified = header_value(curl, "Last-Modified"),
+			};
+
+			// nothing more to look at, the caller already has the content
+			if (response.not_modified()) {
+				return;
+			}
+
+			curl_header* header{};
+			if (curl_easy_header(curl.get(), "Content-Type", 0, CURLH_HEADER, -1, &header) != CURLHE_OK) {
+				response.cleaned();
+				return;
+			}
+			auto const view = std::string_view{header->value};
+			auto const split_view = split_sv(view, ';'_sep);
+
+			auto const type_subtype = split_sv(split_view[0], '/'_sep, 1);
+			if (type_subtype.size() == 2) {
+				response.content_type.type = strip_sv(type_subtype[0]);
+				response.content_type.subtype = strip_sv(type_subtype[1]);
+			}
+
+			auto const params = std::span{split_view}.subspan(1);
+			for (auto const& param_view : params) {
+				auto const name_value = split_sv(param_view, '='_sep, 1);
+				if (name_value.size() != 2) {
+					continue;
+				}
+				if (strip_sv(name_value[0]) != "charset"sv) {
+					continue;
+				}
+				response.charset = strip_sv(name_value[1]);
+			}
 		}
-		response.status = static_cast<unsigned>(std::max(code, 0l));
 
-		curl_header* header{};
-		if (curl_easy_header(curl.get(), "Content-Type", 0, CURLH_HEADER, -1, &header) != CURLHE_OK) {
-			return response.cleaned();
+		struct transfer {
+			curl_ptr curl{};
+			slist_ptr headers{};
+			std::string url{};
+			std::string user_agent{};
+			http_response response{};
+			http_callback callback{};
+			std::stop_token stop{};
+			// wakes the worker thread up, so the transfer is dropped at once
+			std::optional<std::stop_callback<std::function<void()>>> on_stop{};
+			// set only while tracing; the span ends on the worker thread
+			trace::clock::time_point submitted{};
+
+			void finish(CURLcode result) {
+				if (result == CURLE_OK) {
+					read_response(curl, response);
+				} else {
+					response.cleaned();
+				}
+
+				if (submitted != trace::clock::time_point{}) {
+					trace::record("http_transfer"sv, url, submitted, trace::clock::now());
+				}
+
+				try {
+					callback(std::move(response));
+				} catch (...) {  // GCOV_EXCL_LINE
+					// a callback has no one to report to
+				}  // GCOV_EXCL_LINE
+			}
+		};
+	}  // namespace
+
+	struct http_client::impl {
+		multi_ptr multi{};
+		std::mutex mtx{};
+		std::vector<std::unique_ptr<transfer>> queued{};
+		bool stopping{false};
+		// only touched by the thread below
+		std::vector<std::unique_ptr<transfer>> incoming{};
+		std::map<CURL*, std::unique_ptr<transfer>> active{};
+		std::thread worker{};
+
+		explicit impl(limits const& config) : multi{::curl_multi_init()} {
+			if (!multi) throw std::runtime_error("CURL multi handle initialization failed");
+
+			::curl_multi_setopt(multi.get(), CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+			::curl_multi_setopt(multi.get(), CURLMOPT_MAX_TOTAL_CONNECTIONS, config.total_connections);
+			::curl_multi_setopt(multi.get(), CURLMOPT_MAX_HOST_CONNECTIONS, config.host_connections);
+
+			worker = std::thread{[this] { run(); }};
 		}
-		auto const view = std::string_view{header->value};
-		auto const split_view = split_sv(view, ';'_sep);
 
-		auto const type_subtype = split_sv(split_view[0], '/'_sep, 1);
-		if (type_subtype.size() == 2) {
-			response.content_type.type = strip_sv(type_subtype[0]);
-			response.content_type.subtype = strip_sv(type_subtype[1]);
+		~impl() {
+			{
+				std::lock_guard lock{mtx};
+				stopping = true;
+			}
+			::curl_multi_wakeup(multi.get());
+			worker.join();
+
+			// whatever did not finish in time
+			for (auto& [curl, pending] : active) {
+				::curl_multi_remove_handle(multi.get(), curl);
+				pending->finish(CURLE_ABORTED_BY_CALLBACK);
+			}
+			for (auto& pending : queued) {
+				pending->finish(CURLE_ABORTED_BY_CALLBACK);
+			}
 		}
 
-		auto const params = std::span{split_view}.subspan(1);
-		for (auto const& param_view : params) {
-			auto const name_value = split_sv(param_view, '='_sep, 1);
-			if (name_value.size() != 2) {
-				continue;
+		void submit(std::unique_ptr<transfer>&& next) {
+			{
+				std::lock_guard lock{mtx};
+				queued.push_back(std::move(next));
 			}
-			if (strip_sv(name_value[0]) != "charset"sv) {
-				continue;
+			::curl_multi_wakeup(multi.get());
+		}
+
+		void run() {
+			while (true) {
+				{
+					std::lock_guard lock{mtx};
+					if (stopping) break;
+					incoming.swap(queued);
+				}
+
+				// outside of the lock, as finish() calls back into the user code,
+				// which may submit the next request
+				for (auto& next : incoming) {
+					if (next->stop.stop_requested()) {
+						next->finish(CURLE_ABORTED_BY_CALLBACK);
+						continue;
+					}
+
+					auto const curl = next->curl.get();
+					if (::curl_multi_add_handle(multi.get(), curl) != CURLM_OK) {
+						next->finish(CURLE_FAILED_INIT);
+						continue;
+					}
+					active[curl] = std::move(next);
+				}
+				incoming.clear();
+
+				int running{};
+				::curl_multi_perform(multi.get(), &running);
+
+				int left{};
+				while (auto const msg = ::curl_multi_info_read(multi.get(), &left)) {
+					if (msg->msg != CURLMSG_DONE) continue;
+					// the message does not survive the removal of the handle
+					auto const curl = msg->easy_handle;
+					auto const result = msg->data.result;
+
+					auto it = active.find(curl);
+					if (it == active.end()) continue;
+					auto done = std::move(it->second);
+					active.erase(it);
+
+					::curl_multi_remove_handle(multi.get(), curl);
+					done->finish(result);
+				}
+
+				std::erase_if(active, [this](auto& item) {
+					auto& [curl, pending] = item;
+					if (!pending->stop.stop_requested()) return false;
+					::curl_multi_remove_handle(multi.get(), curl);
+					pending->finish(CURLE_ABORTED_BY_CALLBACK);
+					return true;
+				});
+
+				// woken up early by submit, by a stop request and by the destructor
+				::curl_multi_poll(multi.get(), nullptr, 0, 1000, nullptr);
 			}
-			response.charset = strip_sv(name_value[1]);
 		}
+	};
+
+	http_client::http_client() : http_client{limits{}} {}
+
+	http_client::http_client(limits const& config) {
+		ensure_curl_global();
+		impl_ = std::make_unique<impl>(config);
+	}
+
+	http_client::~http_client() = default;
+
+	http_client& http_client::shared() {
+		static http_client client{};
+		return client;
+	}
+
+	void http_client::get(http_request const& request, http_callback callback) {
+		auto next = std::make_unique<transfer>();
+		next->curl = curl_easy_init();
+		next->url = request.url;
+		next->user_agent = fmt::format("{}/{}", version::program, ua_version());
+		next->callback = std::move(callback);
+		next->stop = request.stop;
+		if (trace::enabled()) next->submitted = trace::clock::now();
+
+		if (!next->curl) {
+			next->finish(CURLE_FAILED_INIT);
+			return;
+		}
+
+		auto const& curl = next->curl;
+		curl_easy_setopt(curl, CURLOPT_USERAGENT, next->user_agent.c_str());
+		curl_easy_setopt(curl, CURLOPT_URL, next->url.c_str());
+		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, static_cast<curl_write_callback>(append_content));
+		curl_easy_setopt(curl, CURLOPT_WRITEDATA, static_cast<void*>(&next->response));
+		curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, false);
+		// HTTP/2 over TLS, waiting for a connection able to multiplex
+		curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+		curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+		curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(request.timeout.count()));
+		curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(request.connect_timeout.count()));
+
+		next->headers = conditional_headers(request.conditions);
+		if (next->headers) {
+			curl_easy_setopt(curl, CURLOPT_HTTPHEADER, next->headers.get());
+		}
+
+		if (next->stop.stop_possible()) {
+			next->on_stop.emplace(next->stop, [multi = impl_->multi.get()] { ::curl_multi_wakeup(multi); });
+		}
+
+		impl_->submit(std::move(next));
+	}
+
+	std::future<http_response> http_client::get(http_request const& request) {
+		auto promise = std::make_shared<std::promise<http_response>>();
+		auto result = promise->get_future();
+		get(request, [promise](http_response&& response) { promise->set_value(std::move(response)); });
+		return result;
+	}
 
-		return response;
+	http_response http_get(std::string const& url, http_validators const& conditions, std::stop_token stop) try {
+		trace::span span{"http_get"sv, url};
+		return http_client::shared().get({.url = url, .conditions = conditions, .stop = std::move(stop)}).get();
 	} catch (std::exception& error) {
 		// the line below is broken, because when it is reported as excluded,
 		// the <words>, <colon>, <space>, <keyword>, <colon> makes msbuild to
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/base/types.hpp>
+#include <quick_dra/io/http_cache.hpp>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace quick_dra {
+	namespace {
+		namespace fs = std::filesystem;
+		using std::chrono::sys_seconds;
+
+		struct entry {
+			std::string url{};
+			http_validators validators{};
+			std::string type{};
+			std::string subtype{};
+			std::string charset{};
+			sys_seconds checked{};
+		};
+
+		struct entry_files {
+			fs::path meta;
+			fs::path body;
+		};
+
+		// stable between runs and builds, unlike std::hash
+		std::uint64_t fnv1a(std::string_view text) noexcept {
+			std::uint64_t hash = 0xcbf2'9ce4'8422'2325ull;
+			for (auto c : text) {
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 0x100'0000'01b3ull;
+			}
+			return hash;
+		}
+
+		entry_files files_for(fs::path const& dir, std::string const& url) {
+			auto const stem = fmt::format("{:016x}", fnv1a(url));
+			return {.meta = dir / (stem + ".meta"), .body = dir / (stem + ".body")};
+		}
+
+		std::optional<entry> read_meta(fs::path const& path, std::string const& url) {
+			std::ifstream in{path};
+			if (!in) return std::nullopt;
+
+			entry result{};
+			std::string line{};
+			while (std::getline(in, line)) {
+				auto const view = std::string_view{line};
+				auto const pos = view.find(' ');
+				if (pos == std::string_view::npos) continue;
+				auto const key = view.substr(0, pos);
+				auto value = std::string{view.substr(pos + 1)};
+
+				if (key == "url"sv) {
+					result.url = std::move(value);
+				} else if (key == "etag"sv) {
+					result.validators.etag = std::move(value);
+				} else if (key == "last-modified"sv) {
+					result.validators.last_modified = std::move(value);
+				} else if (key == "content-type"sv) {
+					auto const type_subtype = split_sv(value, '/'_sep, 1);
+					if (type_subtype.size() == 2) {
+						result.type = type_subtype[0];
+						result.subtype = type_subtype[1];
+					}
+				} else if (key == "charset"sv) {
+					result.charset = std::move(value);
+				} else if (key == "checked"sv) {
+					long long seconds{};
+					if (!from_chars(value, seconds)) return std::nullopt;
+					result.checked = sys_seconds{std::chrono::seconds{seconds}};
+				}
+			}
+
+			// two URLs with the same hash
+			if (result.url != url) return std::nullopt;
+			return result;
+		}
+
+		std::optional<std::vector<std::byte>> read_body(fs::path const& path) {
+			std::ifstream in{path, std::ios::binary};
+			if (!in) return std::nullopt;
+			std::vector<char> bytes{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+			auto const data = reinterpret_cast<std::byte const*>(bytes.data());
+			return std::vector<std::byte>{data, data + bytes.size()};
+		}
+
+		// written next to the target and renamed, so a reader never sees half a file
+		bool write_file(fs::path const& path, std::string_view contents) {
+			auto tmp = path;
+			tmp += ".tmp";
+			{
+				std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+				if (!out) return false;
+				out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+				if (!out) return false;
+			}
+			std::error_code ec{};
+			fs::rename(tmp, path, ec);
+			return !ec;
+		}
+
+		bool write_meta(fs::path const& path, entry const& stored) {
+			auto const text = fmt::format(
+			    "url {}\n"
+			    "etag {}\n"
+			    "last-modified {}\n"
+			    "content-type {}/{}\n"
+			    "charset {}\n"
+			    "checked {}\n",
+			    stored.url, stored.validators.etag, stored.validators.last_modified, stored.type, stored.subtype,
+			    stored.charset, stored.checked.time_since_epoch().count());
+			return write_file(path, text);
+		}
+
+		void store(entry_files const& files, entry const& stored, http_response const& response) {
+			std::error_code ec{};
+			fs::create_directories(files.meta.parent_path(), ec);
+			// the body goes first; metadata without one is dropped on read
+			if (!write_file(files.body, response.text())) return;
+			write_meta(files.meta, stored);
+		}
+
+		http_response from_entry(entry const& stored, std::vector<std::byte>&& content) {
+			http_response result{.status = 200};
+			result.content_type.type = stored.type;
+			result.content_type.subtype = stored.subtype;
+			result.charset = stored.charset;
+			result.content = std::move(content);
+			result.validators = stored.validators;
+			return result;
+		}
+	}  // namespace
+
+	cached_response cached_http_get(std::string const& url,
+	                                http_cache_options const& options,
+	                                std::chrono::system_clock::time_point now,
+	                                std::stop_token stop) {
+		if (options.dir.empty()) {
+			return {.response = http_get(url, {}, std::move(stop)), .source = http_cache_source::network};
+		}
+
+		auto const files = files_for(options.dir, url);
+		auto const checked = std::chrono::floor<std::chrono::seconds>(now);
+
+		auto stored = read_meta(files.meta, url);
+		auto body = stored ? read_body(files.body) : std::nullopt;
+		if (!body) stored.reset();
+
+		if (stored && checked - stored->checked < options.ttl) {
+			return {.response = from_entry(*stored, std::move(*body)), .source = http_cache_source::fresh};
+		}
+
+		auto response = http_get(url, stored ? stored->validators : http_validators{}, stop);
+		// whoever asked is gone; the cache is left as it was
+		if (stop.stop_requested()) return {.response = std::move(response.cleaned())};
+
+		if (stored && response.not_modified()) {
+			// a 304 may come with newer validators
+			if (!response.validators.etag.empty()) stored->validators.etag = response.validators.etag;
+			if (!response.validators.last_modified.empty()) {
+				stored->validators.last_modified = response.validators.last_modified;
+			}
+			stored->checked = checked;
+			write_meta(files.meta, *stored);
+			return {.response = from_entry(*stored, std::move(*body)), .source = http_cache_source::revalidated};
+		}
+
+		if (response) {
+			store(files,
+			      {.url = url,
+			       .validators = response.validators,
+			       .type = response.content_type.type,
+			       .subtype = response.content_type.subtype,
+			       .charset = response.charset,
+			       .checked = checked},
+			      response);
+			return {.response = std::move(response), .source = http_cache_source::network};
+		}
+
+		if (stored && (response.status == 0 || response.status >= 500)) {
+			return {.response = from_entry(*stored, std::move(*body)), .source = http_cache_source::stale};
+		}
+
+		return {.response = std::move(response), .source = http_cache_source::network};
+	}
+}  // namespace quick_dra
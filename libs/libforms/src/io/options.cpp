@@ -5,8 +5,12 @@
 #include <array>
 #include <map>
 #include <optional>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/chars.hpp>
 #include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/io/http.hpp>
 #include <quick_dra/io/options.hpp>
 #include <quick_dra/io/tax_config.hpp>
@@ -16,8 +20,14 @@
 
 namespace quick_dra {
 	std::string set_filename(unsigned report_index, year_month const& date) {
-		return fmt::format("quick-dra_{}{:02}-{:02}.xml", static_cast<int>(date.year()),
-		                   static_cast<unsigned>(date.month()), report_index);
+		chars::buffer text{};
+		auto out = chars::write(text.data(), "quick-dra_"sv);
+		out = chars::write_padded(out, static_cast<int>(date.year()), 1);
+		out = chars::write_padded(out, static_cast<unsigned>(date.month()), 2);
+		out = chars::write(out, "-"sv);
+		out = chars::write_padded(out, report_index, 2);
+		out = chars::write(out, ".xml"sv);
+		return {text.data(), out};
 	}
 
 	std::optional<config> parse_config(verbose level,
@@ -25,10 +35,15 @@ namespace quick_dra {
 	                                   std::filesystem::path const& path,
 	                                   std::optional<std::filesystem::path> const& tax_config_path,
 	                                   github_config download) {
+		trace::span span{"parse_config"sv};
+		alloc::scope accounting{alloc::phase::config};
+		// the download runs while the user config is parsed
+		auto pending = start_tax_config_download(download);
+
 		auto result = config::parse_yaml(path);
 		if (!result) return result;
 
-		auto tax_cfg = load_tax_config(level, tax_config_path, download);
+		auto tax_cfg = load_tax_config(level, tax_config_path, std::move(pending));
 		if (!tax_cfg) {
 			result.reset();
 			return result;
@@ -50,7 +65,7 @@ namespace quick_dra {
 				}
 			}  // GCOV_EXCL_LINE[WIN32]
 			if (!everyone_has_salary) {
-				fmt::print("--   minimal pay for month reported: {:.02f} zł\n", result->params.minimal_pay);
+				diag::debug("--   minimal pay for month reported: {:.02f} zł", result->params.minimal_pay);
 			}
 		}
 
@@ -2,17 +2,36 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <fmt/std.h>
+#include <algorithm>
 #include <array>
+#include <cstdlib>
+#include <functional>
+#include <future>
 #include <map>
+#include <mutex>
 #include <optional>
+#include <quick_dra/base/alloc_stats.hpp>
 #include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/io/http.hpp>
+#include <quick_dra/io/http_cache.hpp>
 #include <quick_dra/io/options.hpp>
 #include <quick_dra/io/tax_config.hpp>
 #include <quick_dra/version.hpp>
+#include <stop_token>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
+#include <yaml/parser.hpp>
+
+#define TAX_TIMELINES(X)  \
+	X(scale)              \
+	X(minimal_pay)        \
+	X(costs_of_obtaining) \
+	X(contributions)
 
 namespace quick_dra {
 	namespace {
@@ -20,54 +39,175 @@ namespace quick_dra {
 		    "https://raw.githubusercontent.com/mbits-os/quick_dra/refs/heads/main/"sv;
 		static constexpr auto GITHUB_TAX_CONFIG = "data/config/tax_config.yaml"sv;
 
-		std::optional<tax_config> download_tax_config(verbose level) {
+		tax_config_source& download_source() {
+			static auto source = tax_config_source::from_environment();
+			return source;
+		}
+
+		// The text of an unchanged download is not parsed again; the GUI
+		// asks for the tax config each time the user config changes.
+		struct parsed_download {
 			std::string url{};
-			url = GITHUB_MAIN_BRANCH;
-			url += GITHUB_TAX_CONFIG;
+			http_validators validators{};
+			tax_config config{};
+		};
+
+		std::mutex parsed_mtx{};
+		std::optional<parsed_download> last_parsed{};
+
+		std::optional<tax_config> reuse_parsed(std::string const& url, http_validators const& validators) {
+			std::lock_guard lock{parsed_mtx};
+			if (validators.empty() || !last_parsed || last_parsed->url != url ||
+			    last_parsed->validators != validators) {
+				return std::nullopt;
+			}
+			return last_parsed->config;
+		}
+
+		void remember_parsed(std::string const& url,
+		                     http_validators const& validators,
+		                     std::optional<tax_config> const& config) {
+			if (validators.empty() || !config) return;
+			std::lock_guard lock{parsed_mtx};
+			last_parsed = parsed_download{.url = url, .validators = validators, .config = *config};
+		}
+
+		void print_source(verbose level, http_cache_source source, std::string const& url) {
+			if (level < verbose::parameters) return;
+			switch (source) {
+				case http_cache_source::network:
+					diag::debug("-- downloaded {}", url);
+					break;
+				case http_cache_source::revalidated:
+					diag::debug("-- not modified since last download {}", url);
+					break;
+				case http_cache_source::fresh:
+					diag::debug("-- recently downloaded {}", url);
+					break;
+				case http_cache_source::stale:
+					diag::debug("-- could not refresh, using last download {}", url);
+					break;
+			}
+		}
+
+		// The text of a local file, read while the download is still running
+		struct local_tax_config {
+			std::filesystem::path path{};
+			std::optional<std::string> text{};
+		};
 
-			auto resp = http_get(url);
+		local_tax_config read_local(std::filesystem::path const& path) {
+			return {.path = path, .text = yaml::read_file(path)};
+		}
+
+		// tax_config::parse_yaml, with the file already read
+		std::optional<tax_config> parse_local(local_tax_config&& local) {
+			if (!local.text) {
+				// on stdout, in line with the statuses of the downloads
+				diag::error(diag::stream::out, "{}: error: cannot find {}", version::program, local.path);
+				return std::nullopt;
+			}
+
+			return tax_config::parse_from_text(std::move(*local.text), local.path.string());
+		}
+
+		std::optional<tax_config> collect(verbose level, tax_config_download&& download) {
+			if (!download.response.valid()) return std::nullopt;
+
+			auto const url = std::move(download.url);
+			auto [resp, origin] = download.response.get();
 			if (!resp) {
 				if (level >= verbose::parameters) {
-					fmt::print("-- nothing downloaded (status: {}, {})\n", resp.status, url);
+					diag::debug("-- nothing downloaded (status: {}, {})", resp.status, url);
 				}
-				return {};
+				return std::nullopt;
 			}
 
-			auto view = resp.text();
+			auto result = reuse_parsed(url, resp.validators);
+			if (!result) {
+				auto view = resp.text();
 
-			// TODO: object vs array
-			auto result = tax_config::parse_from_text({view.data(), view.size()}, url);
-			if (level >= verbose::parameters) {
-				fmt::print("-- downloaded {}\n", url);
+				// TODO: object vs array
+				result = tax_config::parse_from_text({view.data(), view.size()}, url);
+				remember_parsed(url, resp.validators, result);
 			}
+
+			print_source(level, origin, url);
 			return result;
 		}
 
-		using tax_config_loader = std::function<decltype(download_tax_config)>;
+		using tax_config_loader = std::function<std::optional<tax_config>()>;
 	}  // namespace
 
+	tax_config_source tax_config_source::from_environment() {
+		tax_config_source result{
+		    .url = fmt::format("{}{}", GITHUB_MAIN_BRANCH, GITHUB_TAX_CONFIG),
+		    .cache = {.dir = platform::cache_dir()},
+		};
+
+		auto const* const URL = std::getenv("QUICK_DRA_TAX_CONFIG_URL");
+		if (URL && *URL) {
+			result.url = URL;
+		}
+
+		auto const* const TTL = std::getenv("QUICK_DRA_TAX_CONFIG_TTL");
+		long long seconds{};
+		if (TTL && from_chars(TTL, seconds) && seconds >= 0) {
+			result.cache.ttl = std::chrono::seconds{seconds};
+		}
+
+		return result;
+	}
+
+	tax_config_source const& tax_config_download_source() { return download_source(); }
+	void tax_config_download_source(tax_config_source const& source) { download_source() = source; }
+
+	tax_config_download start_tax_config_download(github_config download) {
+		if (download == github_config::skip) return {};
+
+		// a copy, in case the source is changed while downloading
+		auto source = download_source();
+		auto url = source.url;
+		// a caller giving up early (e.g. on a broken user config) stops the
+		// transfer, instead of waiting for it to finish
+		std::packaged_task<cached_response(std::stop_token)> task{[source = std::move(source)](std::stop_token stop) {
+			return cached_http_get(source.url, source.cache, std::chrono::system_clock::now(), std::move(stop));
+		}};
+		auto response = task.get_future();
+		return {.url = std::move(url), .response = std::move(response), .worker = std::jthread{std::move(task)}};
+	}
+
 	std::optional<tax_config> load_tax_config(verbose level,
 	                                          std::optional<std::filesystem::path> const& tax_config_path,
 	                                          github_config download) {
+		return load_tax_config(level, tax_config_path, start_tax_config_download(download));
+	}
+
+	std::optional<tax_config> load_tax_config(verbose level,
+	                                          std::optional<std::filesystem::path> const& tax_config_path,
+	                                          tax_config_download&& download) {
+		trace::span span{"load_tax_config"sv};
+		alloc::scope accounting{alloc::phase::config};
+		// The local files are read while the download is still running; the
+		// parsing stays on this thread, as the YAML error callbacks are global,
+		// and goes in the order of precedence, as do the messages.
+		auto from_path = tax_config_path ? std::optional{read_local(*tax_config_path)} : std::nullopt;
+		auto installed = read_local(platform::config_data_dir() / "tax_config.yaml"sv);
+
 		auto const loaders = std::array{
-		    // tax_config_loader
-		    std::function{[&tax_config_path](verbose) -> std::optional<tax_config> {
-			    if (!tax_config_path) return std::nullopt;
-			    return tax_config::parse_yaml(*tax_config_path);
-		    }},
-		    std::function{[download](verbose level) -> std::optional<tax_config> {
-			    if (download == github_config::download) return download_tax_config(level);
-			    return std::nullopt;
+		    tax_config_loader{[&from_path]() -> std::optional<tax_config> {
+			    if (!from_path) return std::nullopt;
+			    return parse_local(std::move(*from_path));
 		    }},
-		    std::function{
-		        +[](verbose) { return tax_config::parse_yaml(platform::config_data_dir() / "tax_config.yaml"sv); }},
+		    tax_config_loader{[level, &download] { return collect(level, std::move(download)); }},
+		    tax_config_loader{[&installed] { return parse_local(std::move(installed)); }},
 		};
 
 		std::optional<tax_config> result{};
 		result.emplace();
 		auto read_one_tax_config = false;
 		for (auto const& loader : loaders) {
-			auto current = loader(level);
+			auto current = loader();
 
 			if (current) {
 				read_one_tax_config = true;
@@ -82,15 +222,61 @@ namespace quick_dra {
 		return result;
 	}
 
+	resolved_tax_parameters::resolved_tax_parameters(tax_config const& config) {
+		auto const add_months = [this](auto const& timeline) {
+			for (auto const& [month, _] : timeline) {
+				months_.push_back(month);
+			}
+		};
+		auto const assign = [](auto& out, year_month const& month, auto const& timeline) {
+			if (auto const it = timeline_at(month, timeline); it != timeline.end()) out = it->second;
+		};
+
+#define X(NAME) add_months(config.NAME);
+		TAX_TIMELINES(X)
+#undef X
+
+		std::ranges::sort(months_);
+		auto const [last, end] = std::ranges::unique(months_);
+		months_.erase(last, end);
+
+		segments_.reserve(months_.size());
+		for (auto const& month : months_) {
+			auto& params = segments_.emplace_back();
+#define X(NAME) assign(params.NAME, month, config.NAME);
+			TAX_TIMELINES(X)
+#undef X
+		}
+	}
+
+	tax_parameters const& resolved_tax_parameters::at(year_month const& key) const noexcept {
+		auto const it = std::ranges::upper_bound(months_, key);
+		if (it == months_.begin()) return before_first_;
+		return segments_[static_cast<size_t>(std::distance(months_.begin(), it)) - 1];
+	}
+
+	tax_parameters const& lookup_parameters(
+	    std::optional<tax_parameters>& storage,
+	    resolved_tax_parameters const& resolved,
+	    std::optional<std::map<std::chrono::year_month, percent>> const& accident_insurance_override,
+	    year_month const& key) {
+		auto const& params = resolved.at(key);
+		if (!accident_insurance_override || accident_insurance_override->empty()) return params;
+
+		auto& out = storage.emplace(params);
+		out.contributions.accident_insurance = {
+		    .payer = find_in_timeline(key, *accident_insurance_override).second,
+		};
+		return out;
+	}
+
 	void lookup_parameters(tax_parameters& out,
 	                       tax_config const& config,
 	                       std::optional<std::map<std::chrono::year_month, percent>> const& accident_insurance_override,
 	                       year_month const& key) {
-#define FIND_IN_TIMELINE(NAME) out.NAME = find_in_timeline(key, config.NAME).second
-		FIND_IN_TIMELINE(scale);
-		FIND_IN_TIMELINE(minimal_pay);
-		FIND_IN_TIMELINE(costs_of_obtaining);
-		FIND_IN_TIMELINE(contributions);
+#define X(NAME) out.NAME = find_in_timeline(key, config.NAME).second;
+		TAX_TIMELINES(X)
+#undef X
 
 		if (accident_insurance_override && !accident_insurance_override->empty()) {
 			out.contributions.accident_insurance = {
@@ -291,7 +291,8 @@ reports:
         1: $today)"sv},
 	};
 
-	static constexpr auto raw_form_data = R"(-- form data:
+	static constexpr auto raw_form_data = R"(-- RCA cache: 0 hit(s), 2 miss(es), 0% hit rate
+-- form data:
 --   RCA [50671500000]:
 --      accident_insurance:
 --        insured: 0.00 zł
@@ -432,7 +433,8 @@ reports:
 
 	    std::pair{verbose::raw_form_data, raw_form_data},
 
-	    std::pair{verbose::templates, R"(-- form data:
+	    std::pair{verbose::templates, R"(-- RCA cache: 0 hit(s), 2 miss(es), 0% hit rate
+-- form data:
 --   RCA [50671500000]:
 --      accident_insurance:
 --        insured: 0.00 zł
@@ -714,7 +716,8 @@ reports:
 --
 )"sv},
 
-	    std::pair{verbose::calculated_sections, R"(-- form data:
+	    std::pair{verbose::calculated_sections, R"(-- RCA cache: 0 hit(s), 2 miss(es), 0% hit rate
+-- form data:
 --   RCA [50671500000]:
 --      accident_insurance:
 --        insured: 0.00 zł
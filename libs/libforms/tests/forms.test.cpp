@@ -0,0 +1,152 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <memory_resource>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/docs/forms.hpp>
+#include <quick_dra/fixtures/config.hpp>
+#include <string>
+
+namespace quick_dra::testing {
+	using std::literals::operator""s;
+	using std::literals::operator""y;
+
+	namespace {
+		config make_config() {
+			auto cfg = fixtures::empty_config();
+			cfg.insured.push_back(fixtures::insured(0));
+			cfg.insured.push_back(fixtures::insured(1, 7500_PLN, ratio{3, 4}));
+			cfg.insured.push_back(fixtures::insured(2));
+			cfg.insured.push_back(fixtures::insured(3, fixtures::minimal_pay, ratio{1, 1}));
+			return cfg;
+		}
+
+		void expect_same_forms(std::vector<form> const& expected, std::vector<form> const& actual) {
+			ASSERT_EQ(expected.size(), actual.size());
+			for (size_t index = 0; index < expected.size(); ++index) {
+				auto const& lhs = expected[index].state;
+				auto const& rhs = actual[index].state;
+				auto const label = fmt::format("#{}", index);
+				EXPECT_EQ(lhs.typed_value(var::insured.last, ""s), rhs.typed_value(var::insured.last, ""s)) << label;
+				EXPECT_EQ(lhs.typed_value<currency>(var::salary.gross), rhs.typed_value<currency>(var::salary.gross))
+				    << label;
+				EXPECT_EQ(lhs.typed_value<currency>(var::salary.net), rhs.typed_value<currency>(var::salary.net))
+				    << label;
+				EXPECT_EQ(lhs.typed_value<currency>(var::tax_total), rhs.typed_value<currency>(var::tax_total))
+				    << label;
+				EXPECT_EQ(lhs.typed_value<currency>(var::insurance_total),
+				          rhs.typed_value<currency>(var::insurance_total))
+				    << label;
+			}
+		}
+	}  // namespace
+
+	TEST(rca_cache, same_profiles_are_computed_once) {
+		auto const cfg = make_config();
+		auto const date = 2026y / 1;
+
+		rca_cache cache{};
+		auto const cached = prepare_form_set(verbose::none, 1, date, 2026y / 2 / 5, cfg, &cache);
+		auto const stats = cache.stats();
+		// #0, #2 and #3 all get the full minimal pay
+		EXPECT_EQ(stats.hits, 2u);
+		EXPECT_EQ(stats.misses, 2u);
+
+		expect_same_forms(prepare_form_set(verbose::none, 1, date, 2026y / 2 / 5, cfg), cached);
+	}
+
+	TEST(rca_cache, shared_between_configs) {
+		auto first = make_config();
+		auto second = make_config();
+		second.payer.last_name = "Kowalski"s;
+		second.insured.resize(2);
+
+		rca_cache cache{};
+		prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, first, &cache);
+		auto const forms = prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, second, &cache);
+		EXPECT_EQ(cache.stats().hits, 4u);
+		EXPECT_EQ(cache.stats().misses, 2u);
+		expect_same_forms(prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, second), forms);
+
+		// other tax parameters, other amounts
+		second.params.costs_of_obtaining.local = 300_PLN;
+		prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, second, &cache);
+		EXPECT_EQ(cache.stats().misses, 4u);
+
+		cache.clear();
+		EXPECT_EQ(cache.stats().hits, 0u);
+		EXPECT_EQ(cache.stats().misses, 0u);
+	}
+
+	TEST(rca_cache, keeps_recent_segments) {
+		auto params = fixtures::parameters();
+		auto const first_costs = params.costs_of_obtaining.local;
+		rca_cache cache{};
+		auto const oldest = cache.segment_for(params);
+
+		std::shared_ptr<rca_cache::segment> second{};
+		for (size_t index = 1; index < rca_cache::max_segments; ++index) {
+			params.costs_of_obtaining.local = params.costs_of_obtaining.local + 1_PLN;
+			auto seg = cache.segment_for(params);
+			if (!second) second = std::move(seg);
+		}
+		EXPECT_EQ(cache.segments(), rca_cache::max_segments);
+
+		// used again, so the second one is the oldest now
+		params.costs_of_obtaining.local = first_costs;
+		EXPECT_EQ(cache.segment_for(params), oldest);
+
+		params.costs_of_obtaining.local = first_costs + 1000_PLN;
+		cache.segment_for(params);
+		EXPECT_EQ(cache.segments(), rca_cache::max_segments);
+
+		params.costs_of_obtaining.local = first_costs + 1_PLN;
+		EXPECT_NE(cache.segment_for(params), second);
+		params.costs_of_obtaining.local = first_costs;
+		EXPECT_EQ(cache.segment_for(params), oldest);
+
+		// still usable by whoever holds it
+		rca_cache::statistics stats{};
+		cache.lookup(*second, fixtures::minimal_pay, 1, 1, stats);
+		EXPECT_EQ(stats.misses, 1u);
+	}
+
+	TEST(prepare_form_set, state_in_arena) {
+		auto const cfg = make_config();
+
+		std::pmr::monotonic_buffer_resource arena{};
+		auto const forms = prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, cfg, nullptr, &arena);
+		for (auto const& form : forms) {
+			EXPECT_EQ(form.state.get_allocator().resource(), &arena) << form.key;
+		}
+
+		expect_same_forms(prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, cfg), forms);
+	}
+
+	TEST(prepare_form_set, arena_saves_allocations) {
+		if (!alloc::counting()) GTEST_SKIP() << "built without the counting operator new";
+
+		auto const cfg = make_config();
+		rca_cache cache{};
+		prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, cfg, &cache);
+
+		auto before = alloc::total();
+		auto const calculation = alloc::of(alloc::phase::calculation);
+		auto const on_heap = prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, cfg, &cache);
+		auto const heap_cost = alloc::total() - before;
+		// all of it made inside the calculation phase
+		EXPECT_EQ(heap_cost.allocations, (alloc::of(alloc::phase::calculation) - calculation).allocations);
+
+		std::pmr::monotonic_buffer_resource arena{64 * 1024};
+		before = alloc::total();
+		auto const in_arena = prepare_form_set(verbose::none, 1, 2026y / 1, 2026y / 2 / 5, cfg, &cache, &arena);
+		auto const arena_cost = alloc::total() - before;
+
+		// the nodes of the form states come from the one block
+		EXPECT_LT(arena_cost.allocations, heap_cost.allocations);
+		expect_same_forms(on_heap, in_arena);
+	}
+}  // namespace quick_dra::testing
@@ -5,12 +5,17 @@
 #include <gtest/gtest.h>
 #include <cstddef>
 #include <curl/mock.hpp>
+#include <future>
+#include <memory>
 #include <quick_dra/io/http.hpp>
 #include <span>
+#include <stop_token>
+#include <vector>
 
 namespace quick_dra::testing {
 	using std::literals::operator""s;
 	using std::literals::operator""sv;
+	using std::literals::operator""ms;
 
 	namespace {
 		std::string_view force_view(std::span<std::byte const> buffer) {
@@ -140,4 +145,75 @@ namespace quick_dra::testing {
 		ASSERT_EQ(actual.text(), dummy_content);
 		ASSERT_TRUE(log.empty());
 	}
+
+	class ImplOptions : public CURL {
+		CURLcode perform() override {
+			auto const value = [this](auto option) {
+				auto const ptr = getopt(option);
+				return ptr ? *ptr : -1;
+			};
+			auto const content = fmt::format("{} {} {}", value(CURLOPT_TIMEOUT_MS), value(CURLOPT_CONNECTTIMEOUT_MS),
+			                                 value(CURLOPT_HTTP_VERSION));
+			set_response(200, content, {{"Content-Type"sv, "text/plain"sv}});
+			return CURLE_OK;
+		}
+	};
+
+	TEST(http_client, request_options) {
+		set_curl_factory<ImplOptions>();
+		http_client client{};
+		auto const actual =
+		    client.get({.url = "http://example.com/"s, .timeout = 1500ms, .connect_timeout = 500ms}).get();
+		ASSERT_TRUE(actual);
+		ASSERT_EQ(actual.text(), fmt::format("1500 500 {}", CURL_HTTP_VERSION_2TLS));
+	}
+
+	TEST(http_client, concurrent_requests) {
+		set_curl_factory<ImplCharset>();
+		http_client client{{.total_connections = 2, .host_connections = 2}};
+
+		std::vector<std::future<http_response>> responses{};
+		for (auto index = 0; index < 16; ++index) {
+			responses.push_back(client.get({.url = fmt::format("http://example.com/{}", index)}));
+		}
+
+		for (auto& response : responses) {
+			auto const actual = response.get();
+			ASSERT_TRUE(actual);
+			ASSERT_EQ(actual.text(), dummy_content);
+		}
+	}
+
+	TEST(http_client, callbacks) {
+		set_curl_factory<ImplNoCharset>();
+		std::promise<std::vector<unsigned>> done{};
+		{
+			http_client client{};
+			auto statuses = std::make_shared<std::vector<unsigned>>();
+			for (auto index = 0; index < 3; ++index) {
+				client.get({.url = "http://example.com/"s}, [statuses, &done](http_response&& response) {
+					// always on the thread of the client, one at a time
+					statuses->push_back(response.status);
+					if (statuses->size() == 3) done.set_value(*statuses);
+				});
+			}
+			ASSERT_EQ(done.get_future().get(), (std::vector<unsigned>{200, 200, 200}));
+		}
+	}
+
+	TEST(http_client, stopped) {
+		set_curl_factory<ImplCharset>();
+		std::stop_source stop{};
+		stop.request_stop();
+		http_client client{};
+		auto const actual = client.get({.url = "http://example.com/"s, .stop = stop.get_token()}).get();
+		ASSERT_RESPONSE_EMPTY(actual);
+	}
+
+	TEST(http_client, no_easy_handle) {
+		set_curl_factory(nullptr);
+		http_client client{};
+		auto const actual = client.get({.url = "http://example.com/"s}).get();
+		ASSERT_RESPONSE_EMPTY(actual);
+	}
 }  // namespace quick_dra::testing
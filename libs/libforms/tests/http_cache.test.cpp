@@ -0,0 +1,185 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <curl/mock.hpp>
+#include <filesystem>
+#include <quick_dra/io/http_cache.hpp>
+#include <stop_token>
+#include <string>
+
+namespace quick_dra::testing {
+	using std::literals::operator""s;
+	using std::literals::operator""sv;
+	using std::literals::operator""h;
+	using std::literals::operator""min;
+	using std::literals::operator""y;
+
+	namespace {
+		constexpr auto url = "http://example.com/tax_config.yaml"sv;
+		constexpr auto first_content = "version: 1\n"sv;
+		constexpr auto second_content = "version: 2\n"sv;
+
+		struct server_state {
+			unsigned requests{};
+			std::vector<std::string> last_headers{};
+		};
+
+		server_state server{};
+
+		class ImplFirst : public CURL {
+			CURLcode perform() override {
+				++server.requests;
+				server.last_headers = request_headers();
+				set_response(200, first_content,
+				             {{"Content-Type"sv, "application/yaml; charset=utf-8"sv},
+				              {"ETag"sv, "\"v1\""sv},
+				              {"Last-Modified"sv, "Thu, 01 Jan 2026 00:00:00 GMT"sv}});
+				return CURLE_OK;
+			}
+		};
+
+		class ImplSecond : public CURL {
+			CURLcode perform() override {
+				++server.requests;
+				server.last_headers = request_headers();
+				set_response(200, second_content, {{"Content-Type"sv, "application/yaml"sv}, {"ETag"sv, "\"v2\""sv}});
+				return CURLE_OK;
+			}
+		};
+
+		class ImplNotModified : public CURL {
+			CURLcode perform() override {
+				++server.requests;
+				server.last_headers = request_headers();
+				set_response(304, ""sv);
+				return CURLE_OK;
+			}
+		};
+
+		class ImplOffline : public CURL {
+			CURLcode perform() override {
+				++server.requests;
+				return CURLE_COULDNT_CONNECT;
+			}
+		};
+
+		class ImplNotFound : public CURL {
+			CURLcode perform() override {
+				++server.requests;
+				set_response(404, ""sv, {{"Content-Type"sv, "text/plain"sv}});
+				return CURLE_OK;
+			}
+		};
+
+		bool has_header(std::string_view line) {
+			return std::ranges::find(server.last_headers, line) != server.last_headers.end();
+		}
+	}  // namespace
+
+	class http_cache : public ::testing::Test {
+	protected:
+		http_cache_options options_{};
+		std::chrono::system_clock::time_point now_{std::chrono::sys_days{2026y / 1 / 15} + 12h};
+
+		void SetUp() override {
+			auto const* const info = ::testing::UnitTest::GetInstance()->current_test_info();
+			auto const dirname = fmt::format("quick_dra-http_cache-{}", info->name());
+			options_.dir = std::filesystem::temp_directory_path() / dirname;
+			options_.ttl = 1h;
+			std::filesystem::remove_all(options_.dir);
+			server = {};
+
+			// every test starts with the first version stored
+			set_curl_factory<ImplFirst>();
+			auto const first = cached_http_get(std::string{url}, options_, now_);
+			ASSERT_EQ(first.source, http_cache_source::network);
+			ASSERT_EQ(first.response.text(), first_content);
+			ASSERT_TRUE(server.last_headers.empty());
+		}
+
+		void TearDown() override { std::filesystem::remove_all(options_.dir); }
+	};
+
+	TEST_F(http_cache, fresh_within_ttl) {
+		set_curl_factory<ImplOffline>();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 59min);
+		EXPECT_EQ(actual.source, http_cache_source::fresh);
+		EXPECT_EQ(server.requests, 1u);
+		EXPECT_TRUE(actual.response);
+		EXPECT_EQ(actual.response.text(), first_content);
+		EXPECT_EQ(actual.response.content_type.type, "application"sv);
+		EXPECT_EQ(actual.response.content_type.subtype, "yaml"sv);
+		EXPECT_EQ(actual.response.charset, "utf-8"sv);
+		EXPECT_EQ(actual.response.validators.etag, "\"v1\""sv);
+	}
+
+	TEST_F(http_cache, revalidated_after_ttl) {
+		set_curl_factory<ImplNotModified>();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 2h);
+		EXPECT_EQ(actual.source, http_cache_source::revalidated);
+		EXPECT_EQ(server.requests, 2u);
+		EXPECT_TRUE(has_header("If-None-Match: \"v1\""sv));
+		EXPECT_TRUE(has_header("If-Modified-Since: Thu, 01 Jan 2026 00:00:00 GMT"sv));
+		EXPECT_EQ(actual.response.text(), first_content);
+
+		// the 304 restarted the TTL
+		set_curl_factory<ImplOffline>();
+		auto const again = cached_http_get(std::string{url}, options_, now_ + 2h + 30min);
+		EXPECT_EQ(again.source, http_cache_source::fresh);
+		EXPECT_EQ(server.requests, 2u);
+	}
+
+	TEST_F(http_cache, replaced_when_modified) {
+		set_curl_factory<ImplSecond>();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 2h);
+		EXPECT_EQ(actual.source, http_cache_source::network);
+		EXPECT_EQ(actual.response.text(), second_content);
+
+		set_curl_factory<ImplNotModified>();
+		auto const again = cached_http_get(std::string{url}, options_, now_ + 4h);
+		EXPECT_EQ(again.source, http_cache_source::revalidated);
+		EXPECT_TRUE(has_header("If-None-Match: \"v2\""sv));
+		EXPECT_FALSE(has_header("If-Modified-Since: Thu, 01 Jan 2026 00:00:00 GMT"sv));
+		EXPECT_EQ(again.response.text(), second_content);
+	}
+
+	TEST_F(http_cache, stale_when_offline) {
+		set_curl_factory<ImplOffline>();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 2h);
+		EXPECT_EQ(actual.source, http_cache_source::stale);
+		EXPECT_EQ(server.requests, 2u);
+		EXPECT_EQ(actual.response.text(), first_content);
+	}
+
+	TEST_F(http_cache, not_found_is_not_hidden) {
+		set_curl_factory<ImplNotFound>();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 2h);
+		EXPECT_EQ(actual.source, http_cache_source::network);
+		EXPECT_EQ(actual.response.status, 404u);
+	}
+
+	TEST_F(http_cache, stopped) {
+		set_curl_factory<ImplSecond>();
+		std::stop_source stop{};
+		stop.request_stop();
+		auto const actual = cached_http_get(std::string{url}, options_, now_ + 2h, stop.get_token());
+		EXPECT_FALSE(actual.response);
+		EXPECT_EQ(server.requests, 1u);
+
+		// nothing was stored over the first version
+		auto const again = cached_http_get(std::string{url}, options_, now_ + 30min);
+		EXPECT_EQ(again.source, http_cache_source::fresh);
+		EXPECT_EQ(again.response.text(), first_content);
+	}
+
+	TEST_F(http_cache, disabled) {
+		set_curl_factory<ImplSecond>();
+		auto const actual = cached_http_get(std::string{url}, {}, now_);
+		EXPECT_EQ(actual.source, http_cache_source::network);
+		EXPECT_EQ(server.requests, 2u);
+		EXPECT_EQ(actual.response.text(), second_content);
+	}
+}  // namespace quick_dra::testing
@@ -157,12 +157,22 @@ enum CURLcode : int {
 #define CURLoption auto
 
 using curl_write_callback = std::size_t (*)(char* contents, std::size_t size, std::size_t nmemb, void* userp);
+
+struct curl_slist {
+	char* data;
+	curl_slist* next;
+};
+
+curl_slist* curl_slist_append(curl_slist* list, const char* data);
+void curl_slist_free_all(curl_slist* list);
+
 #define OPTION(X)                    \
 	X(str, char const*)              \
 	X(long, long)                    \
 	X(bool, bool)                    \
 	X(write_fn, curl_write_callback) \
-	X(ptr, void*)
+	X(ptr, void*)                    \
+	X(slist, curl_slist*)
 
 #define INFO(X) X(long, long)
 
@@ -200,6 +210,13 @@ OPT(CURLOPT_FOLLOWLOCATION, long, 3);
 OPT(CURLOPT_WRITEFUNCTION, write_fn, 4);
 OPT(CURLOPT_WRITEDATA, ptr, 5);
 OPT(CURLOPT_SSL_VERIFYPEER, bool, 6);
+OPT(CURLOPT_HTTPHEADER, slist, 7);
+OPT(CURLOPT_TIMEOUT_MS, long, 8);
+OPT(CURLOPT_CONNECTTIMEOUT_MS, long, 9);
+OPT(CURLOPT_HTTP_VERSION, long, 10);
+OPT(CURLOPT_PIPEWAIT, long, 11);
+
+static constexpr long CURL_HTTP_VERSION_2TLS = 4;
 
 NFO(CURLINFO_RESPONSE_CODE, long, 1001);
 
@@ -224,3 +241,45 @@ CURLHcode curl_easy_header(CURL* easy,
                            CURLH_HEADER_t origin,
                            int request,
                            curl_header** hout);
+
+// multi interface, performing all added transfers on the next curl_multi_perform
+
+class CURLM;
+
+enum CURLMcode : int {
+	CURLM_CALL_MULTI_PERFORM = -1,
+	CURLM_OK,
+	CURLM_BAD_HANDLE,      /* the passed-in handle is not a valid CURLM handle */
+	CURLM_BAD_EASY_HANDLE, /* an easy handle was not good/valid */
+	CURLM_OUT_OF_MEMORY,   /* if you ever get this, you are in deep sh*t */
+	CURLM_INTERNAL_ERROR,  /* this is a libcurl bug */
+};
+
+enum CURLMSG { CURLMSG_NONE, CURLMSG_DONE, CURLMSG_LAST };
+
+struct CURLMsg {
+	CURLMSG msg;       /* what this message means */
+	CURL* easy_handle; /* the handle it concerns */
+	union {
+		void* whatever;  /* message-specific data */
+		CURLcode result; /* return code for transfer */
+	} data;
+};
+
+enum CURLMoption : int {
+	CURLMOPT_PIPELINING = 3,
+	CURLMOPT_MAX_HOST_CONNECTIONS = 7,
+	CURLMOPT_MAX_TOTAL_CONNECTIONS = 13,
+};
+
+static constexpr long CURLPIPE_MULTIPLEX = 2;
+
+CURLM* curl_multi_init();
+CURLMcode curl_multi_cleanup(CURLM* multi);
+CURLMcode curl_multi_setopt(CURLM* multi, CURLMoption option, long value);
+CURLMcode curl_multi_add_handle(CURLM* multi, CURL* easy);
+CURLMcode curl_multi_remove_handle(CURLM* multi, CURL* easy);
+CURLMcode curl_multi_perform(CURLM* multi, int* running_handles);
+CURLMsg* curl_multi_info_read(CURLM* multi, int* msgs_in_queue);
+CURLMcode curl_multi_poll(CURLM* multi, void* extra_fds, unsigned int extra_nfds, int timeout_ms, int* ret);
+CURLMcode curl_multi_wakeup(CURLM* multi);
@@ -2,6 +2,11 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include "mock.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
 
 namespace {
 	std::pair<mock_curl_factory, void*> global_factory{nullptr, nullptr};
@@ -18,6 +23,30 @@ std::pair<mock_curl_factory, void*> set_curl_factory(mock_curl_factory factory,
 }
 
 CURLcode curl_global_init(global_default_value) { return global_init_value; }
+
+curl_slist* curl_slist_append(curl_slist* list, const char* data) {
+	auto const length = std::strlen(data);
+	auto copy = new char[length + 1];
+	std::memcpy(copy, data, length + 1);
+	auto item = new curl_slist{.data = copy, .next = nullptr};
+
+	if (!list) return item;
+	auto last = list;
+	while (last->next) {
+		last = last->next;
+	}
+	last->next = item;
+	return list;
+}
+
+void curl_slist_free_all(curl_slist* list) {
+	while (list) {
+		auto next = list->next;
+		delete[] list->data;
+		delete list;
+		list = next;
+	}
+}
 void curl_global_cleanup() {}
 
 CURL* curl_easy_init() {
@@ -70,6 +99,15 @@ CURLHcode CURL::header(const char* name, size_t, curl_header** hout) {
 	return CURLHE_OK;
 }
 
+std::vector<std::string> CURL::request_headers() {
+	std::vector<std::string> result{};
+	auto const p_list = getopt(CURLOPT_HTTPHEADER);
+	for (auto item = p_list ? *p_list : nullptr; item; item = item->next) {
+		result.emplace_back(item->data);
+	}
+	return result;
+}
+
 void CURL::set_response(long status,
                         std::string_view contents,
                         std::map<std::string_view, std::string_view> const& headers) {
@@ -102,3 +140,80 @@ void CURL::set_response(long status,
 		storage->value = value_view;
 	}
 }
+
+class CURLM {
+public:
+	std::mutex mtx{};
+	std::condition_variable cv{};
+	std::vector<CURL*> added{};
+	std::deque<CURLMsg> done{};
+	CURLMsg current{};
+	bool woken{false};
+};
+
+CURLM* curl_multi_init() { return new CURLM{}; }
+
+CURLMcode curl_multi_cleanup(CURLM* multi) {
+	delete multi;
+	return CURLM_OK;
+}
+
+CURLMcode curl_multi_setopt(CURLM*, CURLMoption, long) { return CURLM_OK; }
+
+CURLMcode curl_multi_add_handle(CURLM* multi, CURL* easy) {
+	std::lock_guard lock{multi->mtx};
+	multi->added.push_back(easy);
+	return CURLM_OK;
+}
+
+CURLMcode curl_multi_remove_handle(CURLM* multi, CURL* easy) {
+	std::lock_guard lock{multi->mtx};
+	std::erase(multi->added, easy);
+	std::erase_if(multi->done, [easy](CURLMsg const& msg) { return msg.easy_handle == easy; });
+	return CURLM_OK;
+}
+
+CURLMcode curl_multi_perform(CURLM* multi, int* running_handles) {
+	std::vector<CURL*> added{};
+	{
+		std::lock_guard lock{multi->mtx};
+		std::swap(added, multi->added);
+	}
+
+	for (auto easy : added) {
+		auto const result = easy->perform();
+		std::lock_guard lock{multi->mtx};
+		multi->done.push_back({.msg = CURLMSG_DONE, .easy_handle = easy, .data = {.result = result}});
+	}
+
+	if (running_handles) *running_handles = 0;
+	return CURLM_OK;
+}
+
+CURLMsg* curl_multi_info_read(CURLM* multi, int* msgs_in_queue) {
+	std::lock_guard lock{multi->mtx};
+	if (multi->done.empty()) {
+		if (msgs_in_queue) *msgs_in_queue = 0;
+		return nullptr;
+	}
+	multi->current = multi->done.front();
+	multi->done.pop_front();
+	if (msgs_in_queue) *msgs_in_queue = static_cast<int>(multi->done.size());
+	return &multi->current;
+}
+
+CURLMcode curl_multi_poll(CURLM* multi, void*, unsigned int, int timeout_ms, int* ret) {
+	std::unique_lock lock{multi->mtx};
+	multi->cv.wait_for(lock, std::chrono::milliseconds{timeout_ms},
+	                   [multi] { return multi->woken || !multi->added.empty(); });
+	multi->woken = false;
+	if (ret) *ret = 0;
+	return CURLM_OK;
+}
+
+CURLMcode curl_multi_wakeup(CURLM* multi) {
+	std::lock_guard lock{multi->mtx};
+	multi->woken = true;
+	multi->cv.notify_all();
+	return CURLM_OK;
+}
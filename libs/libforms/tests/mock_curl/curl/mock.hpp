@@ -61,6 +61,9 @@ public:
 	virtual CURLcode perform() = 0;
 	virtual CURLHcode header(const char* name, size_t index, curl_header** hout);
 
+	// lines set with CURLOPT_HTTPHEADER, valid until the request ends
+	std::vector<std::string> request_headers();
+
 	void set_response(long status,
 	                  std::string_view contents,
 	                  std::map<std::string_view, std::string_view> const& headers = {});
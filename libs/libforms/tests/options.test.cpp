@@ -7,6 +7,7 @@
 #include <curl/mock.hpp>
 #include <quick_dra/base/paths.hpp>
 #include <quick_dra/io/options.hpp>
+#include <quick_dra/io/tax_config.hpp>
 #include <span>
 #include <sstream>
 
@@ -17,6 +18,18 @@ namespace quick_dra::testing {
 	using std::literals::operator""sv;
 	using std::literals::operator""y;
 
+	// the expected logs below depend on a real download each time
+	class NoDownloadCache : public ::testing::Environment {
+		void SetUp() override {
+			auto source = tax_config_download_source();
+			source.url = GITHUB_MAIN_REF "/data/config/tax_config.yaml"s;
+			source.cache.dir.clear();
+			tax_config_download_source(source);
+		}
+	};
+
+	[[maybe_unused]] auto const* const no_download_cache = ::testing::AddGlobalTestEnvironment(new NoDownloadCache{});
+
 	class ImplNoTaxConfig : public CURL {
 		CURLcode perform() override {
 			set_response(404, ""sv, {{"content-type"sv, "text/plain"sv}});
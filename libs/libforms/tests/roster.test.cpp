@@ -0,0 +1,86 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <quick_dra/docs/forms.hpp>
+#include <quick_dra/fixtures/config.hpp>
+#include <random>
+#include <string>
+
+namespace quick_dra::testing {
+	using std::literals::operator""s;
+	using std::literals::operator""y;
+
+	namespace {
+		config random_config(unsigned seed, size_t count) {
+			auto cfg = fixtures::empty_config();
+
+			std::mt19937 rng{seed};
+			std::uniform_int_distribution<long long> salary_dist{0, 40'000'00};
+			std::uniform_int_distribution<unsigned> den_dist{0, 8};
+			std::uniform_int_distribution<unsigned> salary_kind_dist{0, 7};
+			std::bernoulli_distribution full_time_dist{0.125};
+
+			// some full-time, some with a zero (meaning one) in the scale,
+			// some on the minimal pay and some with no pay at all
+			cfg.insured.reserve(count);
+			for (size_t index = 0; index < count; ++index) {
+				auto const den = den_dist(rng);
+				std::optional<ratio> scale{};
+				if (!full_time_dist(rng)) scale = ratio{std::uniform_int_distribution<unsigned>{0, den}(rng), den};
+				std::optional<currency> salary{};
+				switch (salary_kind_dist(rng)) {
+					case 0:
+					case 1:
+						break;
+					case 2:
+						salary = currency{};
+						break;
+					default:
+						salary = currency{salary_dist(rng)};
+				}
+				cfg.insured.push_back(fixtures::insured(index, salary, scale));
+			}
+
+			return cfg;
+		}
+	}  // namespace
+
+	TEST(roster, same_as_calc_rca) {
+		for (auto const seed : {1u, 2u, 3u}) {
+			auto const cfg = random_config(seed, 500);
+			auto const date = 2026y / 1;
+			auto const forms = prepare_form_set(verbose::none, 1, date, 2026y / 2 / 5, cfg);
+			ASSERT_EQ(forms.size(), cfg.insured.size() + 1);
+
+			tax_scale const tax{cfg.params.scale};
+			roster_amounts actual{};
+			calc_roster(make_roster(date, cfg),
+			            {
+			                .contributions = cfg.params.contributions,
+			                .costs_of_obtaining = cfg.params.costs_of_obtaining.local,
+			                .tax = tax,
+			            },
+			            actual);
+
+			for (size_t index = 0; index < cfg.insured.size(); ++index) {
+				auto const& state = forms[index].state;
+				auto const label = fmt::format("seed {}, #{}", seed, index);
+
+				EXPECT_EQ(actual.baseline[index], state.typed_value<currency>(var::salary.gross)) << label;
+				EXPECT_EQ(actual.net[index], state.typed_value<currency>(var::salary.net)) << label;
+				EXPECT_EQ(actual.payer_gross[index], state.typed_value<currency>(var::salary.payer_gross)) << label;
+				EXPECT_EQ(actual.taxed_baseline[index], state.typed_value<currency>(var::health_baseline)) << label;
+				EXPECT_EQ(actual.health_contribution[index], state.typed_value<currency>(var::health_contribution))
+				    << label;
+				EXPECT_EQ(actual.tax[index], state.typed_value<currency>(var::tax_total)) << label;
+#define X(NAME, _)                                                                              \
+	EXPECT_EQ(actual.NAME.payer[index], state.typed_value<currency>(var::NAME.payer)) << label; \
+	EXPECT_EQ(actual.NAME.insured[index], state.typed_value<currency>(var::NAME.insured)) << label;
+				CONTRIBUTIONS(X)
+#undef X
+			}
+		}
+	}
+}  // namespace quick_dra::testing
@@ -0,0 +1,98 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <map>
+#include <optional>
+#include <quick_dra/io/tax_config.hpp>
+#include <string>
+
+namespace quick_dra::testing {
+	using std::literals::operator""s;
+	using std::literals::operator""y;
+
+	namespace {
+		tax_config simple_tax_config() {
+			auto result = tax_config::parse_from_text(R"(version: 1
+
+scale:
+  2022/1:
+    30000 zł: 17%
+    120000 zł: 32%
+  2022/7:
+    30000 zł: 12%
+    120000 zł: 32%
+
+minimal-pay:
+  2022/01: 3010 zł
+  2023/01: 3490 zł
+  2023/07: 3600 zł
+  2024/01: 4242 zł
+
+costs-of-obtaining:
+  2022/01: { local: 250 zł, remote: 300 zł }
+
+contributions:
+  2022/01:
+    emerytalne: { płatnik: 9.76%, ubezpieczony: 9.76% }
+    rentowe: { płatnik: 6.5%, ubezpieczony: 1.5% }
+    chorobowe: { ubezpieczony: 2.45% }
+    wypadkowe: { płatnik: 1.67% }
+    zdrowotne: { ubezpieczony: 9% }
+  2023/04:
+    emerytalne: { płatnik: 9.76%, ubezpieczony: 9.76% }
+    rentowe: { płatnik: 6.5%, ubezpieczony: 1.5% }
+    chorobowe: { ubezpieczony: 2.45% }
+    wypadkowe: { płatnik: 1.67% }
+    zdrowotne: { ubezpieczony: 9% }
+)"s,
+			                                          "tax_config.yaml"s);
+			return result.value_or(tax_config{});
+		}
+
+		void expect_same(tax_parameters const& actual, tax_parameters const& expected, year_month const& month) {
+			EXPECT_EQ(actual.scale, expected.scale) << fmt_date(month);
+			EXPECT_EQ(actual.minimal_pay, expected.minimal_pay) << fmt_date(month);
+			EXPECT_EQ(actual.costs_of_obtaining, expected.costs_of_obtaining) << fmt_date(month);
+			EXPECT_EQ(actual.contributions, expected.contributions) << fmt_date(month);
+		}
+	}  // namespace
+
+	TEST(tax_config, resolved_segments) {
+		auto const config = simple_tax_config();
+		ASSERT_FALSE(config.minimal_pay.empty());
+
+		resolved_tax_parameters const resolved{config};
+		// 2022/01, 2022/07, 2023/01, 2023/04, 2023/07 and 2024/01
+		EXPECT_EQ(resolved.size(), 6u);
+
+		EXPECT_EQ(resolved.at(2021y / 12).minimal_pay, currency{});
+		EXPECT_EQ(resolved.at(2022y / 6).minimal_pay, 3010_PLN);
+		EXPECT_EQ(resolved.at(2023y / 6).minimal_pay, 3490_PLN);
+		EXPECT_EQ(resolved.at(2030y / 1).minimal_pay, 4242_PLN);
+		// the same segment, the same object
+		EXPECT_EQ(&resolved.at(2023y / 7), &resolved.at(2023y / 12));
+	}
+
+	TEST(tax_config, resolved_matches_lookup) {
+		auto const config = simple_tax_config();
+		resolved_tax_parameters const resolved{config};
+		std::map<year_month, percent> const accident_insurance{{2023y / 1, 0.93_per}};
+
+		for (auto month = 2021y / 1; month < 2025y / 1; month += months{1}) {
+			tax_parameters expected{};
+			std::optional<tax_parameters> storage{};
+			lookup_parameters(expected, config, std::nullopt, month);
+			auto const& plain = lookup_parameters(storage, resolved, std::nullopt, month);
+			expect_same(plain, expected, month);
+			// nothing overridden, nothing copied
+			EXPECT_EQ(&plain, &resolved.at(month));
+			EXPECT_FALSE(storage);
+
+			lookup_parameters(expected, config, accident_insurance, month);
+			auto const& overridden = lookup_parameters(storage, resolved, accident_insurance, month);
+			expect_same(overridden, expected, month);
+			EXPECT_EQ(&overridden, &*storage);
+		}
+	}
+}  // namespace quick_dra::testing
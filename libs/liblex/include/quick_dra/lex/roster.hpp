@@ -0,0 +1,55 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <quick_dra/base/types.hpp>
+#include <quick_dra/lex/tax.hpp>
+#include <vector>
+
+namespace quick_dra {
+	// Column-oriented view of the insured people needed for the RCA
+	// amounts: the gross salary (with the minimal pay already filled in)
+	// and the part-time scale, both valid for the month reported.
+	struct roster {
+		std::vector<currency> salary{};
+		std::vector<unsigned> scale_num{};
+		std::vector<unsigned> scale_den{};
+
+		size_t size() const noexcept { return salary.size(); }
+		void reserve(size_t count);
+		void push_back(currency salary, ratio scale);
+	};
+
+	struct roster_parameters {
+		rates const& contributions;
+		currency costs_of_obtaining{};
+		tax_scale const& tax;
+	};
+
+	struct contribution_columns {
+		std::vector<currency> payer{};
+		std::vector<currency> insured{};
+	};
+
+	// All the amounts calc_rca puts into an RCA form, one column each.
+	struct roster_amounts {
+		std::vector<currency> baseline{};
+#define X(NAME, _) contribution_columns NAME{};
+		CONTRIBUTIONS(X)
+#undef X
+		std::vector<currency> insured_total{};
+		std::vector<currency> payer_total{};
+		std::vector<currency> taxed_baseline{};
+		std::vector<currency> tax{};
+		std::vector<currency> health_contribution{};
+		std::vector<currency> net{};
+		std::vector<currency> payer_gross{};
+
+		void resize(size_t count);
+	};
+
+	// Computes, stage by stage over the whole roster, the same amounts as
+	// calc_rca does for each person.
+	void calc_roster(roster const& people, roster_parameters const& params, roster_amounts& out);
+}  // namespace quick_dra
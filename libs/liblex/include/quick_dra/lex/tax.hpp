@@ -5,8 +5,38 @@
 
 #include <map>
 #include <quick_dra/base/types.hpp>
+#include <span>
+#include <vector>
 
 namespace quick_dra {
 	currency calc_tax_lowering_amount(std::map<currency, percent> const& scale) noexcept;
 	currency calc_tax_owed(std::map<currency, percent> const& scale, currency taxable_amount) noexcept;
+
+	// The tax scale from tax_parameters, compiled into brackets with the tax
+	// owed on everything below each of them already summed up. Gives the same
+	// results as calc_tax_lowering_amount and calc_tax_owed, without walking
+	// the map for every insured person.
+	class tax_scale {
+	public:
+		tax_scale() = default;
+		explicit tax_scale(std::map<currency, percent> const& scale);
+
+		currency lowering_amount() const noexcept { return lowering_amount_; }
+		currency owed(currency taxable_amount) const noexcept;
+		// out must be at least as long as taxable_amounts
+		void owed(std::span<currency const> taxable_amounts, std::span<currency> out) const noexcept;
+
+	private:
+		struct bracket {
+			calc_currency base{};
+			percent rate{};
+			calc_currency owed_below{};
+		};
+
+		calc_currency yearly_owed(calc_currency yearly) const noexcept;
+
+		// the first bracket is the tax-free one, from zero to the first threshold
+		std::vector<bracket> brackets_{bracket{}};
+		currency lowering_amount_{};
+	};
 };  // namespace quick_dra
@@ -3,34 +3,69 @@
 
 #pragma once
 
+#include <bit>
 #include <chrono>
+#include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace quick_dra {
 	static constexpr auto kInvalidChecksum = std::numeric_limits<unsigned short>::max();
 
+	class validity_bitmap {
+	public:
+		validity_bitmap() = default;
+		explicit validity_bitmap(size_t size) : size_{size}, words_((size + kWordBits - 1) / kWordBits) {}
+
+		size_t size() const noexcept { return size_; }
+		bool operator[](size_t index) const noexcept { return (words_[index / kWordBits] >> (index % kWordBits)) & 1u; }
+		void set(size_t index) noexcept { words_[index / kWordBits] |= std::uint64_t{1} << (index % kWordBits); }
+
+		size_t count() const noexcept {
+			size_t result = 0;
+			for (auto const word : words_) {
+				result += static_cast<size_t>(std::popcount(word));
+			}
+			return result;
+		}
+
+		std::span<std::uint64_t const> words() const noexcept { return words_; }
+
+	private:
+		static constexpr size_t kWordBits = 64;
+
+		size_t size_{};
+		std::vector<std::uint64_t> words_{};
+	};
+
 	namespace detail {
 		struct tax_id {
 			static size_t length() noexcept;
 			static unsigned short checksum(std::string_view id) noexcept;
+			static void checksums(std::string_view ids, std::span<unsigned short> out) noexcept;
 		};
 
 		struct social_id {
 			static size_t length() noexcept;
 			static unsigned short checksum(std::string_view id) noexcept;
+			static void checksums(std::string_view ids, std::span<unsigned short> out) noexcept;
 			static std::chrono::year_month_day get_birthday(std::string_view social_id) noexcept;
+			static void get_birthdays(std::string_view social_ids, std::span<std::chrono::year_month_day> out) noexcept;
 		};
 
 		struct id_card {
 			static size_t length() noexcept;
 			static unsigned short checksum(std::string_view id) noexcept;
+			static void checksums(std::string_view ids, std::span<unsigned short> out) noexcept;
 		};
 
 		struct pl_passport {
 			static size_t length() noexcept;
 			static unsigned short checksum(std::string_view id) noexcept;
+			static void checksums(std::string_view ids, std::span<unsigned short> out) noexcept;
 		};
 
 		template <typename impl>
@@ -74,6 +109,26 @@ namespace quick_dra {
 			if (checksum == kInvalidChecksum) return false;
 			return compare_t::checksum_is_valid(checksum, selector_t::select(id));
 		}
+
+		// Validates `ids.size() / length()` IDs laid out back to back, with no
+		// separators; a trailing partial ID is ignored.
+		static validity_bitmap validate_batch(std::string_view ids) {
+			auto const length = checksum_t::length();
+			auto const count = ids.size() / length;
+
+			std::vector<unsigned short> checksums(count);
+			checksum_t::checksums(ids.substr(0, count * length), checksums);
+
+			validity_bitmap result{count};
+			for (size_t index = 0; index < count; ++index) {
+				if (checksums[index] == kInvalidChecksum) continue;
+				auto const id = ids.substr(index * length, length);
+				if (compare_t::checksum_is_valid(checksums[index], selector_t::select(id))) {
+					result.set(index);
+				}
+			}
+			return result;
+		}
 	};
 
 	using tax_id_validator = validator_suite<detail::tax_id, detail::select_last_character>;
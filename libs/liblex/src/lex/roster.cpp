@@ -0,0 +1,97 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <algorithm>
+#include <quick_dra/lex/roster.hpp>
+#include <span>
+#include <vector>
+
+namespace quick_dra {
+	namespace {
+		inline currency clamp(currency const& v) noexcept { return v.value < 0 ? currency{} : v; }
+
+		inline currency round_to_whole(currency const& v) noexcept {
+			return currency{((v.value + (currency::den / 2)) / currency::den) * currency::den};
+		}
+
+		void contribution_on(std::span<currency const> baseline, percent rate, std::span<currency> out) noexcept {
+			for (size_t index = 0; index < baseline.size(); ++index) {
+				out[index] = (baseline[index].calc() * rate).rounded();
+			}
+		}
+
+		void add(std::span<currency> total, std::span<currency const> addend) noexcept {
+			for (size_t index = 0; index < total.size(); ++index) {
+				total[index] = total[index] + addend[index];
+			}
+		}
+	}  // namespace
+
+	void roster::reserve(size_t count) {
+		salary.reserve(count);
+		scale_num.reserve(count);
+		scale_den.reserve(count);
+	}
+
+	void roster::push_back(currency amount, ratio scale) {
+		salary.push_back(amount);
+		scale_num.push_back(std::max(1u, scale.num));
+		scale_den.push_back(std::max(1u, scale.den));
+	}
+
+	void roster_amounts::resize(size_t count) {
+		baseline.resize(count);
+#define X(NAME, _)            \
+	NAME.payer.resize(count); \
+	NAME.insured.resize(count);
+		CONTRIBUTIONS(X)
+#undef X
+		insured_total.assign(count, currency{});
+		payer_total.assign(count, currency{});
+		taxed_baseline.resize(count);
+		tax.resize(count);
+		health_contribution.resize(count);
+		net.resize(count);
+		payer_gross.resize(count);
+	}
+
+	void calc_roster(roster const& people, roster_parameters const& params, roster_amounts& out) {
+		auto const size = people.size();
+		out.resize(size);
+
+		for (size_t index = 0; index < size; ++index) {
+			auto const scaled = people.salary[index].calc().value * people.scale_num[index] / people.scale_den[index];
+			out.baseline[index] = calc_currency{scaled}.rounded();
+		}
+
+#define X(NAME, _)                                                                      \
+	contribution_on(out.baseline, params.contributions.NAME.payer, out.NAME.payer);     \
+	contribution_on(out.baseline, params.contributions.NAME.insured, out.NAME.insured); \
+	add(out.payer_total, out.NAME.payer);                                               \
+	add(out.insured_total, out.NAME.insured);
+		CONTRIBUTIONS(X)
+#undef X
+
+		for (size_t index = 0; index < size; ++index) {
+			auto const deductible = out.insured_total[index] + params.costs_of_obtaining;
+			out.taxed_baseline[index] = round_to_whole(clamp(out.baseline[index] - deductible));
+		}
+
+		params.tax.owed(out.taxed_baseline, out.tax);
+
+		auto const lowering_amount = params.tax.lowering_amount();
+		auto const health_rate = params.contributions.health.insured;
+		for (size_t index = 0; index < size; ++index) {
+			auto const health_lowered = clamp(out.tax[index] - lowering_amount);
+			auto const health_intermediate =
+			    (clamp(out.baseline[index] - out.insured_total[index]).calc() * health_rate).rounded();
+			out.health_contribution[index] = std::min(health_intermediate, health_lowered);
+		}
+
+		for (size_t index = 0; index < size; ++index) {
+			auto const cost_on_insured = out.insured_total[index] + out.tax[index] + out.health_contribution[index];
+			out.net[index] = clamp(out.baseline[index] - cost_on_insured);
+			out.payer_gross[index] = out.baseline[index] + out.payer_total[index];
+		}
+	}
+}  // namespace quick_dra
@@ -1,6 +1,7 @@
 // Copyright (c) 2026 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
 #include <map>
 #include <quick_dra/lex/tax.hpp>
 
@@ -42,4 +43,42 @@ namespace quick_dra {
 
 		return calc_currency{(tax_owed).value / 12}.rounded();
 	}
+
+	tax_scale::tax_scale(std::map<currency, percent> const& scale) : lowering_amount_{calc_tax_lowering_amount(scale)} {
+		brackets_.reserve(scale.size() + 1);
+		for (auto const& [amount, tax_rate] : scale) {
+			auto const& prev = brackets_.back();
+			auto const base = amount.calc();
+			brackets_.push_back({
+			    .base = base,
+			    .rate = tax_rate,
+			    // the same rounding per bracket as in calc_tax_owed
+			    .owed_below = prev.owed_below + (base - prev.base) * prev.rate,
+			});
+		}
+	}
+
+	calc_currency tax_scale::yearly_owed(calc_currency yearly) const noexcept {
+		// a handful of brackets; counting them beats a binary search and has
+		// no branches to mispredict
+		size_t index = 0;
+		for (size_t next = 1; next < brackets_.size(); ++next) {
+			index += static_cast<size_t>(brackets_[next].base <= yearly);
+		}
+
+		auto const& selected = brackets_[index];
+		return selected.owed_below + (yearly - selected.base) * selected.rate;
+	}
+
+	currency tax_scale::owed(currency taxable_amount) const noexcept {
+		auto const tax_owed = yearly_owed(calc_currency{taxable_amount.calc().value * 12});
+		return calc_currency{tax_owed.value / 12}.rounded();
+	}
+
+	void tax_scale::owed(std::span<currency const> taxable_amounts, std::span<currency> out) const noexcept {
+		auto const size = std::min(taxable_amounts.size(), out.size());
+		for (size_t index = 0; index < size; ++index) {
+			out[index] = owed(taxable_amounts[index]);
+		}
+	}
 };  // namespace quick_dra
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cctype>
 #include <list>
+#include <span>
 #include <utility>
+#include "batch.hpp"
 #include "check_compiler.hpp"
 #include "fixed_string.hpp"
 
@@ -34,6 +37,31 @@ namespace quick_dra::checker {
 			return list::sum_values(str, weights, std::make_index_sequence<sizeof...(Action)>{});
 		}
 
+		static constexpr batch::lane_table lanes(weights_t const& weights) noexcept {
+			static_assert(size_ <= batch::kMaxLength);
+			constexpr std::array<char, size_> kinds{Action::kind...};
+
+			batch::lane_table result{.length = size_};
+			for (size_t index = 0; index < size_; ++index) {
+				switch (kinds[index]) {
+					case 'A':
+						result.upper[index] = 0xFF;
+						result.offset[index] = 'A' - 10;
+						result.weight[index] = static_cast<signed char>(weights[index]);
+						break;
+					case '0':
+						result.digit[index] = 0xFF;
+						result.offset[index] = '0';
+						result.weight[index] = static_cast<signed char>(weights[index]);
+						break;
+					default:
+						// ignored characters take no part in the sum
+						break;
+				}
+			}
+			return result;
+		}
+
 	private:
 		template <size_t... I>
 		static bool check_each(std::string_view str, std::index_sequence<I...>) noexcept {
@@ -53,10 +81,15 @@ namespace quick_dra::checker {
 	struct weights_wrapper {
 		using list = List;
 		static constexpr auto weights = Input;
+		static constexpr auto lanes = list::lanes(weights);
 
 		bool check(std::string_view str) const noexcept { return list::check(str); }
 
 		int weighted_sum(std::string_view str) const noexcept { return list::weighted_sum(str, weights); }
+
+		void weighted_sums(std::string_view ids, std::span<int> sums) const noexcept {
+			batch::weighted_sums(lanes, ids, sums);
+		}
 	};
 
 	template <CHECKER_TEMPLATE_COPY_TYPE Input, typename List, typename PostprocLambda>
@@ -69,6 +102,25 @@ namespace quick_dra::checker {
 			auto const sum = this->weighted_sum(id);
 			return static_cast<unsigned short>(static_cast<PostprocLambda const&>(*this)(sum));
 		}
+
+		// Batch version of checksum() for `out.size()` IDs laid out back to
+		// back in `ids`, with no separators.
+		void checksums(std::string_view ids, std::span<unsigned short> out) const noexcept {
+			static constexpr size_t chunk_size = 256;
+			std::array<int, chunk_size> sums{};
+
+			auto const length = this->lanes.length;
+			for (size_t from = 0; from < out.size(); from += chunk_size) {
+				auto const count = std::min(chunk_size, out.size() - from);
+				this->weighted_sums(ids.substr(from * length, count * length), std::span{sums}.first(count));
+				for (size_t index = 0; index < count; ++index) {
+					out[from + index] =
+					    sums[index] < 0
+					        ? kInvalidChecksum
+					        : static_cast<unsigned short>(static_cast<PostprocLambda const&>(*this)(sums[index]));
+				}
+			}
+		}
 	};
 
 	template <CHECKER_TEMPLATE_COPY_TYPE Input, typename List>
@@ -109,6 +161,8 @@ namespace quick_dra::checker {
 	template <>
 	struct action_from_t<'A'> {
 		struct upper_case {
+			static constexpr char kind = 'A';
+
 			bool check(unsigned char ch) const noexcept { return std::isalpha(ch) && std::toupper(ch) == ch; }
 
 			int value(unsigned char ch) const noexcept { return ch - 'A' + 10; }
@@ -120,6 +174,8 @@ namespace quick_dra::checker {
 	template <>
 	struct action_from_t<'0'> {
 		struct digit {
+			static constexpr char kind = '0';
+
 			bool check(unsigned char ch) const noexcept { return std::isdigit(ch); }
 
 			int value(unsigned char ch) const noexcept { return ch - '0'; }
@@ -131,6 +187,8 @@ namespace quick_dra::checker {
 	template <>
 	struct action_from_t<'?'> {
 		struct ignore {
+			static constexpr char kind = '?';
+
 			bool check(unsigned char) const noexcept { return true; }
 
 			int value(unsigned char) const noexcept { return 0; }
@@ -0,0 +1,167 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "batch.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define QUICK_DRA_BATCH_X86 1
+#include <immintrin.h>
+#else
+#define QUICK_DRA_BATCH_X86 0
+#endif
+
+#if QUICK_DRA_BATCH_X86 && (defined(__GNUC__) || defined(__clang__))
+// kernels are compiled for their own ISA and picked at run time
+#define QUICK_DRA_BATCH_TARGET(ISA) __attribute__((target(ISA)))
+#define QUICK_DRA_BATCH_RUNTIME_DISPATCH 1
+#else
+#define QUICK_DRA_BATCH_TARGET(ISA)
+#define QUICK_DRA_BATCH_RUNTIME_DISPATCH 0
+#endif
+
+namespace quick_dra::checker::batch {
+	namespace {
+		int scalar_sum(lane_table const& table, char const* id) noexcept {
+			int sum = 0;
+			for (size_t lane = 0; lane < table.length; ++lane) {
+				auto const ch = static_cast<unsigned char>(id[lane]);
+				if (table.digit[lane] && (ch < '0' || ch > '9')) return -1;
+				if (table.upper[lane] && (ch < 'A' || ch > 'Z')) return -1;
+				sum += (ch - table.offset[lane]) * table.weight[lane];
+			}
+			return sum;
+		}
+
+		size_t scalar_sums(lane_table const& table, std::string_view ids, std::span<int> sums, size_t index) noexcept {
+			for (; index < sums.size(); ++index) {
+				sums[index] = scalar_sum(table, ids.data() + index * table.length);
+			}
+			return index;
+		}
+
+#if QUICK_DRA_BATCH_X86
+		enum class kernel { scalar, sse41, avx2 };
+
+		kernel detect_kernel() noexcept {
+#if QUICK_DRA_BATCH_RUNTIME_DISPATCH
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) return kernel::avx2;
+			if (__builtin_cpu_supports("sse4.1")) return kernel::sse41;
+			return kernel::scalar;
+#elif defined(__AVX2__)
+			return kernel::avx2;
+#elif defined(__AVX__)
+			return kernel::sse41;
+#else
+			return kernel::scalar;
+#endif
+		}
+
+		template <typename Array>
+		__m128i load(Array const& lanes) noexcept {
+			return _mm_loadu_si128(reinterpret_cast<__m128i const*>(lanes.data()));
+		}
+
+		// One ID per register: range-check every lane against its class,
+		// then a byte-wise multiply-add of (char - offset) by the weights,
+		// and a horizontal sum of the four 32-bit partial sums.
+		QUICK_DRA_BATCH_TARGET("sse4.1")
+		size_t sse41_sums(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept {
+			auto const digit = load(table.digit);
+			auto const upper = load(table.upper);
+			auto const offset = load(table.offset);
+			auto const weight = load(table.weight);
+			auto const below_digit = _mm_set1_epi8('0' - 1);
+			auto const above_digit = _mm_set1_epi8('9' + 1);
+			auto const below_upper = _mm_set1_epi8('A' - 1);
+			auto const above_upper = _mm_set1_epi8('Z' + 1);
+			auto const ones = _mm_set1_epi16(1);
+
+			auto const length = table.length;
+			size_t index = 0;
+			// a full register must still fit in the input
+			for (; index < sums.size() && index * length + kMaxLength <= ids.size(); ++index) {
+				auto const chars = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ids.data() + index * length));
+				auto const is_digit =
+				    _mm_and_si128(_mm_cmpgt_epi8(chars, below_digit), _mm_cmpgt_epi8(above_digit, chars));
+				auto const is_upper =
+				    _mm_and_si128(_mm_cmpgt_epi8(chars, below_upper), _mm_cmpgt_epi8(above_upper, chars));
+				auto const bad = _mm_or_si128(_mm_andnot_si128(is_digit, digit), _mm_andnot_si128(is_upper, upper));
+				if (!_mm_testz_si128(bad, bad)) {
+					sums[index] = -1;
+					continue;
+				}
+
+				auto const products = _mm_madd_epi16(_mm_maddubs_epi16(_mm_sub_epi8(chars, offset), weight), ones);
+				auto const halves = _mm_add_epi32(products, _mm_shuffle_epi32(products, _MM_SHUFFLE(1, 0, 3, 2)));
+				auto const total = _mm_add_epi32(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+				sums[index] = _mm_cvtsi128_si32(total);
+			}
+			return index;
+		}
+
+		// Two IDs per register, one in each 128-bit half; the AVX2 byte
+		// operations never cross the halves, so this is the SSE kernel twice.
+		QUICK_DRA_BATCH_TARGET("avx2")
+		size_t avx2_sums(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept {
+			auto const digit = _mm256_broadcastsi128_si256(load(table.digit));
+			auto const upper = _mm256_broadcastsi128_si256(load(table.upper));
+			auto const offset = _mm256_broadcastsi128_si256(load(table.offset));
+			auto const weight = _mm256_broadcastsi128_si256(load(table.weight));
+			auto const below_digit = _mm256_set1_epi8('0' - 1);
+			auto const above_digit = _mm256_set1_epi8('9' + 1);
+			auto const below_upper = _mm256_set1_epi8('A' - 1);
+			auto const above_upper = _mm256_set1_epi8('Z' + 1);
+			auto const ones = _mm256_set1_epi16(1);
+
+			auto const length = table.length;
+			size_t index = 0;
+			for (; index + 1 < sums.size() && (index + 1) * length + kMaxLength <= ids.size(); index += 2) {
+				auto const first = ids.data() + index * length;
+				auto const chars = _mm256_inserti128_si256(
+				    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const*>(first))),
+				    _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + length)), 1);
+				auto const is_digit =
+				    _mm256_and_si256(_mm256_cmpgt_epi8(chars, below_digit), _mm256_cmpgt_epi8(above_digit, chars));
+				auto const is_upper =
+				    _mm256_and_si256(_mm256_cmpgt_epi8(chars, below_upper), _mm256_cmpgt_epi8(above_upper, chars));
+				auto const bad =
+				    _mm256_or_si256(_mm256_andnot_si256(is_digit, digit), _mm256_andnot_si256(is_upper, upper));
+				auto const bad_lanes = static_cast<unsigned>(_mm256_movemask_epi8(bad));
+
+				auto const products =
+				    _mm256_madd_epi16(_mm256_maddubs_epi16(_mm256_sub_epi8(chars, offset), weight), ones);
+				auto const halves =
+				    _mm256_add_epi32(products, _mm256_shuffle_epi32(products, _MM_SHUFFLE(1, 0, 3, 2)));
+				auto const total = _mm256_add_epi32(halves, _mm256_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+
+				sums[index] = (bad_lanes & 0xFFFFu) ? -1 : _mm256_extract_epi32(total, 0);
+				sums[index + 1] = (bad_lanes >> 16) ? -1 : _mm256_extract_epi32(total, 4);
+			}
+			return index;
+		}
+#endif
+	}  // namespace
+
+	void weighted_sums(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept {
+		size_t index = 0;
+#if QUICK_DRA_BATCH_X86
+		static auto const selected = detect_kernel();
+		switch (selected) {
+			case kernel::avx2:
+				index = avx2_sums(table, ids, sums);
+				break;
+			case kernel::sse41:
+				index = sse41_sums(table, ids, sums);
+				break;
+			case kernel::scalar:
+				break;
+		}
+#endif
+		scalar_sums(table, ids, sums, index);
+	}
+
+	void weighted_sums_scalar(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept {
+		scalar_sums(table, ids, sums, 0);
+	}
+}  // namespace quick_dra::checker::batch
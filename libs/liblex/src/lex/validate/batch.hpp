@@ -0,0 +1,33 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace quick_dra::checker::batch {
+	// Every supported ID fits a single 128-bit register
+	static constexpr size_t kMaxLength = 16;
+
+	// Per-character description of a mask, laid out the way the SIMD
+	// kernels consume it; lanes at or after `length` are all zero.
+	struct lane_table {
+		size_t length{};
+		std::array<unsigned char, kMaxLength> digit{};
+		std::array<unsigned char, kMaxLength> upper{};
+		std::array<unsigned char, kMaxLength> offset{};
+		std::array<signed char, kMaxLength> weight{};
+	};
+
+	// Writes the weighted sum of each of the `sums.size()` IDs from `ids`,
+	// each `table.length` characters long, with no separators; IDs with a
+	// character not matching the mask get -1.
+	void weighted_sums(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept;
+
+	// Same, but never leaves the scalar code; used for the tail of the input
+	// and to test the vector code against.
+	void weighted_sums_scalar(lane_table const& table, std::string_view ids, std::span<int> sums) noexcept;
+}  // namespace quick_dra::checker::batch
@@ -1,8 +1,10 @@
 // Copyright (c) 2026 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
 #include <array>
 #include <cctype>
+#include <charconv>
 #include <quick_dra/lex/validators.hpp>
 #include "validate/actions.hpp"
 
@@ -45,9 +47,15 @@ namespace quick_dra::detail {
 
 	size_t tax_id::length() noexcept { return decltype(tax_id_checker)::list{}.size(); }
 	unsigned short tax_id::checksum(std::string_view id) noexcept { return tax_id_checker.checksum(id); }
+	void tax_id::checksums(std::string_view ids, std::span<unsigned short> out) noexcept {
+		tax_id_checker.checksums(ids, out);
+	}
 
 	size_t social_id::length() noexcept { return decltype(social_id_checker)::list{}.size(); }
 	unsigned short social_id::checksum(std::string_view id) noexcept { return social_id_checker.checksum(id); }
+	void social_id::checksums(std::string_view ids, std::span<unsigned short> out) noexcept {
+		social_id_checker.checksums(ids, out);
+	}
 
 	std::chrono::year_month_day social_id::get_birthday(std::string_view social_id) noexcept {
 		if (social_id.length() != 11) {
@@ -67,11 +75,24 @@ namespace quick_dra::detail {
 		return result;
 	}
 
+	void social_id::get_birthdays(std::string_view social_ids, std::span<std::chrono::year_month_day> out) noexcept {
+		static constexpr size_t length = 11;
+		for (size_t index = 0; index < out.size(); ++index) {
+			out[index] = get_birthday(social_ids.substr(std::min(social_ids.size(), index * length), length));
+		}
+	}
+
 	size_t id_card::length() noexcept { return decltype(id_card_checker)::list{}.size(); }
 	unsigned short id_card::checksum(std::string_view id) noexcept { return id_card_checker.checksum(id); }
+	void id_card::checksums(std::string_view ids, std::span<unsigned short> out) noexcept {
+		id_card_checker.checksums(ids, out);
+	}
 
 	size_t pl_passport::length() noexcept { return decltype(pl_passport_checker)::list{}.size(); }
 	unsigned short pl_passport::checksum(std::string_view id) noexcept { return pl_passport_checker.checksum(id); }
+	void pl_passport::checksums(std::string_view ids, std::span<unsigned short> out) noexcept {
+		pl_passport_checker.checksums(ids, out);
+	}
 
 	bool checksum_digit_is_valid(unsigned short checksum, char tested) noexcept {
 		auto const ch = checksum + '0';
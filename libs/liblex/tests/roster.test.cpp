@@ -0,0 +1,78 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <quick_dra/fixtures/parameters.hpp>
+#include <quick_dra/lex/roster.hpp>
+#include <random>
+
+// the amounts themselves are checked against calc_rca in libforms' roster test
+namespace quick_dra::testing {
+	namespace {
+		void expect_same_row(roster_amounts const& actual, size_t index, size_t expected, std::string const& label) {
+			EXPECT_EQ(actual.baseline[index], actual.baseline[expected]) << label;
+#define X(NAME, _)                                                                 \
+	EXPECT_EQ(actual.NAME.payer[index], actual.NAME.payer[expected]) << label; \
+	EXPECT_EQ(actual.NAME.insured[index], actual.NAME.insured[expected]) << label;
+			CONTRIBUTIONS(X)
+#undef X
+			EXPECT_EQ(actual.insured_total[index], actual.insured_total[expected]) << label;
+			EXPECT_EQ(actual.payer_total[index], actual.payer_total[expected]) << label;
+			EXPECT_EQ(actual.taxed_baseline[index], actual.taxed_baseline[expected]) << label;
+			EXPECT_EQ(actual.tax[index], actual.tax[expected]) << label;
+			EXPECT_EQ(actual.health_contribution[index], actual.health_contribution[expected]) << label;
+			EXPECT_EQ(actual.net[index], actual.net[expected]) << label;
+			EXPECT_EQ(actual.payer_gross[index], actual.payer_gross[expected]) << label;
+		}
+	}  // namespace
+
+	TEST(roster, empty) {
+		tax_scale const tax{fixtures::tax_scale()};
+		auto const contributions = fixtures::contributions();
+
+		roster_amounts actual{};
+		actual.resize(3);
+		calc_roster({}, {.contributions = contributions, .costs_of_obtaining = fixtures::costs.local, .tax = tax},
+		            actual);
+		EXPECT_TRUE(actual.baseline.empty());
+		EXPECT_TRUE(actual.net.empty());
+		EXPECT_TRUE(actual.payer_gross.empty());
+	}
+
+	TEST(roster, zero_scale_means_one) {
+		tax_scale const tax{fixtures::tax_scale()};
+		auto const contributions = fixtures::contributions();
+
+		std::mt19937 rng{2026};
+		std::uniform_int_distribution<long long> salary_dist{0, 40'000'00};
+		std::uniform_int_distribution<unsigned> den_dist{1, 8};
+
+		// each salary three times: full time, then 0/0 (full time, too),
+		// then 0/den next to 1/den
+		roster people{};
+		people.reserve(4'000);
+		for (size_t index = 0; index < 1'000; ++index) {
+			auto const salary = currency{salary_dist(rng)};
+			auto const den = den_dist(rng);
+			people.push_back(salary, {.num = 1, .den = 1});
+			people.push_back(salary, {.num = 0, .den = 0});
+			people.push_back(salary, {.num = 1, .den = den});
+			people.push_back(salary, {.num = 0, .den = den});
+		}
+
+		roster_amounts actual{};
+		calc_roster(people,
+		            {.contributions = contributions, .costs_of_obtaining = fixtures::costs.local, .tax = tax}, actual);
+		ASSERT_EQ(actual.baseline.size(), people.size());
+		ASSERT_EQ(actual.net.size(), people.size());
+		ASSERT_EQ(actual.payer_gross.size(), people.size());
+
+		for (size_t index = 0; index < people.size(); index += 4) {
+			auto const label = fmt::format("#{}: {} x 1/{}", index / 4, people.salary[index].value,
+			                               people.scale_den[index + 2]);
+			expect_same_row(actual, index + 1, index, label);
+			expect_same_row(actual, index + 3, index + 2, label);
+		}
+	}
+}  // namespace quick_dra::testing
@@ -7,6 +7,7 @@
 #include <quick_dra/lex/tax.hpp>
 #include <span>
 #include <utility>
+#include <vector>
 
 namespace quick_dra {
 	void PrintTo(currency curr, std::ostream* os) { *os << fmt::format("{} zł", curr); }
@@ -62,6 +63,13 @@ namespace quick_dra::testing {
 		ASSERT_EQ(actual, expected.tax_owed);
 	}
 
+	TEST_P(tax, compiled) {
+		auto const& [scale, salary, expected] = GetParam();
+		tax_scale const compiled{from(scale)};
+		ASSERT_EQ(compiled.lowering_amount(), expected.tax_lowering_amount);
+		ASSERT_EQ(compiled.owed(salary), expected.tax_owed);
+	}
+
 	static constexpr auto scale_empty = std::array<std::pair<currency, percent>, 0>{};
 
 	static constexpr auto scale_17_32 = std::array{
@@ -112,4 +120,41 @@ namespace quick_dra::testing {
 	};
 
 	INSTANTIATE_TEST_SUITE_P(test, tax, ::testing::ValuesIn(tests));
+
+	TEST(tax_scale, same_as_calc_tax_owed) {
+		static constexpr auto scale_three = std::array{
+		    std::pair{currency{0'00}, percent{5'00}},
+		    std::pair{currency{30'000'00}, percent{12'33}},
+		    std::pair{currency{85'528'00}, percent{17'77}},
+		    std::pair{currency{120'000'00}, percent{32'00}},
+		};
+
+		for (auto const scale : {std::span<std::pair<currency, percent> const>{scale_empty},
+		                         std::span<std::pair<currency, percent> const>{scale_17_32},
+		                         std::span<std::pair<currency, percent> const>{scale_three}}) {
+			auto const map = from(scale);
+			tax_scale const compiled{map};
+
+			std::vector<currency> amounts{};
+			for (long long value = -1'000'00; value < 20'000'00; value += 7'77) {
+				amounts.push_back(currency{value});
+			}
+			// every threshold, yearly, and around it
+			for (auto const& [amount, _] : scale) {
+				auto const monthly = amount.value / 12;
+				for (auto const delta : {-1ll, 0ll, 1ll}) {
+					amounts.push_back(currency{monthly + delta});
+				}
+			}
+
+			std::vector<currency> batch(amounts.size());
+			compiled.owed(amounts, batch);
+
+			for (size_t index = 0; index < amounts.size(); ++index) {
+				auto const expected = calc_tax_owed(map, amounts[index]);
+				ASSERT_EQ(compiled.owed(amounts[index]), expected) << amounts[index].value;
+				ASSERT_EQ(batch[index], expected) << amounts[index].value;
+			}
+		}
+	}
 }  // namespace quick_dra::testing
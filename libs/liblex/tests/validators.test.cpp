@@ -6,7 +6,9 @@
 #include <array>
 #include <quick_dra/lex/validators.hpp>
 #include <span>
+#include <string>
 #include <utility>
+#include <vector>
 #include "lex/validate/actions.hpp"
 
 namespace quick_dra::testing {
@@ -168,6 +170,76 @@ namespace quick_dra::testing {
 	    "ZZ8999999"_test(8),
 	};
 
+	template <typename ValidatorSuite>
+	void test_batch(std::span<id_testcase const> tests) {
+		std::string ids{};
+		std::vector<id_testcase> fitting{};
+		// repeat the list, so the vector kernels see more than a register's worth
+		for (auto repeat = 0; repeat < 8; ++repeat) {
+			for (auto const& test : tests) {
+				if (test.id.size() != ValidatorSuite::length()) continue;
+				ids.append(test.id);
+				fitting.push_back(test);
+			}
+		}
+
+		auto const valid = ValidatorSuite::validate_batch(ids);
+		ASSERT_EQ(valid.size(), fitting.size());
+
+		std::vector<unsigned short> checksums(fitting.size());
+		ValidatorSuite::checksums(ids, checksums);
+
+		for (size_t index = 0; index < fitting.size(); ++index) {
+			EXPECT_EQ(valid[index], ValidatorSuite::is_valid(fitting[index].id)) << fitting[index];
+			EXPECT_EQ(checksums[index], fitting[index].checksum) << fitting[index];
+		}
+	}
+
+	TEST(validators, batch) {
+		test_batch<tax_id_validator>(tax_id_tests);
+		test_batch<social_id_validator>(social_id_tests);
+		test_batch<id_card_validator>(id_card_tests);
+		test_batch<pl_passport_validator>(pl_passport_tests);
+	}
+
+	TEST(validators, batch_ignores_partial_id) {
+		auto const valid = id_card_validator::validate_batch("AAA000000ABC523456ZZZ"sv);
+		ASSERT_EQ(valid.size(), 2);
+		EXPECT_EQ(valid.count(), 2);
+	}
+
+	TEST(validators, batch_matches_scalar) {
+		constexpr auto id_card_mask = checker::mask<"AAA?00000">.with<7, 3, 1, 0, 7, 3, 1, 7, 3>();
+		std::string ids{};
+		for (unsigned index = 0; index < 1000; ++index) {
+			ids.append(fmt::format("{}{}{}{:06}", static_cast<char>('A' + index % 26),
+			                       static_cast<char>('A' + (index / 26) % 26), index % 7 ? 'Z' : 'z', (index * 7919) % 1'000'000));
+		}
+
+		std::vector<int> simd(1000);
+		std::vector<int> scalar(1000);
+		checker::batch::weighted_sums(id_card_mask.lanes, ids, simd);
+		checker::batch::weighted_sums_scalar(id_card_mask.lanes, ids, scalar);
+		EXPECT_EQ(simd, scalar);
+		EXPECT_EQ(simd[0], -1);
+		EXPECT_EQ(simd[1], id_card_mask.weighted_sum(std::string_view{ids}.substr(9, 9)));
+	}
+
+	TEST(validators, batch_birthdays) {
+		std::string ids{};
+		for (auto const& test : birthday_tests) {
+			ids.append(test.social_id);
+		}
+		ids.append("504A1500000"sv);
+
+		std::vector<std::chrono::year_month_day> birthdays(std::size(birthday_tests) + 1);
+		social_id_validator::get_birthdays(ids, birthdays);
+		for (size_t index = 0; index < std::size(birthday_tests); ++index) {
+			EXPECT_EQ(birthdays[index], birthday_tests[index].expected) << birthday_tests[index];
+		}
+		EXPECT_EQ(birthdays.back(), null_day);
+	}
+
 	INSTANTIATE_TEST_SUITE_P(test, social_id_birthday, ::testing::ValuesIn(birthday_tests));
 	INSTANTIATE_TEST_SUITE_P(bad_test, social_id_birthday, ::testing::ValuesIn(bad_birthday_tests));
 
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <quick_dra/models/types.hpp>
+#include <quick_dra/models/utility_types.hpp>
+#include <string>
+#include <vector>
+
+namespace quick_dra {
+	// Size and modification time of the file, empty if it does not exist;
+	// sidecar files use it to tell if the config was rewritten behind them.
+	std::string file_stamp(std::filesystem::path const& path);
+
+	enum class journal_op {
+		start,
+		insured_add,
+		insured_edit,
+		insured_remove,
+		payer,
+		accident_insurance,
+	};
+
+	struct journal_entry {
+		journal_op op{};
+		std::optional<unsigned> pos{};
+		std::optional<unsigned> every{};
+		std::optional<std::string> base{};
+		std::optional<partial::payer_t> payer{};
+		std::optional<partial::insured_t> insured{};
+		std::optional<std::map<year_month, percent>> accident_insurance{};
+
+		static journal_entry insured_added(partial::insured_t const& insured);
+		static journal_entry insured_edited(unsigned pos, partial::insured_t const& insured);
+		static journal_entry insured_removed(unsigned pos);
+		static journal_entry payer_changed(partial::payer_t const& payer);
+		static journal_entry accident_insurance_changed(std::map<year_month, percent> const& accident_insurance);
+
+		bool apply_to(partial::config& cfg) const;
+
+		bool read(yaml::ref_ctx const& ref);
+		void prepare_for_write();
+		void write(ryml::NodeRef& ref) const;
+	};
+
+	// Sidecar file next to the user config. When present, single-record edits
+	// are appended to it instead of rewriting the whole config; the config is
+	// rewritten (and the journal emptied) every `compact_every` edits.
+	struct config_journal {
+		static constexpr unsigned kDefaultCompactEvery = 64u;
+
+		unsigned compact_every{kDefaultCompactEvery};
+		std::string base{};
+		std::vector<journal_entry> entries{};
+
+		load_status load(std::filesystem::path const& config_path);
+		bool is_stale(std::filesystem::path const& config_path) const;
+		bool replay(partial::config& cfg) const;
+
+		static std::filesystem::path path_for(std::filesystem::path const& config_path);
+		static bool enable(std::filesystem::path const& config_path, unsigned compact_every = kDefaultCompactEvery);
+		static bool disable(std::filesystem::path const& config_path);
+		static bool reset(std::filesystem::path const& config_path);
+		static bool append(std::filesystem::path const& config_path, journal_entry const& change);
+		static bool compact(std::filesystem::path const& config_path);
+	};
+
+	// Stores the change, either by appending it to the journal or by rewriting
+	// the config; `cfg` must already have the change applied.
+	bool commit(partial::config& cfg, std::filesystem::path const& path, journal_entry const& change);
+}  // namespace quick_dra
@@ -6,12 +6,16 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <algorithm>
-#include <cstdio>
+#include <array>
 #include <functional>
 #include <map>
+#include <memory_resource>
+#include <quick_dra/base/chars.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/meta.hpp>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/base/types.hpp>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -36,26 +40,54 @@ namespace quick_dra {
 		constexpr auto operator<=>(varname const&) const noexcept = default;
 	};
 
+	// A variable path split while compiling; the segments point into the
+	// literal, so addressing a variable with one never allocates.
 	struct compiletime_varname {
-		std::string_view name;
-		operator varname() const { return varname::parse(name); }
+		static constexpr size_t max_depth = 4;
+
+		std::string_view name{};
+		std::array<std::string_view, max_depth> segments{};
+		size_t depth{};
+
+		static consteval compiletime_varname from(std::string_view text) {
+			compiletime_varname result{.name = text};
+			auto path = text.starts_with('$') ? text.substr(1) : text;
+			while (true) {
+				if (result.depth == max_depth) throw "variable path too deep";
+				auto const pos = path.find('.');
+				result.segments[result.depth++] = path.substr(0, pos);
+				if (pos == std::string_view::npos) break;
+				path = path.substr(pos + 1);
+			}
+			return result;
+		}
+
+		constexpr std::span<std::string_view const> path() const noexcept { return {segments.data(), depth}; }
+
+		operator varname() const {
+			varname result{};
+			result.path.reserve(depth);
+			for (auto const segment : path()) {
+				result.path.emplace_back(segment);
+			}
+			return result;
+		}  // GCOV_EXCL_LINE[GCC]
+
 		constexpr auto operator<=>(compiletime_varname const&) const noexcept = default;
 	};
 
-	inline consteval compiletime_varname operator""_var(char const* data, size_t size) { return {.name{data, size}}; }
+	inline consteval compiletime_varname operator""_var(char const* data, size_t size) {
+		return compiletime_varname::from({data, size});
+	}
 
 	namespace var {
 #define VAR_CONST static constexpr auto
 #define VAR(N) VAR_CONST N = #N##_var
 #define MEMBER_VAR(N, M) VAR_CONST M = #N "." #M##_var
-#define VAR_BEGIN(N)                               \
-	struct N##_t {                                 \
-	private:                                       \
-		VAR_CONST name_{#N##_var};                 \
-                                                   \
-	public:                                        \
-		operator varname() const { return name_; } \
-		constexpr operator compiletime_varname() const noexcept { return name_; }
+#define VAR_BEGIN(N)                     \
+	struct N##_t : compiletime_varname { \
+		constexpr N##_t() noexcept       \
+		    : compiletime_varname{#N##_var} {}
 #define VAR_END(N) \
 	}              \
 	;              \
@@ -133,18 +165,13 @@ namespace quick_dra {
 		auto operator()(std::monostate) const { return "<null>"s; }
 		// GCOV_EXCL_STOP
 		auto operator()(std::string const& str) const { return fmt::format("'{}'", str); }
-		auto operator()(currency const& value) const { return fmt::format("{:.2f} zł", value); }
-		auto operator()(percent const& value) const { return fmt::format("{:.2f}%", value); }
-		auto operator()(uint_value const& value) const { return fmt::format("{}", value); }
+		auto operator()(currency const& value) const { return with_suffix(value, " zł"sv); }
+		auto operator()(percent const& value) const { return with_suffix(value, "%"sv); }
+		auto operator()(uint_value const& value) const { return chars::to_string(value); }
 		auto operator()(addition const& sum) const { return fmt::format("({})", fmt::join(sum.refs, " + ")); }
 		auto operator()(varname const& var) const { return fmt::format("${}", fmt::join(var.path, ".")); }
-		auto operator()(year_month const& var) const {
-			return fmt::format("{:04}/{:02}", static_cast<int>(var.year()), static_cast<unsigned>(var.month()));
-		}
-		auto operator()(year_month_day const& var) const {
-			return fmt::format("{:04}/{:02}/{:02}", static_cast<int>(var.year()), static_cast<unsigned>(var.month()),
-			                   static_cast<unsigned>(var.day()));
-		}
+		auto operator()(year_month const& var) const { return chars::to_string(var, '/'); }
+		auto operator()(year_month_day const& var) const { return chars::to_string(var, '/'); }
 		auto operator()(ValueType const& value) const { return std::visit(*this, value); }
 		auto operator()(std::vector<ValueType> const& values) const {
 			std::string result{"["};
@@ -161,25 +188,13 @@ namespace quick_dra {
 		}  // GCOV_EXCL_LINE[GCC]
 
 		auto operator()(maybe_list<ValueType> const& value) const { return std::visit(*this, value); }
-	};
-
-	template <typename ValueType>
-	struct value_printer {
-		using sink_type = std::function<void(std::string_view)>;
-
-		explicit value_printer(sink_type sink = {}) : sink_{std::move(sink)} {
-			if (!sink_) {
-				sink_ = [](auto const& text) { fmt::print("{}", text); };
-			}
-		}
-
-		explicit value_printer(FILE* file)
-		    : value_printer{[file](auto const& text) { fmt::print(file, "{}", text); }} {}
-
-		void operator()(auto const& arg) const { sink_(value_formatter<ValueType>{}(arg)); }
 
 	private:
-		sink_type sink_{};
+		template <typename Value>
+		static std::string with_suffix(Value const& value, std::string_view suffix) {
+			chars::buffer buffer{};
+			return {buffer.data(), chars::write(chars::write(buffer.data(), value), suffix)};
+		}
 	};
 
 	template <typename ValueType>
@@ -188,14 +203,16 @@ namespace quick_dra {
 		mapped_value<ValueType> fields{};
 
 		constexpr auto operator<=>(block const&) const noexcept = default;
-		void debug_print(int indent, bool standalone = true) const noexcept {
+		void debug_print(std::string_view section, int indent, bool standalone = true) const noexcept {
+			if (!diag::enabled(diag::level::debug)) return;
+
 			bool first = standalone;
 			if (!id.empty()) {
-				fmt::print("-- {:{}}{} id: {}\n", "", indent, first ? '-' : ' ', id);
+				diag::debug({.section = section}, "-- {:{}}{} id: {}", "", indent, first ? '-' : ' ', id);
 				first = false;
 			}
 
-			fmt::print("-- {:{}}{} fields:\n", "", indent, first ? '-' : ' ');
+			diag::debug({.section = section}, "-- {:{}}{} fields:", "", indent, first ? '-' : ' ');
 
 			unsigned max_id = 0;
 			for (auto const& [index, _] : fields) {
@@ -204,15 +221,16 @@ namespace quick_dra {
 
 			auto const width = max_id ? static_cast<unsigned>(std::log10(max_id) + 1.0) : 1u;
 
-			static const auto printer = value_printer<ValueType>{};
+			value_formatter<ValueType> const formatter{};
 
 			for (auto const& [index, field] : fields) {
-				fmt::print("-- {:{}}    {:{}}: ", "", indent, index, width);
-				std::visit(printer, field);
-				fmt::print("\n");
+				chars::buffer text{};
+				auto const field_id = std::string_view{text.data(), chars::write_unsigned(text.data(), index)};
+				diag::debug({.section = section, .field = field_id}, "-- {:{}}    {:{}}: {}", "", indent, index, width,
+				            std::visit(formatter, field));
 			}
 
-			fmt::print("--\n");
+			diag::debug({.section = section}, "--");
 		}
 	};
 
@@ -220,21 +238,17 @@ namespace quick_dra {
 	struct section {
 		std::string id{};
 		bool repeatable{false};
-		std::vector<block<ValueType>> blocks{};
+		std::pmr::vector<block<ValueType>> blocks{};
 
 		constexpr auto operator<=>(section const&) const noexcept = default;
 		void debug_print() const noexcept {
-			fmt::print("--     {}", id);
-			if (repeatable) {
-				fmt::print("[*]");
-			}
-			fmt::print(":\n");
+			diag::debug({.section = id}, "--     {}{}:", id, repeatable ? "[*]"sv : ""sv);
 
 			if (blocks.size() == 1) {
-				blocks.front().debug_print(2 * kIndent, false);
+				blocks.front().debug_print(id, 2 * kIndent, false);
 			} else {
 				for (auto const& block : blocks) {
-					block.debug_print(3 * kIndent);
+					block.debug_print(id, 3 * kIndent);
 				}
 			}
 		}
@@ -247,7 +261,7 @@ namespace quick_dra {
 		}
 
 		if (report.empty()) {
-			fmt::print("\n");  // GCOV_EXCL_LINE
+			diag::debug("");  // GCOV_EXCL_LINE
 		}  // GCOV_EXCL_LINE[CLANG]
 	}
 
@@ -257,11 +271,19 @@ namespace quick_dra {
 	using calculated_section = section<calculated_value>;
 	using compiled_section = section<compiled_value>;
 
-	calculated_block calculate(compiled_block const& self, struct global_object const& ctx, std::string_view log_name);
+	// the blocks and the fields of the result are allocated from the resource
+	calculated_block calculate(compiled_block const& self,
+	                           struct global_object const& ctx,
+	                           std::string_view log_name,
+	                           std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
-	calculated_section calculate(compiled_section const& self, global_object const& ctx);
+	calculated_section calculate(compiled_section const& self,
+	                             global_object const& ctx,
+	                             std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
-	std::vector<calculated_section> calculate(std::vector<compiled_section> const& report, global_object const& ctx);
+	std::vector<calculated_section> calculate(std::vector<compiled_section> const& report,
+	                                          global_object const& ctx,
+	                                          std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 	namespace v1 {
 		struct templates;
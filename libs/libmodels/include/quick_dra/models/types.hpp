@@ -6,8 +6,11 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <chrono>
+#include <functional>
 #include <map>
+#include <memory_resource>
 #include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/meta.hpp>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/base/types.hpp>
@@ -17,8 +20,10 @@
 #include <quick_dra/models/yaml/tax_config.hpp>
 #include <quick_dra/models/yaml/user_config.hpp>
 #include <quick_dra/models/yaml/user_config_partial.hpp>
+#include <span>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -46,77 +51,68 @@ namespace quick_dra {
 		static type conv_ret(char const* default_value) noexcept { return default_value; }
 	};
 
+	// The whole tree, keys included, lives in the memory resource of the
+	// root; a form set built in an arena is released together with it.
 	struct global_object {
-		std::optional<maybe_list<calculated_value>> value{};
-
-		std::map<std::string, global_object> children{};
+		using allocator_type = std::pmr::polymorphic_allocator<>;
 
-		void insert(varname const& var, maybe_list<calculated_value>&& data) { get(var).value = std::move(data); }
+		std::optional<maybe_list<calculated_value>> value{};
 
-		void insert(varname const& var, contribution const& data) { get(var) = data; }
+		std::pmr::map<std::pmr::string, global_object, std::less<>> children{};
 
-		global_object& get(varname const& var) {
-			auto ptr = this;
+		global_object() = default;
+		explicit global_object(allocator_type const& alloc) : children{alloc} {}
+		global_object(global_object const&) = default;
+		global_object(global_object&&) noexcept = default;
+		global_object(global_object const& other, allocator_type const& alloc)
+		    : value{other.value}, children{other.children, alloc} {}
+		global_object(global_object&& other, allocator_type const& alloc)
+		    : value{std::move(other.value)}, children{std::move(other.children), alloc} {}
+		global_object& operator=(global_object const&) = default;
+		// not noexcept: with different allocators, the elements are moved one by one
+		global_object& operator=(global_object&&) = default;
 
-			for (auto const& path : var.path) {
-				auto it = ptr->children.lower_bound(path);
-				if (it == ptr->children.end() || it->first != path) {
-					it = ptr->children.emplace_hint(it, path, global_object{});
-				}
-				ptr = &it->second;
-			}
+		allocator_type get_allocator() const noexcept { return children.get_allocator(); }
 
-			return *ptr;
+		void insert(varname const& var, maybe_list<calculated_value>&& data) { get(var).value = std::move(data); }
+		void insert(compiletime_varname const& var, maybe_list<calculated_value>&& data) {
+			get(var).value = std::move(data);
 		}
 
-		global_object const* peek(varname const& var) const {
-			auto ptr = this;
+		void insert(varname const& var, contribution const& data) { get(var) = data; }
+		void insert(compiletime_varname const& var, contribution const& data) { get(var) = data; }
 
-			for (auto const& path : var.path) {
-				auto it = ptr->children.find(path);
-				if (it == ptr->children.end()) {
-					return nullptr;
-				}
-				ptr = &it->second;
-			}
+		global_object& get(varname const& var) { return get_path(var.path); }
+		global_object& get(compiletime_varname const& var) { return get_path(var.path()); }
 
-			return ptr;
-		}
+		global_object const* peek(varname const& var) const { return peek_path(var.path); }
+		global_object const* peek(compiletime_varname const& var) const { return peek_path(var.path()); }
 
 		maybe_list<calculated_value> value_or(varname const& var,
 		                                      maybe_list<calculated_value> const& default_value) const noexcept {
-			auto ptr = this;
-
-			for (auto const& path : var.path) {
-				auto it = ptr->children.find(path);
-				if (it == ptr->children.end()) {
-					return default_value;
-				}
-				ptr = &it->second;
-			}
-
-			return ptr->value.value_or(default_value);
+			return value_or_path(var.path, default_value);
+		}
+		maybe_list<calculated_value> value_or(compiletime_varname const& var,
+		                                      maybe_list<calculated_value> const& default_value) const noexcept {
+			return value_or_path(var.path(), default_value);
 		}
 
 		template <typename T>
 		typename stored_type<T>::type typed_value(varname const& var, T const& default_value = {}) const noexcept {
-			auto const val = value_or(var, {});
-
-			if (!std::holds_alternative<calculated_value>(val)) {
-				return stored_type<T>::conv_ret(default_value);
-			}
-
-			auto result = std::get_if<typename stored_type<T>::type>(&std::get<calculated_value>(val));
-			if (!result) {
-				return stored_type<T>::conv_ret(default_value);
-			}
-
-			return *result;
+			return typed_value_path(var.path, default_value);
+		}
+		template <typename T>
+		typename stored_type<T>::type typed_value(compiletime_varname const& var,
+		                                          T const& default_value = {}) const noexcept {
+			return typed_value_path(var.path(), default_value);
 		}
 
 		std::vector<calculated_value> typed_value(
 		    varname const& var,
 		    std::vector<calculated_value> const& default_value = {}) const noexcept = delete;
+		std::vector<calculated_value> typed_value(
+		    compiletime_varname const& var,
+		    std::vector<calculated_value> const& default_value = {}) const noexcept = delete;
 
 		global_object& operator=(maybe_list<calculated_value>&& data) noexcept {
 			value = std::move(data);
@@ -129,19 +125,79 @@ namespace quick_dra {
 			return *this;
 		}
 
-		void debug_print(size_t indent) const {
+		// the heading starts the first line, the value completes it
+		void debug_print(size_t indent, std::string_view heading, std::string_view field = {}) const {
+			if (!diag::enabled(diag::level::debug)) return;
+
 			if (value) {
-				fmt::print(" ");
-				std::visit(value_printer<calculated_value>{}, *value);
+				diag::debug({.field = field}, "{} {}", heading, value_formatter<calculated_value>{}(*value));
 			} else if (children.empty()) {
-				fmt::print(" <null>");  // GCOV_EXCL_LINE
-			}  // GCOV_EXCL_LINE[CLANG]
-			fmt::print("\n");
+				diag::debug({.field = field}, "{} <null>", heading);  // GCOV_EXCL_LINE
+			} else {
+				diag::debug({.field = field}, "{}", heading);
+			}
 
 			for (auto const& [key, child] : children) {
-				fmt::print("-- {:{}} {}:", "", indent * kIndent, key);
-				child.debug_print(indent + 1);
+				child.debug_print(indent + 1, fmt::format("-- {:{}} {}:", "", indent * kIndent, key), key);
+			}
+		}
+
+	private:
+		// both std::vector<std::string> and std::span<std::string_view const>
+		template <typename Path>
+		global_object& get_path(Path const& path) {
+			auto ptr = this;
+
+			for (auto const& segment : path) {
+				auto const name = std::string_view{segment};
+				auto it = ptr->children.lower_bound(name);
+				if (it == ptr->children.end() || it->first != name) {
+					// both the key and the child get the allocator of the map
+					it = ptr->children.emplace_hint(it, std::piecewise_construct, std::forward_as_tuple(name),
+					                                std::forward_as_tuple());
+				}
+				ptr = &it->second;
 			}
+
+			return *ptr;
+		}
+
+		template <typename Path>
+		global_object const* peek_path(Path const& path) const {
+			auto ptr = this;
+
+			for (auto const& segment : path) {
+				auto it = ptr->children.find(std::string_view{segment});
+				if (it == ptr->children.end()) {
+					return nullptr;
+				}
+				ptr = &it->second;
+			}
+
+			return ptr;
+		}
+
+		template <typename Path>
+		maybe_list<calculated_value> value_or_path(Path const& path,
+		                                           maybe_list<calculated_value> const& default_value) const noexcept {
+			auto const ptr = peek_path(path);
+			if (!ptr) return default_value;
+			return ptr->value.value_or(default_value);
+		}
+
+		template <typename Path, typename T>
+		typename stored_type<T>::type typed_value_path(Path const& path, T const& default_value) const noexcept {
+			auto const ptr = peek_path(path);
+			if (!ptr || !ptr->value || !std::holds_alternative<calculated_value>(*ptr->value)) {
+				return stored_type<T>::conv_ret(default_value);
+			}
+
+			auto result = std::get_if<typename stored_type<T>::type>(&std::get<calculated_value>(*ptr->value));
+			if (!result) {
+				return stored_type<T>::conv_ret(default_value);
+			}
+
+			return *result;
 		}
 	};
 }  // namespace quick_dra
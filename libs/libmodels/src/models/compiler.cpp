@@ -4,7 +4,10 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <quick_dra/base/alloc_stats.hpp>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/str.hpp>
+#include <quick_dra/base/trace.hpp>
 #include <quick_dra/models/types.hpp>
 #include <set>
 #include <string>
@@ -45,7 +48,7 @@ namespace quick_dra {
 				auto const end = begin + trimmed.size();
 				auto const [ptr, ec] = std::from_chars(begin, end, ref);
 				if (ptr != end || ec != std::errc{}) {
-					fmt::print(stderr, "error while parsing `{}'\n", input);
+					diag::error("error while parsing `{}'", input);
 					return fmt::format("unparsable: {}", input);
 				}
 
@@ -58,7 +61,7 @@ namespace quick_dra {
 			auto const view = strip_sv(input.substr(0, input.size() - "zł"sv.size()));
 			currency value{};
 			if (!currency::parse(view, value)) {
-				fmt::print(stderr, "error while parsing `{}'\n", input);
+				diag::error("error while parsing `{}'", input);
 				return fmt::format("unparsable: {}", input);
 			}
 
@@ -149,9 +152,10 @@ namespace quick_dra {
 
 			static mapped_value<calculated_value> calculate(std::string_view id,
 			                                                mapped_value<compiled_value> const& fields,
-			                                                global_object const& ctx) {
+			                                                global_object const& ctx,
+			                                                std::pmr::memory_resource* resource) {
 				data_calculator src{id, ctx, fields};
-				return src.calculate();
+				return src.calculate(resource);
 			}
 
 		private:
@@ -186,24 +190,29 @@ namespace quick_dra {
 				return std::visit(value_extractor<From, To>{}, val);
 			}
 
-			inline std::string label(unsigned key, size_t index = invalid_index) {
-				return fmt::format(fmt::runtime(index == invalid_index ? "{} p{}" : "{} p{}.{}"), id, key, index);
+			static std::string field_name(unsigned key, size_t index = invalid_index) {
+				return fmt::format(fmt::runtime(index == invalid_index ? "p{}" : "p{}.{}"), key, index);
 			}  // GCOV_EXCL_LINE[WIN32]
 
+			// "<section> p<key>: error: <message>"
+			template <typename... Args>
+			void error(unsigned key, size_t index, fmt::format_string<Args...> fmt, Args&&... args) const {
+				auto const field = field_name(key, index);
+				diag::error({.section = id, .field = field}, "{} {}: error: {}", id, field,
+				            fmt::format(fmt, std::forward<Args>(args)...));
+			}
+
 			void fill_var(unsigned key, size_t index, compiled_value& tgt, varname const& var) {
 				auto const ptr = ctx.peek(var);
 				if (!ptr) {
-					fmt::print(stderr, "{}: error: cannot find `${}'\n", label(key, index), join(var.path, '.'_sep));
+					error(key, index, "cannot find `${}'", join(var.path, '.'_sep));
 					return;
 				}
 
 				auto const& data = *ptr;
 
 				if (!data.value) {
-					fmt::print(stderr,
-					           "{}: error: reference `${}' contains no "
-					           "value\n",
-					           label(key, index), join(var.path, '.'_sep));
+					error(key, index, "reference `${}' contains no value", join(var.path, '.'_sep));
 					return;
 				}
 
@@ -220,10 +229,7 @@ namespace quick_dra {
 					return;
 				}
 
-				fmt::print(stderr,
-				           "{}: error: cannot assign a list to a "
-				           "list item when checking `${}'\n",
-				           label(key, index), join(var.path, '.'_sep));
+				error(key, index, "cannot assign a list to a list item when checking `${}'", join(var.path, '.'_sep));
 			}
 
 			void precalc(unsigned key, size_t index, compiled_value& tgt) {
@@ -236,10 +242,7 @@ namespace quick_dra {
 					auto const& refs = std::get<addition>(tgt).refs;
 
 					if (index != invalid_index) {
-						fmt::print(stderr,
-						           "{}: error: field addition inside a "
-						           "sub-field ({})\n",
-						           label(key, index), fmt::join(refs, " + "));
+						error(key, index, "field addition inside a sub-field ({})", fmt::join(refs, " + "));
 						return;
 					}
 
@@ -281,19 +284,19 @@ namespace quick_dra {
 				for (auto ref : refs) {
 					auto it = fields.find(ref);
 					if (it == fields.end()) {
-						fmt::print(stderr, "{}: error: cannot find p{}\n", label(key), ref);
+						error(key, invalid_index, "cannot find p{}", ref);
 						return;
 					}
 
 					auto src = std::get_if<compiled_value>(&it->second);
 					if (!src) {
-						fmt::print(stderr, "{}: error: p{} is not a scalar\n", label(key), ref);
+						error(key, invalid_index, "p{} is not a scalar", ref);
 						return;
 					}
 
 					auto val = std::get_if<currency>(src);
 					if (!val) {
-						fmt::print(stderr, "{}: error: p{} is not a number\n", label(key), ref);
+						error(key, invalid_index, "p{} is not a number", ref);
 						return;
 					}
 
@@ -313,7 +316,7 @@ namespace quick_dra {
 				}
 			}
 
-			mapped_value<calculated_value> calculate() {
+			mapped_value<calculated_value> calculate(std::pmr::memory_resource* resource) {
 				for (auto& [key, field] : fields) {
 					if (std::holds_alternative<compiled_value>(field)) {
 						precalc(key, invalid_index, std::get<compiled_value>(field));
@@ -328,16 +331,19 @@ namespace quick_dra {
 
 				remove_crossrefs();
 
-				mapped_value<calculated_value> result{};
+				mapped_value<calculated_value> result{resource};
 				for (auto const& [key, field] : fields) {
-					result[key] = extract<calculated_value>(field);
+					result.emplace_hint(result.end(), key, extract<calculated_value>(field));
 				}
 				return result;
 			}  // GCOV_EXCL_LINE[GCC]
 		};
 	}  // namespace
 
-	calculated_block calculate(compiled_block const& self, global_object const& ctx, std::string_view log_name) {
+	calculated_block calculate(compiled_block const& self,
+	                           global_object const& ctx,
+	                           std::string_view log_name,
+	                           std::pmr::memory_resource* resource) {
 		std::string extended_name;
 		if (!self.id.empty()) {
 			extended_name = fmt::format("{}.{}", log_name, self.id);
@@ -346,28 +352,38 @@ namespace quick_dra {
 		// GCOV_EXCL_START[GCC]
 		return calculated_block{// GCOV_EXCL_STOP
 		                        .id = self.id,
-		                        .fields = data_calculator::calculate(log_name, self.fields, ctx)};
+		                        .fields = data_calculator::calculate(log_name, self.fields, ctx, resource)};
 	}
 
-	calculated_section calculate(compiled_section const& self, global_object const& ctx) {
-		calculated_section result{.id = self.id, .repeatable = self.repeatable};
+	calculated_section calculate(compiled_section const& self,
+	                             global_object const& ctx,
+	                             std::pmr::memory_resource* resource) {
+		calculated_section result{
+		    .id = self.id,
+		    .repeatable = self.repeatable,
+		    .blocks = std::pmr::vector<calculated_block>{resource},
+		};
 		result.blocks.reserve(self.blocks.size());
 		for (auto const& block : self.blocks) {
-			result.blocks.emplace_back(calculate(block, ctx, self.id));
+			result.blocks.emplace_back(calculate(block, ctx, self.id, resource));
 		}
 		return result;
 	}  // GCOV_EXCL_LINE[GCC]
 
-	std::vector<calculated_section> calculate(std::vector<compiled_section> const& report, global_object const& ctx) {
+	std::vector<calculated_section> calculate(std::vector<compiled_section> const& report,
+	                                          global_object const& ctx,
+	                                          std::pmr::memory_resource* resource) {
 		std::vector<calculated_section> result{};
 		result.reserve(report.size());
 		for (auto const& section : report) {
-			result.emplace_back(calculate(section, ctx));
+			result.emplace_back(calculate(section, ctx, resource));
 		}
 		return result;
 	}  // GCOV_EXCL_LINE[GCC]
 
 	compiled_templates compiled_templates::compile(templates const& input) {
+		trace::span span{"compile_templates"sv};
+		alloc::scope accounting{alloc::phase::config};
 		compiled_templates result{};
 		for (auto const& [key, report] : input.reports) {
 			result.reports[key] = compile_report(report);
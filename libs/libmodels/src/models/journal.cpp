@@ -0,0 +1,257 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <quick_dra/models/journal.hpp>
+#include <quick_dra/models/project_reader.hpp>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace quick_dra {
+	using yaml::enum_tag;
+
+	auto const& enums(journal_op) noexcept {
+		static constexpr auto names = std::array{
+		    enum_tag{.id = "start"sv, .value = journal_op::start},
+		    enum_tag{.id = "insured add"sv, .value = journal_op::insured_add},
+		    enum_tag{.id = "insured edit"sv, .value = journal_op::insured_edit},
+		    enum_tag{.id = "insured remove"sv, .value = journal_op::insured_remove},
+		    enum_tag{.id = "payer"sv, .value = journal_op::payer},
+		    enum_tag{.id = "accident"sv, .value = journal_op::accident_insurance},
+		};
+		return names;
+	}
+
+	namespace {
+		std::string name_of(journal_op op) {
+			for (auto const& [id, value] : enums(op)) {
+				if (value == op) return {id.data(), id.size()};
+			}
+			return {};  // GCOV_EXCL_LINE
+		}
+
+		ryml::Tree entries_tree(std::span<journal_entry const> entries) {
+			ryml::Tree tree{};
+			auto root = tree.rootref();
+			root |= c4::yml::SEQ;
+			for (auto const& entry : entries) {
+				auto copy = entry;
+				copy.prepare_for_write();
+				auto child = root.append_child();
+				yaml::write_value(child, copy);
+			}
+			return tree;
+		}
+
+		bool start_journal(std::filesystem::path const& config_path, unsigned compact_every) {
+			auto const header = journal_entry{
+			    .op = journal_op::start,
+			    .every = compact_every,
+			    .base = file_stamp(config_path),
+			};
+			return yaml::store_root(config_journal::path_for(config_path), syntax_type::yaml,
+			                        entries_tree({&header, 1}));
+		}
+	}  // namespace
+
+	std::string file_stamp(std::filesystem::path const& path) {
+		std::error_code ec{};
+		auto const size = std::filesystem::file_size(path, ec);
+		if (ec) return {};
+		auto const mtime = std::filesystem::last_write_time(path, ec);
+		if (ec) return {};  // GCOV_EXCL_LINE
+		return fmt::format("{}:{}", size, mtime.time_since_epoch().count());
+	}
+
+	journal_entry journal_entry::insured_added(partial::insured_t const& insured) {
+		return {.op = journal_op::insured_add, .insured = insured};
+	}
+
+	journal_entry journal_entry::insured_edited(unsigned pos, partial::insured_t const& insured) {
+		return {.op = journal_op::insured_edit, .pos = pos, .insured = insured};
+	}
+
+	journal_entry journal_entry::insured_removed(unsigned pos) {
+		return {.op = journal_op::insured_remove, .pos = pos};
+	}
+
+	journal_entry journal_entry::payer_changed(partial::payer_t const& payer) {
+		return {.op = journal_op::payer, .payer = payer};
+	}
+
+	journal_entry journal_entry::accident_insurance_changed(std::map<year_month, percent> const& accident_insurance) {
+		return {.op = journal_op::accident_insurance, .accident_insurance = accident_insurance};
+	}
+
+	bool journal_entry::apply_to(partial::config& cfg) const {
+		switch (op) {
+			case journal_op::start:
+				return true;
+
+			case journal_op::insured_add:
+				if (!insured) return false;
+				if (!cfg.insured) cfg.insured.emplace();
+				cfg.insured->push_back(*insured);
+				return true;
+
+			case journal_op::insured_edit:
+				if (!insured || !pos || !cfg.insured || *pos >= cfg.insured->size()) return false;
+				(*cfg.insured)[*pos] = *insured;
+				return true;
+
+			case journal_op::insured_remove:
+				if (!pos || !cfg.insured || *pos >= cfg.insured->size()) return false;
+				cfg.insured->erase(std::next(cfg.insured->begin(), *pos));
+				return true;
+
+			case journal_op::payer:
+				if (!payer) return false;
+				cfg.payer = *payer;
+				return true;
+
+			case journal_op::accident_insurance:
+				if (!accident_insurance) return false;
+				cfg.accident_insurance = *accident_insurance;
+				return true;
+		}
+
+		return false;  // GCOV_EXCL_LINE
+	}
+
+	bool journal_entry::read(yaml::ref_ctx const& ref) {
+		using yaml::read_key;
+
+		if (!read_key(ref, "op", op)) return ref.error("while reading `op`");
+		if (!read_key(ref, "pos", pos)) return ref.error("while reading `pos`");
+		if (!read_key(ref, "every", every)) return ref.error("while reading `every`");
+		if (!read_key(ref, "base", base)) return ref.error("while reading `base`");
+		if (!read_key(ref, "payer", payer)) return ref.error("while reading `payer`");
+		if (!read_key(ref, "insured", insured)) return ref.error("while reading `insured`");
+		if (!read_key(ref, "accident", accident_insurance)) return ref.error("while reading `accident`");
+
+		return true;
+	}
+
+	void journal_entry::prepare_for_write() {
+		yaml::prepare_child(payer);
+		yaml::prepare_child(insured);
+	}
+
+	void journal_entry::write(ryml::NodeRef& ref) const {
+		using yaml::write_key;
+
+		write_key(ref, "op", name_of(op));
+		write_key(ref, "pos", pos);
+		write_key(ref, "every", every);
+		write_key(ref, "base", base);
+		write_key(ref, "payer", payer);
+		write_key(ref, "insured", insured);
+		write_key(ref, "accident", accident_insurance);
+	}
+
+	load_status config_journal::load(std::filesystem::path const& config_path) {
+		auto const path = path_for(config_path);
+
+		std::error_code ec{};
+		if (!std::filesystem::exists(path, ec) || ec) {
+			return load_status::file_not_found;
+		}
+
+		auto result = load_status::errors_encountered;
+		auto object = yaml::parser::parse_yaml_file<std::vector<journal_entry>>(
+		    path, [&]() { result = load_status::file_not_readable; });
+		if (!object) {
+			return result;
+		}
+
+		if (object->empty() || object->front().op != journal_op::start) {
+			return load_status::errors_encountered;
+		}
+
+		auto const& header = object->front();
+		compact_every = header.every.value_or(kDefaultCompactEvery);
+		base = header.base.value_or(""s);
+		entries.assign(std::make_move_iterator(std::next(object->begin())), std::make_move_iterator(object->end()));
+		return load_status::loaded;
+	}
+
+	bool config_journal::is_stale(std::filesystem::path const& config_path) const {
+		return base != file_stamp(config_path);
+	}
+
+	bool config_journal::replay(partial::config& cfg) const {
+		for (auto const& entry : entries) {
+			if (!entry.apply_to(cfg)) return false;
+		}
+		return true;
+	}
+
+	std::filesystem::path config_journal::path_for(std::filesystem::path const& config_path) {
+		auto result = config_path;
+		result += ".journal"sv;
+		return result;
+	}
+
+	bool config_journal::enable(std::filesystem::path const& config_path, unsigned compact_every) {
+		if (!compact(config_path)) return false;
+		return start_journal(config_path, std::max(1u, compact_every));
+	}
+
+	bool config_journal::disable(std::filesystem::path const& config_path) {
+		if (!compact(config_path)) return false;
+
+		std::error_code ec{};
+		std::filesystem::remove(path_for(config_path), ec);
+		return !ec;
+	}
+
+	bool config_journal::reset(std::filesystem::path const& config_path) {
+		config_journal journal{};
+		auto const status = journal.load(config_path);
+		if (status == load_status::file_not_found) return true;
+
+		return start_journal(config_path, journal.compact_every);
+	}
+
+	bool config_journal::append(std::filesystem::path const& config_path, journal_entry const& change) {
+		std::ofstream out{path_for(config_path), std::ios::out | std::ios::binary | std::ios::app};
+		if (!out) {
+			return false;
+		}
+
+		yaml::emit_root(syntax_type::yaml, entries_tree({&change, 1}), out);
+		out.flush();
+		return !!out;
+	}
+
+	bool config_journal::compact(std::filesystem::path const& config_path) {
+		config_journal journal{};
+		auto const status = journal.load(config_path);
+		if (status == load_status::file_not_found) return true;
+		if (status != load_status::loaded) return false;
+		if (journal.entries.empty()) return true;
+
+		partial::config cfg{};
+		auto const cfg_status = cfg.load(config_path);
+		if (cfg_status != load_status::loaded) return false;
+
+		return cfg.store(config_path);
+	}
+
+	bool commit(partial::config& cfg, std::filesystem::path const& path, journal_entry const& change) {
+		config_journal journal{};
+		if (cfg.version == kApiVersion && journal.load(path) == load_status::loaded && !journal.is_stale(path) &&
+		    journal.entries.size() + 1 < journal.compact_every) {
+			return config_journal::append(path, change);
+		}
+
+		return cfg.store(path);
+	}
+}  // namespace quick_dra
@@ -3,9 +3,11 @@
 
 #include <fmt/ranges.h>
 #include <algorithm>
+#include <quick_dra/base/diag.hpp>
 #include <quick_dra/base/str.hpp>
 #include <quick_dra/models/types.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace quick_dra {
@@ -30,29 +32,29 @@ namespace quick_dra {
 
 		template <typename Insured>
 		void names_only(payer_t const& payer, std::vector<Insured> const& insured) {
-			fmt::print("-- payer: {} {}\n", payer.first_name, payer.last_name);
-			fmt::print("-- insured:\n");
+			diag::debug("-- payer: {} {}", payer.first_name, payer.last_name);
+			diag::debug("-- insured:");
 			for (auto const& obj : insured) {
-				fmt::print("--   - {} {}\n", obj.first_name, obj.last_name);
+				diag::debug("--   - {} {}", obj.first_name, obj.last_name);
 			}
 		}
 
 		void names_summary_and_beyond(payer_t const& payer, verbose level) {
 			if (level == verbose::names_and_summary) {
-				fmt::print("-- payer: {} {} ({})\n", payer.first_name, payer.last_name, payer.tax_id);
+				diag::debug("-- payer: {} {} ({})", payer.first_name, payer.last_name, payer.tax_id);
 				return;
 			}  // GCOV_EXCL_LINE[WIN32]
 
-			fmt::print("-- payer:\n");
-			fmt::print("--   name: {} {}\n", payer.first_name, payer.last_name);
-			fmt::print("--   social id: {}\n", payer.social_id);
-			fmt::print("--   tax id: {}\n", payer.tax_id);
-			fmt::print("--   ident: {} {}\n", payer.kind, payer.document);
+			diag::debug("-- payer:");
+			diag::debug("--   name: {} {}", payer.first_name, payer.last_name);
+			diag::debug("--   social id: {}", payer.social_id);
+			diag::debug("--   tax id: {}", payer.tax_id);
+			diag::debug("--   ident: {} {}", payer.kind, payer.document);
 		}
 
 		void names_summary_and_beyond(std::vector<v2::insured_t> const& insured, verbose level) {
 			if (level == verbose::names_and_summary) {
-				fmt::print("-- insured:\n");
+				diag::debug("-- insured:");
 				for (auto const& obj : insured) {
 					std::vector<std::string> history{};
 					history.reserve(obj.history.size());
@@ -68,13 +70,13 @@ namespace quick_dra {
 							history.push_back(fmt::format("{} of {} [{}]", scale_str, salary_str, fmt_date_slash(key)));
 						}
 					}
-					fmt::print("--   - {} {} ({}), {}\n", obj.first_name, obj.last_name, obj.document,
-					           fmt::join(history, "; "));
+					diag::debug("--   - {} {} ({}), {}", obj.first_name, obj.last_name, obj.document,
+					            fmt::join(history, "; "));
 				}
 				return;
 			}  // GCOV_EXCL_LINE[WIN32]
 
-			fmt::print("-- insured:\n");
+			diag::debug("-- insured:");
 			for (auto const& obj : insured) {
 				std::vector<std::string> history{};
 				history.reserve(obj.history.size());
@@ -91,25 +93,31 @@ namespace quick_dra {
 					}
 				}
 
-				fmt::print("--   - name: {} {}\n", obj.first_name, obj.last_name);
-				fmt::print("--     insurance title: {}\n", fmt::join(obj.title.split(), " "));
-				fmt::print("--     ident: {} {}\n", obj.kind, obj.document);
-				fmt::print("--     salary: {}\n", fmt::join(history, "\n               "));
+				diag::debug("--   - name: {} {}", obj.first_name, obj.last_name);
+				diag::debug("--     insurance title: {}", fmt::join(obj.title.split(), " "));
+				diag::debug("--     ident: {} {}", obj.kind, obj.document);
+				// one record per entry, so each of them is a JSON line of its own
+				if (history.empty()) history.emplace_back();
+				std::string_view lead = "--     salary:";
+				for (auto const& entry : history) {
+					diag::debug("{} {}", lead, entry);
+					lead = "              ";
+				}
 			}
 		}
 
 		void parameters(tax_parameters const& params) {
-			fmt::print("-- parameters\n");
-			fmt::print("--   cost of obtaining: {} zł / {} zł\n",  // GCOV_EXCL_LINE
-			           params.costs_of_obtaining.local, params.costs_of_obtaining.remote);
-			fmt::print("--   health: {}\n", from_rate(params.contributions.health));
-			fmt::print("--   pension insurance: {}\n", from_rate(params.contributions.pension_insurance));
-			fmt::print("--   disability insurance: {}\n", from_rate(params.contributions.disability_insurance));
-			fmt::print("--   health insurance: {}\n", from_rate(params.contributions.health_insurance));
-			fmt::print("--   accident insurance: {}\n", from_rate(params.contributions.accident_insurance));
-			fmt::print("--   tax scale for month reported:\n");
+			diag::debug("-- parameters");
+			diag::debug("--   cost of obtaining: {} zł / {} zł",  // GCOV_EXCL_LINE
+			            params.costs_of_obtaining.local, params.costs_of_obtaining.remote);
+			diag::debug("--   health: {}", from_rate(params.contributions.health));
+			diag::debug("--   pension insurance: {}", from_rate(params.contributions.pension_insurance));
+			diag::debug("--   disability insurance: {}", from_rate(params.contributions.disability_insurance));
+			diag::debug("--   health insurance: {}", from_rate(params.contributions.health_insurance));
+			diag::debug("--   accident insurance: {}", from_rate(params.contributions.accident_insurance));
+			diag::debug("--   tax scale for month reported:");
 			for (auto const& [amount, tax] : params.scale)
-				fmt::print("--     over {} zł at {}%\n", amount, tax);
+				diag::debug("--     over {} zł at {}%", amount, tax);
 		}
 	}  // namespace
 }  // namespace quick_dra
@@ -120,34 +128,34 @@ namespace quick_dra::v1 {
 			return;
 		}
 
-		fmt::print("-- costs of obtaining per month:\n");
+		diag::debug("-- costs of obtaining per month:");
 		for (auto const& [date, coo] : costs_of_obtaining) {
-			fmt::print("--   {}-{:02}: {} zł / {} zł\n", static_cast<int>(date.year()),
-			           static_cast<unsigned>(date.month()), coo.local, coo.remote);
+			diag::debug("--   {}-{:02}: {} zł / {} zł", static_cast<int>(date.year()),
+			            static_cast<unsigned>(date.month()), coo.local, coo.remote);
 		}
 
-		fmt::print("-- minimal pay per month:\n");
+		diag::debug("-- minimal pay per month:");
 		for (auto const& [date, amount] : minimal_pay) {
-			fmt::print("--   {}-{:02}: {} zł\n", static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
-			           amount);
+			diag::debug("--   {}-{:02}: {} zł", static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+			            amount);
 		}
 
-		fmt::print("-- tax scale per month:\n");
+		diag::debug("-- tax scale per month:");
 		for (auto const& [date, levels] : scale) {
-			fmt::print("--   {}-{:02}:\n", static_cast<int>(date.year()), static_cast<unsigned>(date.month()));
+			diag::debug("--   {}-{:02}:", static_cast<int>(date.year()), static_cast<unsigned>(date.month()));
 			for (auto const& [amount, tax] : levels) {
-				fmt::print("--     over {} zł at {}%\n", amount, tax);
+				diag::debug("--     over {} zł at {}%", amount, tax);
 			}
 		}
 
-		fmt::print("-- insurance rates per month:\n");
+		diag::debug("-- insurance rates per month:");
 		for (auto const& [date, rates] : contributions) {
-			fmt::print("--   {}-{:02}:\n", static_cast<int>(date.year()), static_cast<unsigned>(date.month()));
-			fmt::print("--     health: {}\n", from_rate(rates.health));
-			fmt::print("--     pension insurance: {}\n", from_rate(rates.pension_insurance));
-			fmt::print("--     disability insurance: {}\n", from_rate(rates.disability_insurance));
-			fmt::print("--     health insurance: {}\n", from_rate(rates.health_insurance));
-			fmt::print("--     accident insurance: {}\n", from_rate(rates.accident_insurance));
+			diag::debug("--   {}-{:02}:", static_cast<int>(date.year()), static_cast<unsigned>(date.month()));
+			diag::debug("--     health: {}", from_rate(rates.health));
+			diag::debug("--     pension insurance: {}", from_rate(rates.pension_insurance));
+			diag::debug("--     disability insurance: {}", from_rate(rates.disability_insurance));
+			diag::debug("--     health insurance: {}", from_rate(rates.health_insurance));
+			diag::debug("--     accident insurance: {}", from_rate(rates.accident_insurance));
 		}
 	}
 }  // namespace quick_dra::v1
@@ -175,10 +183,11 @@ namespace quick_dra::v2 {
 
 namespace quick_dra {
 	void compiled_templates::debug_print() const noexcept {
-		fmt::print("-- templates:\n");
+		diag::debug("-- templates:");
 
 		for (auto const& [kedu, report] : reports) {
-			fmt::print("--   [{}]:\n", kedu);
+			diag::form_scope context{kedu};
+			diag::debug("--   [{}]:", kedu);
 			quick_dra::debug_print(report);
 		}
 	}
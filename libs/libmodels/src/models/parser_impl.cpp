@@ -5,10 +5,14 @@
 #include <fmt/std.h>
 #include <args/sys.hpp>
 #include <cmath>
-#include <fstream>
+#include <quick_dra/base/alloc_stats.hpp>
 #include <quick_dra/base/chrono.hpp>
+#include <quick_dra/base/startup.hpp>
 #include <quick_dra/base/str.hpp>
+#include <quick_dra/base/trace.hpp>
+#include <quick_dra/models/journal.hpp>
 #include <quick_dra/models/project_reader.hpp>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,6 +90,9 @@ namespace quick_dra::v1 {
 	}
 
 	std::optional<templates> templates::parse_yaml(std::filesystem::path const& path) {
+		startup::scope timing{startup::subsystem::templates};
+		trace::span span{"parse_templates"sv};
+		alloc::scope accounting{alloc::phase::config};
 		return parser::parse_yaml_file<templates>(path, app_name);
 	}
 
@@ -291,14 +298,52 @@ namespace quick_dra::v2 {
 	using v1::parse_and_validate_name;
 
 	std::optional<config> config::parse_yaml(std::filesystem::path const& path) {
+		startup::scope timing{startup::subsystem::config};
+		trace::span span{"parse_yaml"sv};
+		alloc::scope accounting{alloc::phase::config};
+		// the full config has no notion of the journal, fold it back first
+		if (!config_journal::compact(path)) {
+			fmt::print(stderr, "{}: error: could not apply {}\n", app_name, config_journal::path_for(path));
+			return std::nullopt;
+		}
 		return parser::parse_yaml_file<config>(path, app_name);
 	}
 
+	std::optional<config> config::parse_yaml_readonly(std::filesystem::path const& path) {
+		startup::scope timing{startup::subsystem::config};
+		trace::span span{"parse_yaml_readonly"sv};
+		alloc::scope accounting{alloc::phase::config};
+
+		config_journal journal{};
+		auto const status = journal.load(path);
+		if (status == load_status::file_not_found || (status == load_status::loaded && journal.entries.empty())) {
+			return parser::parse_yaml_file<config>(path, app_name);
+		}
+
+		// the edits are replayed on a partial config, read back as the full
+		// one from memory; neither the config nor the journal is rewritten
+		partial::config cfg{};
+		if (cfg.load(path) != load_status::loaded) {
+			fmt::print(stderr, "{}: error: could not apply {}\n", app_name, config_journal::path_for(path));
+			return std::nullopt;
+		}
+
+		cfg.prepare_for_write();
+		ryml::Tree tree{};
+		auto ref = tree.rootref();
+		yaml::write_value(ref, cfg);
+
+		std::ostringstream text{};
+		yaml::emit_root(yaml::syntax_type::yaml, tree, text);
+		return parser::parse_yaml_text<config>(std::move(text).str(), path.string());
+	}
+
 	bool config::postprocess() { return version == kApiVersion; }
 
 	dated_employment_history insured_t::lookup(std::chrono::year_month const& date) const noexcept {
-		auto const& [on, employment] = find_in_timeline(date, history);
-		return {true, on, employment.part_time_scale, employment.salary};
+		auto const it = timeline_at(date, history);
+		if (it == history.end()) return {true, null_month, {}, {}};
+		return {true, it->first, it->second.part_time_scale, it->second.salary};
 	}
 
 	bool insured_t::postprocess() {
@@ -360,12 +405,36 @@ namespace quick_dra::v2::partial {
 		}
 
 		*this = std::move(*object);
+
+		config_journal journal{};
+		switch (journal.load(path)) {
+			case load_status::file_not_found:
+				break;
+			case load_status::loaded:
+				if (journal.is_stale(path)) {
+					if (!journal.entries.empty()) {
+						fmt::print(stderr, "Quick-DRA: warning: {} was modified outside of the journal, ignoring {}\n",
+						           path, config_journal::path_for(path));
+					}
+					break;
+				}
+				if (journal.replay(*this)) break;
+				[[fallthrough]];
+			default:
+				fmt::print(stderr, "Quick-DRA: error: could not apply {}\n", config_journal::path_for(path));
+				return load_status::errors_encountered;
+		}
+
 		return load_status::loaded;
 	}
 
 	config config::load_partial(std::filesystem::path const& path, bool writeable) {
 		config cfg{};
-		auto const load = cfg.load(path);
+		auto const load = [&] {
+			startup::scope timing{startup::subsystem::config};
+			alloc::scope accounting{alloc::phase::config};
+			return cfg.load(path);
+		}();
 		switch (load) {
 			case load_status::file_not_found:
 				if (writeable) {
@@ -388,23 +457,16 @@ namespace quick_dra::v2::partial {
 	}  // GCOV_EXCL_LINE[GCC]
 
 	bool config::store(std::filesystem::path const& path, syntax_type syntax) {
+		alloc::scope accounting{alloc::phase::store};
 		prepare_for_write();
 		ryml::Tree tree{};
 		auto ref = tree.rootref();
 		yaml::write_value(ref, *this);
 
-		ryml::csubstr output = yaml::emit_root(syntax, tree, ryml::substr{}, /*error_on_excess*/ false);
-
-		std::vector<char> buf(output.len);
-		output = yaml::emit_root(syntax, tree, ryml::to_substr(buf),
-		                         /*error_on_excess*/ true);
-
-		std::ofstream out{path, std::ios::out | std::ios::binary};
-		if (!out) {
-			return false;
-		}
+		if (!yaml::store_root(path, syntax, tree)) return false;
 
-		out.write(output.data(), static_cast<std::streamsize>(output.size()));
+		// every pending edit is now part of the config
+		config_journal::reset(path);
 		return true;
 	}
 
@@ -439,8 +501,9 @@ namespace quick_dra::v2::partial {
 		if (!history) {
 			return {false, null_month, std::nullopt, std::nullopt};
 		}
-		auto const& [valid, on, employment] = find_in_timeline_opt(date, *history);
-		return {valid, on, employment.part_time_scale, employment.salary};
+		auto const it = timeline_at(date, *history);
+		if (it == history->end()) return {false, null_month, std::nullopt, std::nullopt};
+		return {true, it->first, it->second.part_time_scale, it->second.salary};
 	}
 
 	bool insured_t::postprocess() {
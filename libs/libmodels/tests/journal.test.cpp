@@ -0,0 +1,206 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <quick_dra/models/journal.hpp>
+#include <quick_dra/models/project_reader.hpp>
+#include <string>
+#include <string_view>
+
+namespace quick_dra::testing {
+	namespace {
+		std::filesystem::path journaled_config(std::string_view name, std::string_view contents = "wersja: 2\n"sv) {
+			auto const basename = std::filesystem::temp_directory_path() / name;
+			auto filename = basename;
+			auto counter = 0u;
+
+			while (exists(filename) || exists(config_journal::path_for(filename))) {
+				++counter;
+				filename = fmt::format("{}-{}", basename, counter);
+			}
+
+			std::ofstream out{filename, std::ios::out | std::ios::binary};
+			out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+			return filename;
+		}
+
+		void remove_config(std::filesystem::path const& path) {
+			std::filesystem::remove(path);
+			std::filesystem::remove(config_journal::path_for(path));
+		}
+
+		partial::insured_t person(std::string_view first_name, std::string_view document) {
+			partial::insured_t result{};
+			result.first_name = std::string{first_name};
+			result.last_name = "Iksiński"s;
+			result.kind = "2"s;
+			result.document = std::string{document};
+			return result;
+		}
+
+		void add(std::filesystem::path const& path, partial::insured_t const& insured) {
+			auto cfg = partial::config::load_partial(path);
+			cfg.insured->push_back(insured);
+			ASSERT_TRUE(commit(cfg, path, journal_entry::insured_added(cfg.insured->back())));
+		}
+	}  // namespace
+
+	TEST(journal, disabled_by_default) {
+		auto const filename = journaled_config("journal-disabled"sv);
+		add(filename, person("Jan"sv, "EH0123456"sv));
+
+		EXPECT_FALSE(std::filesystem::exists(config_journal::path_for(filename)));
+
+		auto const cfg = partial::config::load_partial(filename);
+		ASSERT_EQ(cfg.insured->size(), 1u);
+		EXPECT_EQ(cfg.insured->front().first_name, "Jan"sv);
+		remove_config(filename);
+	}
+
+	TEST(journal, edits_are_appended) {
+		auto const filename = journaled_config("journal-append"sv);
+		ASSERT_TRUE(config_journal::enable(filename));
+		auto const size_before = std::filesystem::file_size(filename);
+
+		add(filename, person("Jan"sv, "EH0123456"sv));
+		add(filename, person("Piotr"sv, "EH0123457"sv));
+
+		EXPECT_EQ(std::filesystem::file_size(filename), size_before);
+
+		config_journal journal{};
+		ASSERT_EQ(journal.load(filename), load_status::loaded);
+		EXPECT_EQ(journal.compact_every, config_journal::kDefaultCompactEvery);
+		ASSERT_EQ(journal.entries.size(), 2u);
+		EXPECT_EQ(journal.entries.front().op, journal_op::insured_add);
+
+		auto cfg = partial::config::load_partial(filename);
+		ASSERT_EQ(cfg.insured->size(), 2u);
+		EXPECT_EQ(cfg.insured->back().first_name, "Piotr"sv);
+		EXPECT_EQ(cfg.insured->back().last_name, "Iksiński"sv);
+
+		cfg.insured->erase(cfg.insured->begin());
+		ASSERT_TRUE(commit(cfg, filename, journal_entry::insured_removed(0)));
+
+		cfg = partial::config::load_partial(filename);
+		ASSERT_EQ(cfg.insured->size(), 1u);
+		EXPECT_EQ(cfg.insured->front().first_name, "Piotr"sv);
+		remove_config(filename);
+	}
+
+	TEST(journal, compacts_every_n_edits) {
+		auto const filename = journaled_config("journal-compact"sv);
+		ASSERT_TRUE(config_journal::enable(filename, 2));
+
+		add(filename, person("Jan"sv, "EH0123456"sv));
+		add(filename, person("Piotr"sv, "EH0123457"sv));
+
+		config_journal journal{};
+		ASSERT_EQ(journal.load(filename), load_status::loaded);
+		EXPECT_EQ(journal.compact_every, 2u);
+		EXPECT_TRUE(journal.entries.empty());
+		EXPECT_FALSE(journal.is_stale(filename));
+
+		auto const cfg = partial::config::load_partial(filename);
+		EXPECT_EQ(cfg.insured->size(), 2u);
+		remove_config(filename);
+	}
+
+	TEST(journal, disable_folds_pending_edits) {
+		auto const filename = journaled_config("journal-disable"sv);
+		ASSERT_TRUE(config_journal::enable(filename));
+		add(filename, person("Jan"sv, "EH0123456"sv));
+
+		ASSERT_TRUE(config_journal::disable(filename));
+		EXPECT_FALSE(std::filesystem::exists(config_journal::path_for(filename)));
+
+		auto const cfg = partial::config::load_partial(filename);
+		ASSERT_EQ(cfg.insured->size(), 1u);
+		EXPECT_EQ(cfg.insured->front().document, "EH0123456"sv);
+		remove_config(filename);
+	}
+
+	TEST(journal, stale_journal_is_ignored) {
+		auto const filename = journaled_config("journal-stale"sv);
+		ASSERT_TRUE(config_journal::enable(filename));
+		add(filename, person("Jan"sv, "EH0123456"sv));
+
+		{
+			std::ofstream out{filename, std::ios::out | std::ios::binary};
+			out << "wersja: 2\nwypadkowe: {}\n";
+		}
+
+		::testing::internal::CaptureStderr();
+		auto const cfg = partial::config::load_partial(filename);
+		auto const err = ::testing::internal::GetCapturedStderr();
+
+		EXPECT_TRUE(cfg.insured->empty());
+		EXPECT_EQ(err, fmt::format("Quick-DRA: warning: {} was modified outside of the journal, ignoring {}\n",
+		                           filename, config_journal::path_for(filename)));
+		remove_config(filename);
+	}
+
+	TEST(journal, full_config_sees_pending_edits) {
+		auto const filename = journaled_config("journal-full"sv);
+		ASSERT_TRUE(config_journal::enable(filename));
+
+		auto payer = partial::config::load_partial(filename);
+		payer.payer.emplace();
+		payer.payer->first_name = "Jan"s;
+		payer.payer->last_name = "Nowak"s;
+		payer.payer->kind = "2"s;
+		payer.payer->document = "AB4123456"s;
+		ASSERT_TRUE(commit(payer, filename, journal_entry::payer_changed(*payer.payer)));
+
+		config_journal journal{};
+		ASSERT_EQ(journal.load(filename), load_status::loaded);
+		ASSERT_EQ(journal.entries.size(), 1u);
+
+		ASSERT_TRUE(config_journal::compact(filename));
+		ASSERT_EQ(journal.load(filename), load_status::loaded);
+		EXPECT_TRUE(journal.entries.empty());
+
+		auto const cfg = partial::config::load_partial(filename);
+		ASSERT_TRUE(cfg.payer);
+		EXPECT_EQ(cfg.payer->last_name, "Nowak"sv);
+		remove_config(filename);
+	}
+
+	TEST(journal, read_only_parse_keeps_the_files) {
+		auto const filename = journaled_config("journal-read-only"sv, R"(wersja: 2
+płatnik:
+  nazwisko: 'Nowak, Jan'
+  dowód: ABC523456
+  nip: 7680002466
+  pesel: 26211012346
+ubezpieczeni:
+  - nazwisko: 'Hancock, John'
+    dowód: AAA000000
+    tytuł ubezpieczenia: 0110 0 0
+)"sv);
+		ASSERT_TRUE(config_journal::enable(filename));
+
+		auto insured = person("Jan"sv, "EH0123456"sv);
+		insured.title = insurance_title{.title_code = "0110"s, .pension_right = 0, .disability_level = 0};
+		add(filename, insured);
+
+		auto const config_stamp = file_stamp(filename);
+		auto const journal_stamp = file_stamp(config_journal::path_for(filename));
+
+		auto const cfg = config::parse_yaml_readonly(filename);
+		ASSERT_TRUE(cfg);
+		ASSERT_EQ(cfg->insured.size(), 2u);
+		EXPECT_EQ(cfg->insured.back().first_name, "Jan"sv);
+
+		EXPECT_EQ(file_stamp(filename), config_stamp);
+		EXPECT_EQ(file_stamp(config_journal::path_for(filename)), journal_stamp);
+		config_journal journal{};
+		ASSERT_EQ(journal.load(filename), load_status::loaded);
+		EXPECT_EQ(journal.entries.size(), 1u);
+		remove_config(filename);
+	}
+}  // namespace quick_dra::testing
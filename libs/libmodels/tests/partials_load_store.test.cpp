@@ -115,6 +115,21 @@ namespace quick_dra::testing {
 		std::filesystem::remove(filename);
 	}
 
+	TEST(partial, store_replaces_existing) {
+		auto const filename = unique("partial-config-replace"sv, "previous contents, way longer than the config\n"sv);
+		auto cfg = partial::config::load_partial(test_data_dir() / ".quick_dra.AB4123456_50671500000.quarter.yaml"sv);
+		EXPECT_TRUE(cfg.store(filename));
+
+		auto const actual_content = get_file_contents(filename);
+		ASSERT_TRUE(actual_content);
+		EXPECT_TRUE(actual_content->starts_with("$schema: "sv));  //-V1007 (the uninitialized value is guarded by the ASSERT)
+
+		auto temp = filename;
+		temp += ".tmp"sv;
+		EXPECT_FALSE(std::filesystem::exists(temp));
+		std::filesystem::remove(filename);
+	}
+
 	bool v1_store(v1::partial::config& self,
 	              std::filesystem::path const& path,
 	              syntax_type syntax = syntax_type::yaml) {
@@ -17,6 +17,17 @@ namespace quick_dra::testing {
 		ASSERT_EQ(var::insured, "insured"_var);
 		ASSERT_EQ(var::insured, varname{.path = {"insured"s}});
 	}
+
+	TEST(varname, compiletime_segments) {
+		static_assert(var::salary.depth == 1);
+		static_assert(var::salary.net.depth == 2);
+		static_assert(var::salary.net.segments[0] == "salary"sv);
+		static_assert(var::salary.net.segments[1] == "net"sv);
+		static_assert("$parent.child.grandchild"_var.depth == 3);
+
+		ASSERT_EQ(static_cast<varname>("$parent.child.grandchild"_var), varname::parse("$parent.child.grandchild"sv));
+		ASSERT_EQ(static_cast<varname>(var::salary.payer_gross), varname::parse("salary.payer_gross"sv));
+	}
 	class global_object : public ::testing::Test {
 	protected:
 		quick_dra::global_object state_;
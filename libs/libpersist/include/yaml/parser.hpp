@@ -6,6 +6,7 @@
 #include <concepts>
 #include <filesystem>
 #include <functional>
+#include <optional>
 #include <ryml.hpp>
 #include <ryml_std.hpp>
 #include <string>
@@ -15,6 +16,9 @@
 #include <yaml/writer.hpp>
 
 namespace yaml {
+	// the whole file, or nullopt, when it cannot be opened
+	std::optional<std::string> read_file(std::filesystem::path const& path);
+
 	struct parser {
 		base_ctx context(base_ctx const& parent = {}) const;
 		ryml::Parser build_rapid_parser() noexcept;
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <ostream>
 #include <ryml.hpp>
 #include <ryml_std.hpp>
 #include <string_view>
@@ -15,6 +18,11 @@ namespace yaml {
 		                                   : ryml::emit_json(tree, tree.root_id(), buf, error_on_excess);
 	}
 
+	inline std::ostream& emit_root(syntax_type syntax, ryml::Tree const& tree, std::ostream& out) {
+		return syntax == syntax_type::yaml ? out << ryml::as_yaml(tree, tree.root_id())
+		                                   : out << ryml::as_json(tree, tree.root_id());
+	}
+
 	inline std::string_view view(ryml::csubstr const& sub) {
 		if (sub.empty()) return {};
 		return {sub.data(), sub.size()};
@@ -22,6 +30,26 @@ namespace yaml {
 
 	struct c4_error_exception {};
 
+	// While it lives, the parse errors and the "cannot find" messages of
+	// the calling thread go to the callback, one line at a time and without
+	// the newline, instead of being printed. Nests.
+	class message_capture {
+	public:
+		using callback = std::function<void(std::string_view)>;
+
+		explicit message_capture(callback on_message);
+		~message_capture();
+		message_capture(message_capture const&) = delete;
+		message_capture& operator=(message_capture const&) = delete;
+
+		// false, with no capture installed on the calling thread
+		static bool deliver(std::string_view message);
+
+	private:
+		callback on_message_;
+		message_capture* prev_;
+	};
+
 	struct ref_ctx;
 
 	struct base_ctx {
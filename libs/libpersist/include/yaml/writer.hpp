@@ -4,6 +4,7 @@
 #pragma once
 
 #include <charconv>
+#include <filesystem>
 #include <map>
 #include <optional>
 #include <set>
@@ -43,6 +44,10 @@ namespace yaml {
 	void write_value(ryml::NodeRef& ref, std::integral auto ctx);
 	void write_value(ryml::NodeRef& ref, std::string const& ctx);
 
+	// Emits the tree in one pass into a sibling temporary file and renames it
+	// over the target, so a failed write never leaves a truncated config behind
+	bool store_root(std::filesystem::path const& path, syntax_type syntax, ryml::Tree const& tree);
+
 	template <typename T>
 	concept PreparableValue = requires(T& ctx) {
 		{ ctx.prepare_for_write() };  // NOLINT(readability/braces)
@@ -5,6 +5,7 @@
 #include <fmt/std.h>
 #include <fstream>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <yaml/parser.hpp>
@@ -15,25 +16,33 @@ namespace yaml {
 	namespace {
 		template <typename ErrorCallback>
 		std::optional<std::string> open_with(std::filesystem::path const& path, ErrorCallback&& on_error) {
-			std::optional<std::string> result{};
-			std::ifstream in{path, std::ios::in | std::ios::binary};
-			if (!in) {
-				on_error();
-				return result;
-			}
-
-			std::ostringstream contents;
-			contents << in.rdbuf();
-			result = std::move(contents).str();
-
+			auto result = read_file(path);
+			if (!result) on_error();
 			return result;
 		}
 
 		std::optional<std::string> open(std::filesystem::path const& path, std::string_view app_name) {
-			return open_with(path, [app_name, &path] { fmt::print("{}: error: cannot find {}\n", app_name, path); });
+			return open_with(path, [app_name, &path] {
+				if (auto const line = fmt::format("{}: error: cannot find {}", app_name, path);
+				    !message_capture::deliver(line)) {
+					fmt::print("{}\n", line);
+				}
+			});
 		}
 	}  // namespace
 
+	std::optional<std::string> read_file(std::filesystem::path const& path) {
+		std::optional<std::string> result{};
+		std::ifstream in{path, std::ios::in | std::ios::binary};
+		if (!in) return result;
+
+		std::ostringstream contents;
+		contents << in.rdbuf();
+		result = std::move(contents).str();
+
+		return result;
+	}
+
 	base_ctx parser::context(base_ctx const& parent) const {
 		auto result = parent;
 		result.parser = &rapid_parser;
@@ -2,6 +2,9 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <fmt/format.h>
+#include <iterator>
+#include <string>
+#include <utility>
 #include <yaml/ref.hpp>
 
 using namespace std::literals;
@@ -9,6 +12,7 @@ using namespace std::literals;
 namespace yaml {
 	namespace {
 		thread_local struct base_ctx::error_handler* head = nullptr;
+		thread_local message_capture* capture_head = nullptr;
 
 		[[noreturn]] void c4_error_handler(const char* msg,
 		                                   size_t msg_len,
@@ -19,6 +23,19 @@ namespace yaml {
 		}  // GCOV_EXCL_LINE
 	}  // namespace
 
+	message_capture::message_capture(callback on_message)
+	    : on_message_{std::move(on_message)}, prev_{capture_head} {
+		capture_head = this;
+	}
+
+	message_capture::~message_capture() { capture_head = prev_; }
+
+	bool message_capture::deliver(std::string_view message) {
+		if (!capture_head) return false;
+		capture_head->on_message_(message);
+		return true;
+	}
+
 	base_ctx::error_handler::error_handler() : prev{head} { head = this; }
 	base_ctx::error_handler::~error_handler() {
 		head = prev;
@@ -38,10 +55,11 @@ namespace yaml {
 	bool base_ctx::error_handler::handle_msg(c4::yml::Location const& loc,
 	                                         std::string_view msg,
 	                                         std::string_view level) {
-		if (!loc.name.empty()) {
-			fmt::print(stderr, "{}:", view(loc.name));
+		auto line = loc.name.empty() ? std::string{} : fmt::format("{}:", view(loc.name));
+		fmt::format_to(std::back_inserter(line), "{}:{}: {}: {}", loc.line + 1, loc.col + 1, level, msg);
+		if (!message_capture::deliver(line)) {
+			fmt::print(stderr, "{}\n", line);
 		}
-		fmt::print(stderr, "{}:{}: {}: {}\n", loc.line + 1, loc.col + 1, level, msg);
 
 		auto stack = this;
 		while (stack) {
@@ -70,8 +88,10 @@ namespace yaml {
 		if (parser && parser->source().len && ref_ && head) {
 			return head->handle_error(ref_->location(*parser), msg);
 		}  // GCOV_EXCL_LINE
-		[[unlikely]];                            // GCOV_EXCL_LINE
-		fmt::print(stderr, "error: {}\n", msg);  // GCOV_EXCL_LINE
-		return false;                            // GCOV_EXCL_LINE
+		[[unlikely]];                                                    // GCOV_EXCL_LINE
+		if (!message_capture::deliver(fmt::format("error: {}", msg))) {  // GCOV_EXCL_LINE
+			fmt::print(stderr, "error: {}\n", msg);                      // GCOV_EXCL_LINE
+		}                                                                // GCOV_EXCL_LINE
+		return false;                                                    // GCOV_EXCL_LINE
 	}
 }  // namespace yaml
@@ -12,5 +12,51 @@
 using namespace std::literals;
 
 namespace yaml {
+	namespace {
+		std::filesystem::path resolve_target(std::filesystem::path const& path) {
+			std::error_code ec{};
+			if (!std::filesystem::is_symlink(path, ec) || ec) {
+				return path;
+			}
+
+			auto resolved = std::filesystem::canonical(path, ec);
+			if (ec) return path;  // GCOV_EXCL_LINE
+			return resolved;
+		}
+	}  // namespace
+
 	void write_value(ryml::NodeRef& ref, std::string const& ctx) { ref << c4::csubstr{ctx.c_str(), ctx.length()}; }
+
+	bool store_root(std::filesystem::path const& path, syntax_type syntax, ryml::Tree const& tree) {
+		auto const target = resolve_target(path);
+		auto temp = target;
+		temp += ".tmp"sv;
+
+		std::error_code ec{};
+		{
+			std::ofstream out{temp, std::ios::out | std::ios::binary | std::ios::trunc};
+			if (!out) {
+				return false;
+			}
+
+			emit_root(syntax, tree, out);
+			out.flush();
+
+			if (!out) {
+				// GCOV_EXCL_START
+				out.close();
+				std::filesystem::remove(temp, ec);
+				return false;
+				// GCOV_EXCL_STOP
+			}
+		}
+
+		std::filesystem::rename(temp, target, ec);
+		if (ec) {
+			std::filesystem::remove(temp, ec);
+			return false;
+		}
+
+		return true;
+	}
 }  // namespace yaml
@@ -0,0 +1,152 @@
+/* Copyright (c) 2026 midnightBITS
+ * This code is licensed under MIT license (see LICENSE for details)
+ */
+
+#ifndef QUICK_DRA_QUICK_DRA_H
+#define QUICK_DRA_QUICK_DRA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(QDRA_BUILDING)
+#define QDRA_API __declspec(dllexport)
+#else
+#define QDRA_API __declspec(dllimport)
+#endif
+#else
+#define QDRA_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped each time a struct below gets a new field; the fields are only
+ * ever appended, and `struct_size` tells the library which ones are set.
+ * It may be anything from the QDRA_*_V1_SIZE of the struct up; the fields
+ * past it are taken as zero. */
+#define QDRA_API_VERSION 1
+
+/* The end of the last field of a struct in API version 1. */
+#define QDRA_V1_SIZE(type, last_field) (offsetof(type, last_field) + sizeof(((type*)0)->last_field))
+
+/* Used in place of the accident insurance rate to take the one from tax
+ * parameters. */
+#define QDRA_DEFAULT_RATE (-1)
+
+typedef enum qdra_status {
+	QDRA_OK = 0,
+	QDRA_INVALID_ARGUMENT = 1,
+	QDRA_NO_TAX_CONFIG = 2,
+	QDRA_NO_TEMPLATES = 3,
+	QDRA_BUFFER_TOO_SMALL = 4,
+	QDRA_SINK_FAILED = 5,
+	QDRA_INTERNAL_ERROR = 6,
+} qdra_status;
+
+/* Tax parameters and the form templates are loaded once, when the engine
+ * is created. An engine may be used from any number of threads at the
+ * same time; only qdra_engine_destroy needs all the other calls done. */
+typedef struct qdra_engine qdra_engine;
+
+/* Receives the messages of the loaders (missing files, YAML errors), one
+ * line at a time, on the thread calling qdra_engine_create. Nothing is
+ * printed by the library. */
+typedef void (*qdra_diagnostic)(void* context, const char* message);
+
+typedef struct qdra_engine_options {
+	size_t struct_size;          /* sizeof(qdra_engine_options) */
+	const char* data_dir;        /* tax_config.yaml and templates.yaml; NULL for the ones next to the executable */
+	const char* tax_config_path; /* takes precedence over the downloaded and the data_dir ones; may be NULL */
+	int download;                /* non-zero to fetch newest tax parameters from the project repository */
+	qdra_diagnostic diagnostic;  /* may be NULL; on failure, the messages also end up in qdra_last_error */
+	void* diagnostic_context;
+} qdra_engine_options;
+
+#define QDRA_ENGINE_OPTIONS_V1_SIZE QDRA_V1_SIZE(qdra_engine_options, diagnostic_context)
+
+/* All strings are UTF-8. Out of id_card and passport, exactly one is
+ * expected to be given. */
+typedef struct qdra_payer {
+	size_t struct_size; /* sizeof(qdra_payer) */
+	const char* first_name;
+	const char* last_name;
+	const char* tax_id;    /* NIP */
+	const char* social_id; /* PESEL */
+	const char* id_card;
+	const char* passport;
+} qdra_payer;
+
+#define QDRA_PAYER_V1_SIZE QDRA_V1_SIZE(qdra_payer, passport)
+
+/* Out of social_id, id_card and passport, exactly one is expected to be
+ * given. Amounts are in grosz. */
+typedef struct qdra_insured {
+	size_t struct_size; /* sizeof(qdra_insured), the same in every item */
+	const char* first_name;
+	const char* last_name;
+	const char* social_id; /* PESEL */
+	const char* id_card;
+	const char* passport;
+	const char* title_code; /* e.g. "0110" */
+	unsigned pension_right;
+	unsigned disability_level;
+	int64_t salary;     /* negative for minimal pay */
+	unsigned scale_num; /* part-time scale, 0/0 for full time */
+	unsigned scale_den;
+} qdra_insured;
+
+#define QDRA_INSURED_V1_SIZE QDRA_V1_SIZE(qdra_insured, scale_den)
+
+typedef struct qdra_report {
+	size_t struct_size; /* sizeof(qdra_report) */
+	int year;           /* month being reported */
+	unsigned month;
+	unsigned serial;    /* 1 to 99 */
+	int today_year;     /* date of the document, all zeros for the current date */
+	unsigned today_month;
+	unsigned today_day;
+	int32_t accident_insurance; /* in hundredths of a percent, or QDRA_DEFAULT_RATE */
+	int pretty;                 /* non-zero to indent the document */
+	const qdra_payer* payer;
+	const qdra_insured* insured; /* items insured->struct_size bytes apart */
+	size_t insured_count;
+} qdra_report;
+
+#define QDRA_REPORT_V1_SIZE QDRA_V1_SIZE(qdra_report, insured_count)
+
+/* Receives the document in one or more chunks; a non-zero result stops
+ * the generation with QDRA_SINK_FAILED. */
+typedef int (*qdra_sink)(void* context, const char* data, size_t size);
+
+QDRA_API int qdra_api_version(void);
+QDRA_API const char* qdra_version(void);
+QDRA_API const char* qdra_status_message(qdra_status status);
+
+/* Details of the last failure on the calling thread; valid until the
+ * next call made by that thread. */
+QDRA_API const char* qdra_last_error(void);
+
+QDRA_API qdra_status qdra_engine_create(const qdra_engine_options* options, qdra_engine** engine);
+QDRA_API void qdra_engine_destroy(qdra_engine* engine);
+
+/* Writes the KEDU document into the buffer, without a terminating zero,
+ * and its size into `written`. With a buffer too small (or NULL), returns
+ * QDRA_BUFFER_TOO_SMALL and stores the size needed in `written`. */
+QDRA_API qdra_status qdra_generate(qdra_engine* engine,
+                                   const qdra_report* report,
+                                   char* buffer,
+                                   size_t buffer_size,
+                                   size_t* written);
+
+QDRA_API qdra_status qdra_generate_to(qdra_engine* engine,
+                                      const qdra_report* report,
+                                      qdra_sink sink,
+                                      void* context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUICK_DRA_QUICK_DRA_H */
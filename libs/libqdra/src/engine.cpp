@@ -0,0 +1,157 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "engine.hpp"
+#include <fmt/format.h>
+#include <chrono>
+#include <memory_resource>
+#include <optional>
+#include <quick_dra/base/chrono.hpp>
+#include <quick_dra/docs/file_set.hpp>
+#include <quick_dra/docs/xml.hpp>
+#include <string>
+#include <utility>
+
+using namespace std::literals;
+
+namespace quick_dra::embedded {
+	namespace {
+		bool has_text(char const* value) noexcept { return value && *value; }
+
+		struct document_kind {
+			char const* value;
+			std::string_view kind;
+		};
+
+		// the same rules as in the config file: exactly one document
+		bool pick_document(std::initializer_list<document_kind> candidates,
+		                   std::string& kind,
+		                   std::string& document) {
+			kind.clear();
+			document.clear();
+			for (auto const& [value, code] : candidates) {
+				if (!has_text(value)) continue;
+				if (!kind.empty()) return false;
+				kind.assign(code);
+				document.assign(value);
+			}
+			return !kind.empty();
+		}
+
+		qdra_status invalid(std::string& error, std::string message) {
+			error = std::move(message);
+			return QDRA_INVALID_ARGUMENT;
+		}
+	}  // namespace
+
+	qdra_status make_config(qdra_report const& report, config& cfg, std::string& error) {
+		auto const date = std::chrono::year{report.year} / std::chrono::month{report.month};
+		if (!date.ok()) {
+			return invalid(error, fmt::format("report: invalid month {}-{:02}", report.year, report.month));
+		}
+
+		if (!report.payer) return invalid(error, "report: payer is missing");
+		if (report.insured_count && !report.insured) return invalid(error, "report: insured list is missing");
+
+		if (report.payer->struct_size < QDRA_PAYER_V1_SIZE) {
+			return invalid(error, "payer: struct_size is smaller than in API version 1");
+		}
+		// the items are as large as the caller's header made them
+		auto const stride = report.insured_count ? report.insured->struct_size : sizeof(qdra_insured);
+		if (stride < QDRA_INSURED_V1_SIZE) {
+			return invalid(error, "insured: struct_size is smaller than in API version 1");
+		}
+
+		auto const payer = versioned<qdra_payer>(report.payer, report.payer->struct_size);
+		if (!has_text(payer.first_name) || !has_text(payer.last_name)) {
+			return invalid(error, "payer: both first and last name are needed");
+		}
+		if (!pick_document({{payer.id_card, "1"sv}, {payer.passport, "2"sv}}, cfg.payer.kind, cfg.payer.document)) {
+			return invalid(error, "payer: either id_card or passport is needed");
+		}
+		cfg.payer.first_name = payer.first_name;
+		cfg.payer.last_name = payer.last_name;
+		cfg.payer.tax_id = has_text(payer.tax_id) ? payer.tax_id : "";
+		cfg.payer.social_id = has_text(payer.social_id) ? payer.social_id : "";
+
+		cfg.insured.clear();
+		cfg.insured.reserve(report.insured_count);
+		for (size_t index = 0; index < report.insured_count; ++index) {
+			auto const* item = reinterpret_cast<char const*>(report.insured) + index * stride;
+			auto const src = versioned<qdra_insured>(item, stride);
+			auto& dst = cfg.insured.emplace_back();
+
+			if (!has_text(src.first_name) || !has_text(src.last_name)) {
+				return invalid(error, fmt::format("insured #{}: both first and last name are needed", index));
+			}
+			if (!pick_document({{src.social_id, "P"sv}, {src.id_card, "1"sv}, {src.passport, "2"sv}}, dst.kind,
+			                   dst.document)) {
+				return invalid(error,
+				               fmt::format("insured #{}: one of social_id, id_card or passport is needed", index));
+			}
+			if (!has_text(src.title_code)) {
+				return invalid(error, fmt::format("insured #{}: insurance title is needed", index));
+			}
+
+			dst.first_name = src.first_name;
+			dst.last_name = src.last_name;
+			dst.title = insurance_title{.title_code = src.title_code,
+			                            .pension_right = static_cast<unsigned short>(src.pension_right),
+			                            .disability_level = static_cast<unsigned short>(src.disability_level)};
+
+			auto& employment = dst.history[date];
+			if (src.salary >= 0) employment.salary = currency{src.salary};
+			if (src.scale_den) employment.part_time_scale = ratio{src.scale_num, src.scale_den};
+		}
+
+		if (report.accident_insurance != QDRA_DEFAULT_RATE) {
+			if (report.accident_insurance < 0) {
+				return invalid(error,
+				               fmt::format("report: invalid accident insurance rate {}", report.accident_insurance));
+			}
+			cfg.accident_insurance.emplace();
+			cfg.accident_insurance->emplace(date, percent{report.accident_insurance});
+		}
+
+		return QDRA_OK;
+	}
+
+	engine::engine(tax_config const& tax, compiled_templates templates)
+	    : tax_{tax}, templates_{std::move(templates)} {}
+
+	qdra_status engine::generate(qdra_report const& report, std::ostream& out, std::string& error) {
+		if (report.serial < 1 || report.serial > 99) {
+			return invalid(error, "report: serial number must be in range 1 to 99 inclusive");
+		}
+
+		auto today = get_today();
+		if (report.today_year || report.today_month || report.today_day) {
+			today = std::chrono::year{report.today_year} / std::chrono::month{report.today_month} /
+			        std::chrono::day{report.today_day};
+			if (!today.ok()) {
+				return invalid(error, fmt::format("report: invalid date {}-{:02}-{:02}", report.today_year,
+				                                  report.today_month, report.today_day));
+			}
+		}
+
+		config cfg{};
+		if (auto const status = make_config(report, cfg, error); status != QDRA_OK) return status;
+
+		auto const date = std::chrono::year{report.year} / std::chrono::month{report.month};
+		std::optional<tax_parameters> overridden{};
+		auto const& params = lookup_parameters(overridden, tax_, cfg.accident_insurance, date);
+
+		// the forms and the document are released in one go, together with the arena
+		std::pmr::monotonic_buffer_resource arena{};
+		auto const forms = prepare_form_set(verbose::none, report.serial, date, today, cfg, params, &rca_, &arena);
+		auto const file = build_file_set(verbose::none, forms, templates_, &arena);
+
+		if (report.pretty)
+			out << file.indented();
+		else
+			out << file;
+		out.flush();
+
+		return QDRA_OK;
+	}
+}  // namespace quick_dra::embedded
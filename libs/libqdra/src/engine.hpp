@@ -0,0 +1,42 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <quick_dra/docs/forms.hpp>
+#include <quick_dra/io/tax_config.hpp>
+#include <quick_dra/models/types.hpp>
+#include <quick_dra/quick_dra.h>
+#include <string>
+
+namespace quick_dra::embedded {
+	// Only the RCA cache changes after construction, and it has its own
+	// lock; the rest is read by all the threads using the handle.
+	class engine {
+	public:
+		engine(tax_config const& tax, compiled_templates templates);
+
+		qdra_status generate(qdra_report const& report, std::ostream& out, std::string& error);
+
+	private:
+		resolved_tax_parameters tax_;
+		compiled_templates templates_;
+		rca_cache rca_{};
+	};
+
+	// The caller's struct, as known to this version: the fields missing from
+	// an older one are left at zero, the ones appended in a newer one are
+	// not read. The size is expected to be checked against the V1 one.
+	template <typename Struct>
+	Struct versioned(void const* source, size_t struct_size) {
+		Struct result{};
+		std::memcpy(&result, source, std::min(struct_size, sizeof(Struct)));
+		return result;
+	}
+
+	// copies the structs given by the caller, as if read from a config file
+	qdra_status make_config(qdra_report const& report, config& cfg, std::string& error);
+}  // namespace quick_dra::embedded
@@ -0,0 +1,259 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <quick_dra/quick_dra.h>
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <quick_dra/base/diag.hpp>
+#include <quick_dra/base/paths.hpp>
+#include <quick_dra/base/str.hpp>
+#include <quick_dra/io/tax_config.hpp>
+#include <quick_dra/version.hpp>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <yaml/ref.hpp>
+#include "engine.hpp"
+
+using namespace std::literals;
+
+struct qdra_engine {
+	quick_dra::embedded::engine impl;
+};
+
+namespace quick_dra::embedded {
+	namespace {
+		thread_local std::string last_error{};
+
+		// the YAML parser reports errors through process-wide callbacks
+		std::mutex loader_mtx{};
+
+		qdra_status fail(qdra_status status, std::string message) {
+			last_error = std::move(message);
+			return status;
+		}
+
+		std::optional<std::filesystem::path> path_from(char const* value) {
+			if (!value || !*value) return std::nullopt;
+			return std::filesystem::path{as_u8v(value)};
+		}
+
+		// The loaders look into platform::config_data_dir(); only ever
+		// changed for the time an engine is created, under loader_mtx.
+		class data_dir_override {
+		public:
+			explicit data_dir_override(std::optional<std::filesystem::path> const& dir) {
+				if (!dir) return;
+				previous_ = platform::config_data_dir();
+				platform::config_data_dir(*dir);
+			}
+			~data_dir_override() {
+				if (previous_) platform::config_data_dir(*previous_);
+			}
+			data_dir_override(data_dir_override const&) = delete;
+			data_dir_override& operator=(data_dir_override const&) = delete;
+
+		private:
+			std::optional<std::filesystem::path> previous_{};
+		};
+
+		// Fills the caller's buffer and keeps counting past its end, so
+		// the size needed is known after a single pass.
+		class buffer_sink : public std::streambuf {
+		public:
+			buffer_sink(char* buffer, size_t size) {
+				if (buffer) setp(buffer, buffer + size);
+			}
+
+			size_t size() const noexcept { return static_cast<size_t>(pptr() - pbase()) + overflow_; }
+			bool overflowed() const noexcept { return overflow_ != 0; }
+
+		protected:
+			int_type overflow(int_type ch) override {
+				if (!traits_type::eq_int_type(ch, traits_type::eof())) ++overflow_;
+				return traits_type::not_eof(ch);
+			}
+
+			std::streamsize xsputn(char_type const* data, std::streamsize count) override {
+				auto const room = epptr() - pptr();
+				auto const copied = std::min(room, count);
+				if (copied > 0) {
+					traits_type::copy(pptr(), data, static_cast<size_t>(copied));
+					pbump(static_cast<int>(copied));
+				}
+				overflow_ += static_cast<size_t>(count - copied);
+				return count;
+			}
+
+		private:
+			size_t overflow_{};
+		};
+
+		class callback_sink : public std::streambuf {
+		public:
+			callback_sink(qdra_sink sink, void* context) : sink_{sink}, context_{context} {
+				setp(chunk_, chunk_ + sizeof(chunk_));
+			}
+
+			bool failed() const noexcept { return failed_; }
+
+		protected:
+			int_type overflow(int_type ch) override {
+				if (!flush()) return traits_type::eof();
+				if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+					*pptr() = traits_type::to_char_type(ch);
+					pbump(1);
+				}
+				return traits_type::not_eof(ch);
+			}
+
+			int sync() override { return flush() ? 0 : -1; }
+
+		private:
+			bool flush() {
+				auto const size = static_cast<size_t>(pptr() - pbase());
+				if (!failed_ && size && sink_(context_, pbase(), size) != 0) failed_ = true;
+				setp(chunk_, chunk_ + sizeof(chunk_));
+				return !failed_;
+			}
+
+			qdra_sink sink_;
+			void* context_;
+			bool failed_{false};
+			char chunk_[16 * 1024];
+		};
+
+		qdra_status check_report(qdra_engine* engine, qdra_report const* report, qdra_report& known) {
+			if (!engine) return fail(QDRA_INVALID_ARGUMENT, "engine is missing");
+			if (!report) return fail(QDRA_INVALID_ARGUMENT, "report is missing");
+			if (report->struct_size < QDRA_REPORT_V1_SIZE) {
+				return fail(QDRA_INVALID_ARGUMENT, "report: struct_size is smaller than in API version 1");
+			}
+			known = versioned<qdra_report>(report, report->struct_size);
+			return QDRA_OK;
+		}
+	}  // namespace
+}  // namespace quick_dra::embedded
+
+using namespace quick_dra;
+using namespace quick_dra::embedded;
+
+int qdra_api_version(void) { return QDRA_API_VERSION; }
+
+const char* qdra_version(void) { return QUICK_DRA_VERSION_STR QUICK_DRA_VERSION_STABILITY; }
+
+const char* qdra_status_message(qdra_status status) {
+	switch (status) {
+		case QDRA_OK:
+			return "success";
+		case QDRA_INVALID_ARGUMENT:
+			return "invalid argument";
+		case QDRA_NO_TAX_CONFIG:
+			return "tax parameters could not be loaded";
+		case QDRA_NO_TEMPLATES:
+			return "form templates could not be loaded";
+		case QDRA_BUFFER_TOO_SMALL:
+			return "buffer too small";
+		case QDRA_SINK_FAILED:
+			return "sink refused the document";
+		case QDRA_INTERNAL_ERROR:
+			return "internal error";
+	}
+	return "unknown status";
+}
+
+const char* qdra_last_error(void) { return last_error.c_str(); }
+
+qdra_status qdra_engine_create(const qdra_engine_options* options, qdra_engine** engine) try {
+	last_error.clear();
+	if (!engine) return fail(QDRA_INVALID_ARGUMENT, "engine is missing");
+	*engine = nullptr;
+
+	qdra_engine_options opts{.struct_size = sizeof(qdra_engine_options)};
+	if (options) {
+		if (options->struct_size < QDRA_ENGINE_OPTIONS_V1_SIZE) {
+			return fail(QDRA_INVALID_ARGUMENT, "options: struct_size is smaller than in API version 1");
+		}
+		opts = versioned<qdra_engine_options>(options, options->struct_size);
+	}
+
+	std::lock_guard lock{loader_mtx};
+	data_dir_override data_dir{path_from(opts.data_dir)};
+
+	// nothing is printed from inside of the host program
+	std::string messages{};
+	auto const on_message = [&](std::string_view message) {
+		messages.append("\n"sv).append(message);
+		if (opts.diagnostic) opts.diagnostic(opts.diagnostic_context, std::string{message}.c_str());
+	};
+	yaml::message_capture yaml_messages{on_message};
+	diag::capture diag_messages{[&](diag::level, std::string_view message) { on_message(message); }};
+
+	auto const download = opts.download ? github_config::download : github_config::skip;
+	auto tax = load_tax_config(verbose::none, path_from(opts.tax_config_path), download);
+	if (!tax) return fail(QDRA_NO_TAX_CONFIG, "no tax parameters could be read" + messages);
+
+	auto const templates_path = platform::config_data_dir() / "templates.yaml"sv;
+	auto raw_templates = templates::parse_yaml(templates_path);
+	if (!raw_templates) return fail(QDRA_NO_TEMPLATES, fmt::format("cannot read {}{}", templates_path, messages));
+
+	*engine = new qdra_engine{.impl = {*tax, compiled_templates::compile(*raw_templates)}};
+	return QDRA_OK;
+} catch (std::exception const& ex) {
+	return fail(QDRA_INTERNAL_ERROR, ex.what());
+} catch (...) {
+	return fail(QDRA_INTERNAL_ERROR, "unknown exception");
+}
+
+void qdra_engine_destroy(qdra_engine* engine) { delete engine; }
+
+qdra_status qdra_generate(qdra_engine* engine,
+                          const qdra_report* report,
+                          char* buffer,
+                          size_t buffer_size,
+                          size_t* written) try {
+	last_error.clear();
+	if (written) *written = 0;
+	qdra_report known{};
+	if (auto const status = check_report(engine, report, known); status != QDRA_OK) return status;
+
+	buffer_sink sink{buffer, buffer_size};
+	std::ostream out{&sink};
+	auto const status = engine->impl.generate(known, out, last_error);
+	if (status != QDRA_OK) return status;
+
+	if (written) *written = sink.size();
+	if (sink.overflowed()) {
+		return fail(QDRA_BUFFER_TOO_SMALL, fmt::format("{} bytes needed, {} given", sink.size(), buffer_size));
+	}
+	return QDRA_OK;
+} catch (std::exception const& ex) {
+	return fail(QDRA_INTERNAL_ERROR, ex.what());
+} catch (...) {
+	return fail(QDRA_INTERNAL_ERROR, "unknown exception");
+}
+
+qdra_status qdra_generate_to(qdra_engine* engine, const qdra_report* report, qdra_sink sink, void* context) try {
+	last_error.clear();
+	qdra_report known{};
+	if (auto const status = check_report(engine, report, known); status != QDRA_OK) return status;
+	if (!sink) return fail(QDRA_INVALID_ARGUMENT, "sink is missing");
+
+	callback_sink buffer{sink, context};
+	std::ostream out{&buffer};
+	auto const status = engine->impl.generate(known, out, last_error);
+	if (status != QDRA_OK) return status;
+
+	if (buffer.failed()) return fail(QDRA_SINK_FAILED, "sink returned an error");
+	return QDRA_OK;
+} catch (std::exception const& ex) {
+	return fail(QDRA_INTERNAL_ERROR, ex.what());
+} catch (...) {
+	return fail(QDRA_INTERNAL_ERROR, "unknown exception");
+}
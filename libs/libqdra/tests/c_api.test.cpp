@@ -0,0 +1,287 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <quick_dra/quick_dra.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace quick_dra::testing {
+	using namespace std::literals;
+
+	namespace {
+		static constexpr qdra_payer payer{
+		    .struct_size = sizeof(qdra_payer),
+		    .first_name = "Jan",
+		    .last_name = "Nowak",
+		    .tax_id = "7680002466",
+		    .social_id = "26211012346",
+		    .id_card = nullptr,
+		    .passport = "AB4123456",
+		};
+
+		static constexpr qdra_insured insured[] = {
+		    {
+		        .struct_size = sizeof(qdra_insured),
+		        .first_name = "Piotr",
+		        .last_name = "Iksiński",
+		        .social_id = "50671500000",
+		        .id_card = nullptr,
+		        .passport = nullptr,
+		        .title_code = "0110",
+		        .pension_right = 0,
+		        .disability_level = 0,
+		        .salary = -1,
+		        .scale_num = 0,
+		        .scale_den = 0,
+		    },
+		    {
+		        .struct_size = sizeof(qdra_insured),
+		        .first_name = "Anna",
+		        .last_name = "Kowalska",
+		        .social_id = nullptr,
+		        .id_card = "ABC123456",
+		        .passport = nullptr,
+		        .title_code = "0110",
+		        .pension_right = 0,
+		        .disability_level = 0,
+		        .salary = 7500'00,
+		        .scale_num = 3,
+		        .scale_den = 4,
+		    },
+		};
+
+		qdra_report make_report() {
+			return {
+			    .struct_size = sizeof(qdra_report),
+			    .year = 2025,
+			    .month = 12,
+			    .serial = 1,
+			    .today_year = 2026,
+			    .today_month = 1,
+			    .today_day = 1,
+			    .accident_insurance = QDRA_DEFAULT_RATE,
+			    .pretty = 0,
+			    .payer = &payer,
+			    .insured = insured,
+			    .insured_count = std::size(insured),
+			};
+		}
+
+		class c_api : public ::testing::Test {
+		protected:
+			static void SetUpTestSuite() {
+				qdra_engine_options options{
+				    .struct_size = sizeof(qdra_engine_options),
+				    .data_dir = QUICK_DRA_DATA_DIR,
+				    .tax_config_path = nullptr,
+				    .download = 0,
+				    .diagnostic = nullptr,
+				    .diagnostic_context = nullptr,
+				};
+				ASSERT_EQ(QDRA_OK, qdra_engine_create(&options, &engine_)) << qdra_last_error();
+			}
+
+			static void TearDownTestSuite() {
+				qdra_engine_destroy(engine_);
+				engine_ = nullptr;
+			}
+
+			static std::string generate(qdra_report const& report) {
+				size_t size{};
+				EXPECT_EQ(QDRA_BUFFER_TOO_SMALL, qdra_generate(engine_, &report, nullptr, 0, &size));
+				std::string result(size, '\0');
+				EXPECT_EQ(QDRA_OK, qdra_generate(engine_, &report, result.data(), result.size(), &size))
+				    << qdra_last_error();
+				result.resize(size);
+				return result;
+			}
+
+			static qdra_engine* engine_;
+		};
+
+		qdra_engine* c_api::engine_ = nullptr;
+
+		int append(void* context, char const* data, size_t size) {
+			static_cast<std::string*>(context)->append(data, size);
+			return 0;
+		}
+
+		int refuse(void*, char const*, size_t) { return 1; }
+
+		void collect(void* context, char const* message) {
+			static_cast<std::vector<std::string>*>(context)->emplace_back(message);
+		}
+
+		// as if built against the first header: nothing past the V1 fields
+		// is readable, so a read past them trips the sanitizers
+		template <typename Struct>
+		std::unique_ptr<char[]> v1_sized(Struct source, size_t v1_size) {
+			source.struct_size = v1_size;
+			auto result = std::make_unique<char[]>(v1_size);
+			std::memcpy(result.get(), &source, v1_size);
+			return result;
+		}
+
+		// as if built against a newer header, with a field appended
+		struct newer_insured {
+			qdra_insured known;
+			int64_t appended;
+		};
+	}  // namespace
+
+	TEST(c_api_static, version) {
+		EXPECT_EQ(QDRA_API_VERSION, qdra_api_version());
+		EXPECT_NE(""sv, qdra_version());
+		EXPECT_EQ("buffer too small"sv, qdra_status_message(QDRA_BUFFER_TOO_SMALL));
+	}
+
+	TEST(c_api_static, missing_data) {
+		qdra_engine_options options{
+		    .struct_size = sizeof(qdra_engine_options),
+		    .data_dir = "no/such/directory",
+		    .tax_config_path = nullptr,
+		    .download = 0,
+		    .diagnostic = nullptr,
+		    .diagnostic_context = nullptr,
+		};
+		std::vector<std::string> messages{};
+		options.diagnostic = collect;
+		options.diagnostic_context = &messages;
+
+		qdra_engine* engine{};
+		::testing::internal::CaptureStdout();
+		::testing::internal::CaptureStderr();
+		EXPECT_EQ(QDRA_NO_TAX_CONFIG, qdra_engine_create(&options, &engine));
+		auto const err = ::testing::internal::GetCapturedStderr();
+		auto const out = ::testing::internal::GetCapturedStdout();
+		EXPECT_EQ(nullptr, engine);
+
+		EXPECT_EQ(""sv, out);
+		EXPECT_EQ(""sv, err);
+		ASSERT_EQ(1u, messages.size());
+		EXPECT_NE(std::string::npos, messages.front().find("cannot find"sv)) << messages.front();
+
+		std::string_view const details{qdra_last_error()};
+		EXPECT_TRUE(details.starts_with("no tax parameters could be read\n"sv)) << details;
+		EXPECT_TRUE(details.ends_with(messages.front())) << details;
+	}
+
+	TEST_F(c_api, buffer) {
+		auto const doc = generate(make_report());
+		EXPECT_TRUE(doc.starts_with("<KEDU"sv)) << doc;
+		EXPECT_NE(std::string::npos, doc.find("50671500000"sv));
+		EXPECT_NE(std::string::npos, doc.find("ABC123456"sv));
+		EXPECT_NE(std::string::npos, doc.find("AB4123456"sv));
+	}
+
+	TEST_F(c_api, struct_size_of_items) {
+		auto const expected = generate(make_report());
+
+		newer_insured newer[] = {{.known = insured[0], .appended = -1}, {.known = insured[1], .appended = -1}};
+		for (auto& item : newer) {
+			item.known.struct_size = sizeof(newer_insured);
+		}
+		auto report = make_report();
+		report.insured = &newer[0].known;
+		EXPECT_EQ(expected, generate(report));
+
+		auto older = insured[0];
+		older.struct_size = sizeof(qdra_insured) / 2;
+		report = make_report();
+		report.insured = &older;
+		report.insured_count = 1;
+		size_t size{};
+		EXPECT_EQ(QDRA_INVALID_ARGUMENT, qdra_generate(engine_, &report, nullptr, 0, &size));
+		EXPECT_EQ("insured: struct_size is smaller than in API version 1"sv, qdra_last_error());
+	}
+
+	TEST_F(c_api, v1_sized_structs) {
+		auto const v1_payer = v1_sized(payer, QDRA_PAYER_V1_SIZE);
+		auto const v1_insured = v1_sized(insured[0], QDRA_INSURED_V1_SIZE);
+		auto report = make_report();
+		report.payer = reinterpret_cast<qdra_payer const*>(v1_payer.get());
+		report.insured = reinterpret_cast<qdra_insured const*>(v1_insured.get());
+		report.insured_count = 1;
+		auto const v1_report = v1_sized(report, QDRA_REPORT_V1_SIZE);
+
+		std::string doc{};
+		ASSERT_EQ(QDRA_OK,
+		          qdra_generate_to(engine_, reinterpret_cast<qdra_report const*>(v1_report.get()), append, &doc))
+		    << qdra_last_error();
+		report = make_report();
+		report.insured_count = 1;
+		EXPECT_EQ(generate(report), doc);
+
+		auto const v1_options = v1_sized(
+		    qdra_engine_options{
+		        .struct_size = 0,
+		        .data_dir = QUICK_DRA_DATA_DIR,
+		        .tax_config_path = nullptr,
+		        .download = 0,
+		        .diagnostic = nullptr,
+		        .diagnostic_context = nullptr,
+		    },
+		    QDRA_ENGINE_OPTIONS_V1_SIZE);
+		qdra_engine* engine{};
+		ASSERT_EQ(QDRA_OK, qdra_engine_create(reinterpret_cast<qdra_engine_options const*>(v1_options.get()), &engine))
+		    << qdra_last_error();
+		qdra_engine_destroy(engine);
+	}
+
+	TEST_F(c_api, sink) {
+		auto const report = make_report();
+		std::string doc{};
+		ASSERT_EQ(QDRA_OK, qdra_generate_to(engine_, &report, append, &doc)) << qdra_last_error();
+		EXPECT_EQ(generate(report), doc);
+
+		EXPECT_EQ(QDRA_SINK_FAILED, qdra_generate_to(engine_, &report, refuse, nullptr));
+	}
+
+	TEST_F(c_api, invalid_input) {
+		auto report = make_report();
+		report.serial = 100;
+		size_t size{};
+		EXPECT_EQ(QDRA_INVALID_ARGUMENT, qdra_generate(engine_, &report, nullptr, 0, &size));
+		EXPECT_EQ("report: serial number must be in range 1 to 99 inclusive"sv, qdra_last_error());
+
+		auto both = insured[0];
+		both.passport = "XY0000000";
+		report = make_report();
+		report.insured = &both;
+		report.insured_count = 1;
+		EXPECT_EQ(QDRA_INVALID_ARGUMENT, qdra_generate(engine_, &report, nullptr, 0, &size));
+		EXPECT_EQ("insured #0: one of social_id, id_card or passport is needed"sv, qdra_last_error());
+
+		report = make_report();
+		report.struct_size = sizeof(qdra_report) / 2;
+		EXPECT_EQ(QDRA_INVALID_ARGUMENT, qdra_generate(engine_, &report, nullptr, 0, &size));
+	}
+
+	TEST_F(c_api, concurrent) {
+		auto const expected = generate(make_report());
+
+		std::vector<std::string> results(8);
+		std::vector<std::thread> threads{};
+		for (auto& result : results) {
+			threads.emplace_back([&result] {
+				auto const report = make_report();
+				for (int round = 0; round < 10; ++round) {
+					result.clear();
+					if (qdra_generate_to(engine_, &report, append, &result) != QDRA_OK) return;
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		for (auto const& result : results) {
+			EXPECT_EQ(expected, result);
+		}
+	}
+}  // namespace quick_dra::testing
@@ -0,0 +1,61 @@
+# Copyright (c) 2026 Marcin Zdun
+# This code is licensed under MIT license (see LICENSE for details)
+
+# Generates libs/libbase/src/base/case_tables.hpp, the simple case mapping
+# of the Latin-1 Supplement and Latin Extended-A blocks, used by the text
+# module before handing the string over to ICU.
+
+import sys
+import unicodedata
+from pathlib import Path
+
+FIRST = 0x80
+LAST = 0x17F
+PER_LINE = 8
+
+ROOT = Path(__file__).resolve().parent.parent
+OUTPUT = ROOT / "libs" / "libbase" / "src" / "base" / "case_tables.hpp"
+
+
+def simple(mapped: str) -> int:
+    # zero asks for the full mapping, e.g. for "ß" -> "SS"
+    return ord(mapped) if len(mapped) == 1 else 0
+
+
+def table(name: str, mapping) -> list[str]:
+    lines = [f"\tinline constexpr char16_t {name}[] = {{"]
+    for start in range(FIRST, LAST + 1, PER_LINE):
+        values = ", ".join(
+            f"0x{simple(mapping(chr(code_point))):04X}"
+            for code_point in range(start, min(start + PER_LINE, LAST + 1))
+        )
+        lines.append(f"\t    {values},  // U+{start:04X}")
+    lines.append("\t};")
+    return lines
+
+
+def main():
+    lines = [
+        "// Copyright (c) 2026 midnightBITS",
+        "// This code is licensed under MIT license (see LICENSE for details)",
+        "",
+        f"// Generated by tools/{Path(__file__).name} from Unicode {unicodedata.unidata_version}; do not edit.",
+        "",
+        "#pragma once",
+        "",
+        "namespace quick_dra::text::tables {",
+        f"\tinline constexpr char32_t first = 0x{FIRST:04X};",
+        f"\tinline constexpr char32_t last = 0x{LAST:04X};",
+        "",
+        *table("upper", str.upper),
+        "",
+        *table("lower", str.lower),
+        "}  // namespace quick_dra::text::tables",
+        "",
+    ]
+    OUTPUT.write_text("\n".join(lines), encoding="UTF-8", newline="\n")
+    print(OUTPUT.relative_to(ROOT), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()